@@ -0,0 +1,310 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "binary_trace.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+constexpr uint64_t kAlignment{8};
+
+uint64_t
+Align(uint64_t offset)
+{
+  return (offset + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+// Whether [offset, offset + count * width) is an aligned section inside a
+// file of the given size
+bool
+IsSection(uint64_t offset, uint64_t count, uint64_t width, uint64_t size)
+{
+  return offset % kAlignment == 0 && offset >= sizeof(BinaryTrace::Header) &&
+         offset <= size && count <= (size - offset) / width;
+}
+
+}  // namespace
+
+BinaryTrace::BinaryTrace(const std::string& path) : path_(path)
+{
+  const int fd{open(path.c_str(), O_RDONLY)};
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open binary trace '" + path + "'.");
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header)) {
+    close(fd);
+    throw std::runtime_error("'" + path + "' is not a binary trace.");
+  }
+  map_size_ = st.st_size;
+  map_ = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map_ == MAP_FAILED) {
+    map_ = nullptr;
+    throw std::runtime_error("Failed to map binary trace '" + path + "'.");
+  }
+
+  header_ = static_cast<const Header*>(map_);
+  const auto invalid{[this](const std::string& reason) {
+    munmap(map_, map_size_);
+    return std::runtime_error(reason);
+  }};
+
+  if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0) {
+    throw invalid("'" + path + "' is not a binary trace.");
+  }
+  if (header_->byte_order == kSwappedByteOrderMark) {
+    throw invalid(
+        "Binary trace '" + path +
+        "' was written on a machine with the other byte order.");
+  }
+  if (header_->version != kVersion) {
+    throw invalid(
+        "Binary trace '" + path + "' has version " +
+        std::to_string(header_->version) + ", expected " +
+        std::to_string(kVersion) + ".");
+  }
+
+  const uint64_t count{header_->count};
+  const bool valid{
+      header_->byte_order == kByteOrderMark &&
+      (!(header_->flags & kHasTimestamps) ||
+       IsSection(header_->timestamps_offset, count, 8, map_size_)) &&
+      (!(header_->flags & kHasDelays) ||
+       IsSection(header_->delays_offset, count, 8, map_size_)) &&
+      (!(header_->flags & kHasSessionIds) ||
+       IsSection(header_->session_ids_offset, count, 8, map_size_)) &&
+      IsSection(header_->payloads_offset, count, 16, map_size_) &&
+      header_->blob_offset <= map_size_ &&
+      header_->blob_size <= map_size_ - header_->blob_offset};
+  if (!valid) {
+    throw invalid("Binary trace '" + path + "' is truncated or corrupt.");
+  }
+
+  blob_ = static_cast<const uint8_t*>(map_) + header_->blob_offset;
+}
+
+BinaryTrace::~BinaryTrace()
+{
+  if (map_) {
+    munmap(map_, map_size_);
+  }
+}
+
+bool
+BinaryTrace::IsBinaryTrace(const std::string& path)
+{
+  char magic[sizeof(kMagic)]{};
+  std::ifstream file(path, std::ios::binary);
+  file.read(magic, sizeof(magic));
+  return file && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+void
+BinaryTrace::Write(
+    const std::string& path, size_t count,
+    const std::function<BinaryTraceRecord(size_t)>& record)
+{
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.byte_order = kByteOrderMark;
+  header.count = count;
+
+  for (size_t i{0}; i < count; ++i) {
+    const BinaryTraceRecord r{record(i)};
+    header.flags |= (r.timestamp ? kHasTimestamps : 0) |
+                    (r.delay ? kHasDelays : 0) |
+                    (r.session_id ? kHasSessionIds : 0);
+    if (r.session_id) {
+      header.blob_size += sizeof(uint32_t) + r.session_id->size();
+    }
+    header.blob_size += r.payload.size();
+  }
+
+  uint64_t offset{Align(sizeof(Header))};
+  const auto place{[&](uint32_t flag, uint64_t width) -> uint64_t {
+    if (flag && !(header.flags & flag)) {
+      return 0;
+    }
+    const uint64_t section{offset};
+    offset += count * width;
+    return section;
+  }};
+  header.timestamps_offset = place(kHasTimestamps, 8);
+  header.delays_offset = place(kHasDelays, 8);
+  header.session_ids_offset = place(kHasSessionIds, 8);
+  header.payloads_offset = place(0, 16);
+  header.blob_offset = offset;
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::runtime_error(
+        "Failed to open binary trace '" + path + "' for writing.");
+  }
+  const auto write_u64{[&file](uint64_t value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }};
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write("\0\0\0\0\0\0\0", Align(sizeof(Header)) - sizeof(Header));
+
+  if (header.flags & kHasTimestamps) {
+    for (size_t i{0}; i < count; ++i) {
+      write_u64(record(i).timestamp.value_or(kNoValue));
+    }
+  }
+  if (header.flags & kHasDelays) {
+    for (size_t i{0}; i < count; ++i) {
+      write_u64(record(i).delay.value_or(kNoValue));
+    }
+  }
+  // The blob holds the session ID, if any, then the payload of each request
+  uint64_t blob_offset{0};
+  if (header.flags & kHasSessionIds) {
+    for (size_t i{0}; i < count; ++i) {
+      const BinaryTraceRecord r{record(i)};
+      if (r.session_id) {
+        write_u64(blob_offset);
+        blob_offset += sizeof(uint32_t) + r.session_id->size();
+      } else {
+        write_u64(kNoValue);
+      }
+      blob_offset += r.payload.size();
+    }
+  }
+  blob_offset = 0;
+  for (size_t i{0}; i < count; ++i) {
+    const BinaryTraceRecord r{record(i)};
+    if (r.session_id) {
+      blob_offset += sizeof(uint32_t) + r.session_id->size();
+    }
+    write_u64(blob_offset);
+    write_u64(r.payload.size());
+    blob_offset += r.payload.size();
+  }
+  for (size_t i{0}; i < count; ++i) {
+    const BinaryTraceRecord r{record(i)};
+    if (r.session_id) {
+      const uint32_t size(r.session_id->size());
+      file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+      file.write(r.session_id->data(), r.session_id->size());
+    }
+    file.write(r.payload.data(), r.payload.size());
+  }
+
+  if (!file.flush()) {
+    throw std::runtime_error("Failed to write binary trace '" + path + "'.");
+  }
+}
+
+bool
+BinaryTrace::HasInput(const std::string& name) const
+{
+  if (name == "payload") {
+    return true;
+  } else if (name == "timestamp") {
+    return header_->flags & kHasTimestamps;
+  } else if (name == "delay") {
+    return header_->flags & kHasDelays;
+  } else if (name == "session_id") {
+    return header_->flags & kHasSessionIds;
+  }
+  return false;
+}
+
+TensorData
+BinaryTrace::GetInputData(const std::string& name, size_t index) const
+{
+  TensorData data{};
+  if (index >= Size() || !HasInput(name)) {
+    return data;
+  }
+
+  const auto corrupt{[this, index]() {
+    return std::runtime_error(
+        "Request " + std::to_string(index) + " of binary trace '" + path_ +
+        "' is out of bounds.");
+  }};
+
+  if (name == "timestamp" || name == "delay") {
+    const uint64_t* value{
+        Column(
+            name == "timestamp" ? header_->timestamps_offset
+                                : header_->delays_offset) +
+        index};
+    if (*value != kNoValue) {
+      data.data_ptr = reinterpret_cast<const uint8_t*>(value);
+      data.batch1_size = sizeof(uint64_t);
+      data.is_valid = true;
+    }
+  } else if (name == "session_id") {
+    const uint64_t offset{Column(header_->session_ids_offset)[index]};
+    if (offset != kNoValue) {
+      uint32_t size{};
+      if (offset > header_->blob_size ||
+          header_->blob_size - offset < sizeof(size)) {
+        throw corrupt();
+      }
+      std::memcpy(&size, blob_ + offset, sizeof(size));
+      if (header_->blob_size - offset - sizeof(size) < size) {
+        throw corrupt();
+      }
+      data.data_ptr = blob_ + offset;
+      data.batch1_size = sizeof(size) + size;
+      data.is_valid = true;
+    }
+  } else {
+    const uint64_t* entry{Column(header_->payloads_offset) + 2 * index};
+    if (entry[0] > header_->blob_size ||
+        header_->blob_size - entry[0] < entry[1]) {
+      throw corrupt();
+    }
+    data.data_ptr = blob_ + entry[0];
+    data.batch1_size = entry[1];
+    data.is_valid = true;
+  }
+  return data;
+}
+
+const uint64_t*
+BinaryTrace::Column(uint64_t offset) const
+{
+  return reinterpret_cast<const uint64_t*>(
+      static_cast<const uint8_t*>(map_) + offset);
+}
+
+}}  // namespace triton::perfanalyzer
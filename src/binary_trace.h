@@ -0,0 +1,146 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "tensor_data.h"
+
+namespace triton { namespace perfanalyzer {
+
+/// One request of a binary trace, as handed to BinaryTrace::Write.
+///
+struct BinaryTraceRecord {
+  std::optional<uint64_t> timestamp;
+  std::optional<uint64_t> delay;
+  std::optional<std::string_view> session_id;
+  std::string_view payload;
+};
+
+/// A read-only, memory-mapped trace of OpenAI request payloads.
+///
+/// A binary trace holds the same data as a single stream input data JSON
+/// whose steps have a "payload" and optionally a "timestamp", a "delay" and
+/// a "session_id". Requests are read in place from the mapped file, so
+/// opening a trace costs the same whatever its size.
+///
+/// The file is in the byte order of the machine that wrote it, which the
+/// header records in byte_order. Its columns are read in place, so a trace
+/// is rejected on a machine with the other byte order. Every section starts
+/// 8-byte aligned:
+///
+///   header       Header, below
+///   timestamps   count x uint64, if kHasTimestamps is set
+///   delays       count x uint64, if kHasDelays is set
+///   session ids  count x uint64 blob offsets of a uint32 byte size followed
+///                by the session ID bytes, if kHasSessionIds is set
+///   payloads     count x {uint64 blob offset, uint64 byte size}
+///   blob         The session ID and payload bytes
+///
+/// A request without a timestamp, a delay or a session ID has kNoValue in
+/// that column.
+///
+class BinaryTrace {
+ public:
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t byte_order;
+    uint32_t reserved;
+    uint64_t count;
+    uint64_t timestamps_offset;
+    uint64_t delays_offset;
+    uint64_t session_ids_offset;
+    uint64_t payloads_offset;
+    uint64_t blob_offset;
+    uint64_t blob_size;
+  };
+
+  static constexpr char kMagic[8]{'P', 'A', 'T', 'R', 'A', 'C', 'E', '\0'};
+  static constexpr uint32_t kVersion{2};
+  static constexpr uint32_t kByteOrderMark{0x01020304};
+  static constexpr uint32_t kSwappedByteOrderMark{0x04030201};
+  static constexpr uint32_t kHasTimestamps{1u << 0};
+  static constexpr uint32_t kHasDelays{1u << 1};
+  static constexpr uint32_t kHasSessionIds{1u << 2};
+  static constexpr uint64_t kNoValue{UINT64_MAX};
+
+  /// Maps the binary trace at the given path.
+  /// \param path The path of the trace.
+  /// \throws std::runtime_error If the file can not be mapped or is not a
+  /// valid binary trace.
+  explicit BinaryTrace(const std::string& path);
+
+  ~BinaryTrace();
+
+  BinaryTrace(const BinaryTrace&) = delete;
+  BinaryTrace& operator=(const BinaryTrace&) = delete;
+
+  /// Returns whether the file at the given path starts with the binary trace
+  /// magic. It does not validate the rest of the file.
+  static bool IsBinaryTrace(const std::string& path);
+
+  /// Writes a binary trace.
+  /// \param path The path of the trace to write.
+  /// \param count The number of requests in the trace.
+  /// \param record Returns the request at the given index. It is called more
+  /// than once per request and the views it returns only need to live until
+  /// the next call.
+  /// \throws std::runtime_error If the trace can not be written.
+  static void Write(
+      const std::string& path, size_t count,
+      const std::function<BinaryTraceRecord(size_t)>& record);
+
+  /// Returns the number of requests in the trace.
+  size_t Size() const { return header_->count; }
+
+  /// Returns whether the trace has a column for the input of the given name.
+  bool HasInput(const std::string& name) const;
+
+  /// Returns the data of an input of a request, pointing into the mapped
+  /// file. The data is not valid if the trace has no value for it.
+  /// \param name The name of the input: "payload", "timestamp", "delay" or
+  /// "session_id".
+  /// \param index The index of the request.
+  TensorData GetInputData(const std::string& name, size_t index) const;
+
+ private:
+  const uint64_t* Column(uint64_t offset) const;
+
+  std::string path_;
+  void* map_{nullptr};
+  size_t map_size_{0};
+  const Header* header_{nullptr};
+  const uint8_t* blob_{nullptr};
+};
+
+}}  // namespace triton::perfanalyzer
@@ -139,13 +139,16 @@ ClientBackendFactory::Create(
     const std::string& model_repository_path, const bool verbose,
     const std::string& metrics_url, const cb::TensorFormat input_tensor_format,
     const cb::TensorFormat output_tensor_format, const std::string& grpc_method,
+    const CpuAffinity& completion_cpus, const size_t transfer_shards,
+    const size_t max_connections,
     std::shared_ptr<ClientBackendFactory>* factory)
 {
   factory->reset(new ClientBackendFactory(
       kind, url, endpoint, protocol, ssl_options, trace_options,
       compression_algorithm, http_headers, triton_server_path,
       model_repository_path, verbose, metrics_url, input_tensor_format,
-      output_tensor_format, grpc_method));
+      output_tensor_format, grpc_method, completion_cpus, transfer_shards,
+      max_connections));
   return Error::Success;
 }
 
@@ -157,7 +160,8 @@ ClientBackendFactory::CreateClientBackend(
       kind_, url_, endpoint_, protocol_, ssl_options_, trace_options_,
       compression_algorithm_, http_headers_, verbose_, triton_server_path,
       model_repository_path_, metrics_url_, input_tensor_format_,
-      output_tensor_format_, grpc_method_, client_backend));
+      output_tensor_format_, grpc_method_, completion_cpus_, transfer_shards_,
+      max_connections_, client_backend));
   return Error::Success;
 }
 
@@ -181,6 +185,8 @@ ClientBackend::Create(
     const std::string& model_repository_path, const std::string& metrics_url,
     const TensorFormat input_tensor_format,
     const TensorFormat output_tensor_format, const std::string& grpc_method,
+    const CpuAffinity& completion_cpus, const size_t transfer_shards,
+    const size_t max_connections,
     std::unique_ptr<ClientBackend>* client_backend)
 {
   std::unique_ptr<ClientBackend> local_backend;
@@ -201,14 +207,15 @@ ClientBackend::Create(
 #ifdef TRITON_ENABLE_PERF_ANALYZER_OPENAI
   else if (kind == OPENAI) {
     RETURN_IF_CB_ERROR(openai::OpenAiClientBackend::Create(
-        url, endpoint, protocol, http_headers, verbose, &local_backend));
+        url, endpoint, protocol, http_headers, verbose, completion_cpus,
+        transfer_shards, max_connections, &local_backend));
   }
 #endif  // TRITON_ENABLE_PERF_ANALYZER_OPENAI
 #ifdef TRITON_ENABLE_PERF_ANALYZER_TFS
   else if (kind == TENSORFLOW_SERVING) {
     RETURN_IF_CB_ERROR(tfserving::TFServeClientBackend::Create(
         url, protocol, BackendToGrpcType(compression_algorithm), http_headers,
-        verbose, &local_backend));
+        verbose, completion_cpus, &local_backend));
   }
 #endif  // TRITON_ENABLE_PERF_ANALYZER_TFS
 #ifdef TRITON_ENABLE_PERF_ANALYZER_TS
@@ -40,6 +40,7 @@
 #include "../constants.h"
 #include "../metrics.h"
 #include "../perf_analyzer_exception.h"
+#include "cpu_affinity.h"
 #include "ipc.h"
 
 #ifdef TRITON_ENABLE_GPU
@@ -173,10 +174,21 @@ struct InferStat {
   /// response is completely received.
   uint64_t cumulative_receive_time_ns;
 
+  /// Number of completed requests that opened a new connection and number of
+  /// those that reused an open one. Both stay zero for the client libraries
+  /// that do not report them.
+  size_t new_connection_count;
+  size_t reused_connection_count;
+
+  /// Time spent opening the new connections, including the TLS handshake.
+  uint64_t cumulative_connect_time_ns;
+
   /// Create a new InferStat object with zero-ed statistics.
   InferStat()
       : completed_request_count(0), cumulative_total_request_time_ns(0),
-        cumulative_send_time_ns(0), cumulative_receive_time_ns(0)
+        cumulative_send_time_ns(0), cumulative_receive_time_ns(0),
+        new_connection_count(0), reused_connection_count(0),
+        cumulative_connect_time_ns(0)
   {
   }
 };
@@ -295,6 +307,14 @@ class ClientBackendFactory {
   /// format.
   /// \param output_tensor_format The Triton inference response output tensor
   /// format.
+  /// \param completion_cpus The CPUs that the threads receiving the
+  /// responses are pinned to. Empty to leave them unpinned.
+  /// \param transfer_shards Only for OpenAI backend. The number of threads
+  /// transferring the requests of each client, each with its own curl multi
+  /// handle.
+  /// \param max_connections Only for OpenAI backend. The maximum number of
+  /// connections each of these threads keeps open to the server, 0 for no
+  /// limit.
   /// \param factory Returns a new ClientBackend object.
   /// \return Error object indicating success or failure.
   static Error Create(
@@ -308,6 +328,8 @@ class ClientBackendFactory {
       const std::string& model_repository_path, const bool verbose,
       const std::string& metrics_url, const TensorFormat input_tensor_format,
       const TensorFormat output_tensor_format, const std::string& grpc_method,
+      const CpuAffinity& completion_cpus, const size_t transfer_shards,
+      const size_t max_connections,
       std::shared_ptr<ClientBackendFactory>* factory);
 
   const BackendKind& Kind();
@@ -327,14 +349,18 @@ class ClientBackendFactory {
       const std::string& triton_server_path,
       const std::string& model_repository_path, const bool verbose,
       const std::string& metrics_url, const TensorFormat input_tensor_format,
-      const TensorFormat output_tensor_format, const std::string& grpc_method)
+      const TensorFormat output_tensor_format, const std::string& grpc_method,
+      const CpuAffinity& completion_cpus, const size_t transfer_shards,
+      const size_t max_connections)
       : kind_(kind), url_(url), endpoint_(endpoint), protocol_(protocol),
         ssl_options_(ssl_options), trace_options_(trace_options),
         compression_algorithm_(compression_algorithm),
         http_headers_(http_headers), triton_server_path(triton_server_path),
         model_repository_path_(model_repository_path), verbose_(verbose),
         metrics_url_(metrics_url), input_tensor_format_(input_tensor_format),
-        output_tensor_format_(output_tensor_format), grpc_method_(grpc_method)
+        output_tensor_format_(output_tensor_format), grpc_method_(grpc_method),
+        completion_cpus_(completion_cpus), transfer_shards_(transfer_shards),
+        max_connections_(max_connections)
   {
   }
 
@@ -353,7 +379,9 @@ class ClientBackendFactory {
   const TensorFormat input_tensor_format_{TensorFormat::UNKNOWN};
   const TensorFormat output_tensor_format_{TensorFormat::UNKNOWN};
   const std::string grpc_method_;
-
+  const CpuAffinity completion_cpus_;
+  const size_t transfer_shards_{1};
+  const size_t max_connections_{0};
 
 #ifndef DOCTEST_CONFIG_DISABLE
  protected:
@@ -382,6 +410,8 @@ class ClientBackend {
       const std::string& library_directory, const std::string& model_repository,
       const std::string& metrics_url, const TensorFormat input_tensor_format,
       const TensorFormat output_tensor_format, const std::string& grpc_method,
+      const CpuAffinity& completion_cpus, const size_t transfer_shards,
+      const size_t max_connections,
       std::unique_ptr<ClientBackend>* client_backend);
 
   /// Destructor for the client backend object
@@ -664,6 +694,19 @@ class InferResult {
   virtual Error RawData(
       const std::string& output_name, std::vector<uint8_t>& buf) const = 0;
 
+  /// Returns a view of the raw data of the output, without copying it. The
+  /// view is owned by the result and is valid as long as the result is.
+  /// \param output_name The name of the output.
+  /// \param buf Returns the pointer to the start of the output data.
+  /// \param byte_size Returns the size of the output data in bytes.
+  /// \return Error object indicating the success or failure.
+  virtual Error RawData(
+      const std::string& output_name, const uint8_t** buf,
+      size_t* byte_size) const
+  {
+    return Error("InferResult::RawData() not implemented");
+  }
+
   /// Get final response bool for this response.
   /// \return Error object indicating the success or failure.
   virtual Error IsFinalResponse(bool* is_final_response) const
@@ -0,0 +1,233 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "cpu_affinity.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace triton { namespace perfanalyzer { namespace clientbackend {
+
+namespace {
+
+int
+ParseCpuNumber(const std::string& token, const std::string& list)
+{
+  if (token.empty() || token.size() > 9 ||
+      token.find_first_not_of("0123456789") != std::string::npos) {
+    throw std::invalid_argument("Invalid CPU list '" + list + "'.");
+  }
+  const int cpu{std::stoi(token)};
+  if (cpu >= CPU_SETSIZE) {
+    throw std::invalid_argument(
+        "CPU " + token + " is out of range. CPUs must be below " +
+        std::to_string(CPU_SETSIZE) + ".");
+  }
+  return cpu;
+}
+
+std::string
+ReadNodeCpuList(const std::string& node_dir, const std::string& node)
+{
+  std::ifstream file(node_dir + "/node" + node + "/cpulist");
+  if (!file) {
+    throw std::invalid_argument("NUMA node " + node + " does not exist.");
+  }
+  std::string list;
+  std::getline(file, list);
+  return list;
+}
+
+}  // namespace
+
+CpuAffinity
+CpuAffinity::Parse(const std::string& spec, const std::string& node_dir)
+{
+  CpuAffinity affinity;
+  affinity.cpus_ = ParseCpuList(spec, node_dir);
+  if (affinity.cpus_.empty()) {
+    throw std::invalid_argument(
+        "The CPU list '" + spec + "' does not contain any CPU.");
+  }
+
+  const CpuAffinity allowed{Current()};
+  for (const int cpu : affinity.cpus_) {
+    if (!std::binary_search(allowed.cpus_.begin(), allowed.cpus_.end(), cpu)) {
+      throw std::invalid_argument(
+          "CPU " + std::to_string(cpu) +
+          " is not available to this process. Available CPUs are " +
+          allowed.ToString() + ".");
+    }
+  }
+  return affinity;
+}
+
+CpuAffinity
+CpuAffinity::Current()
+{
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  const int rc{pthread_getaffinity_np(pthread_self(), sizeof(set), &set)};
+  if (rc != 0) {
+    throw std::system_error(
+        rc, std::generic_category(), "Failed to get the thread CPU affinity");
+  }
+
+  CpuAffinity affinity;
+  for (int cpu{0}; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &set)) {
+      affinity.cpus_.push_back(cpu);
+    }
+  }
+  return affinity;
+}
+
+std::string
+CpuAffinity::ToString() const
+{
+  std::string list;
+  for (size_t i{0}; i < cpus_.size();) {
+    size_t last{i};
+    while (last + 1 < cpus_.size() && cpus_[last + 1] == cpus_[last] + 1) {
+      ++last;
+    }
+    if (!list.empty()) {
+      list += ",";
+    }
+    list += std::to_string(cpus_[i]);
+    if (last > i) {
+      list += "-" + std::to_string(cpus_[last]);
+    }
+    i = last + 1;
+  }
+  return list;
+}
+
+std::vector<int>
+CpuAffinity::NumaNodes(const std::string& node_dir) const
+{
+  std::vector<int> nodes;
+  std::error_code ec;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(node_dir, ec)) {
+    const std::string name{entry.path().filename().string()};
+    const std::string node{name.substr(std::min<size_t>(name.size(), 4))};
+    if (name.rfind("node", 0) != 0 || node.empty() ||
+        node.find_first_not_of("0123456789") != std::string::npos) {
+      continue;
+    }
+    const std::vector<int> node_cpus{
+        ParseCpuList(ReadNodeCpuList(node_dir, node), "")};
+    const bool overlaps{std::any_of(
+        node_cpus.begin(), node_cpus.end(), [this](const int cpu) {
+          return std::binary_search(cpus_.begin(), cpus_.end(), cpu);
+        })};
+    if (overlaps) {
+      nodes.push_back(std::stoi(node));
+    }
+  }
+  std::sort(nodes.begin(), nodes.end());
+  return nodes;
+}
+
+void
+CpuAffinity::PinCurrentThread() const
+{
+  if (cpus_.empty()) {
+    return;
+  }
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const int cpu : cpus_) {
+    CPU_SET(cpu, &set);
+  }
+  const int rc{pthread_setaffinity_np(pthread_self(), sizeof(set), &set)};
+  if (rc != 0) {
+    throw std::system_error(
+        rc, std::generic_category(),
+        "Failed to pin the thread to CPUs " + ToString());
+  }
+}
+
+std::vector<int>
+CpuAffinity::ParseCpuList(const std::string& list, const std::string& node_dir)
+{
+  std::vector<int> cpus;
+  size_t begin{0};
+  while (begin < list.size()) {
+    size_t end{list.find(',', begin)};
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    const std::string item{list.substr(begin, end - begin)};
+    begin = end + 1;
+
+    // NUMA nodes are only allowed in the user-provided list
+    if (!node_dir.empty() && item.rfind("node:", 0) == 0) {
+      const std::string node{item.substr(5)};
+      if (node.empty() ||
+          node.find_first_not_of("0123456789") != std::string::npos) {
+        throw std::invalid_argument("Invalid NUMA node '" + item + "'.");
+      }
+      const std::vector<int> node_cpus{
+          ParseCpuList(ReadNodeCpuList(node_dir, node), "")};
+      cpus.insert(cpus.end(), node_cpus.begin(), node_cpus.end());
+      continue;
+    }
+
+    const size_t dash{item.find('-')};
+    const int first{ParseCpuNumber(item.substr(0, dash), list)};
+    const int last{
+        dash == std::string::npos
+            ? first
+            : ParseCpuNumber(item.substr(dash + 1), list)};
+    if (last < first) {
+      throw std::invalid_argument(
+          "Invalid CPU range '" + item + "'. The range must not decrease.");
+    }
+    for (int cpu{first}; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+
+  // The loop above never sees the empty item after a trailing comma
+  if (!list.empty() && list.back() == ',') {
+    throw std::invalid_argument("Invalid CPU list '" + list + "'.");
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+}}}  // namespace triton::perfanalyzer::clientbackend
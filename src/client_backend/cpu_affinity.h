@@ -0,0 +1,87 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace triton { namespace perfanalyzer { namespace clientbackend {
+
+/// A set of logical CPUs that a thread is pinned to. An empty set leaves the
+/// thread free to run on any CPU.
+///
+/// Threads start with the affinity of the thread that creates them and the
+/// kernel places the pages a thread touches first on the NUMA node it runs
+/// on, so a thread that pins itself before allocating its buffers keeps them
+/// on the node of its CPUs.
+///
+class CpuAffinity {
+ public:
+  /// Parses a comma-separated list of CPUs, CPU ranges and NUMA nodes, e.g.
+  /// "0-3,8" or "node:1". A NUMA node stands for all of its CPUs.
+  /// \param spec The CPU list.
+  /// \param node_dir The sysfs directory that lists the NUMA nodes.
+  /// \return The set of CPUs.
+  /// \throws std::invalid_argument If the list is not valid or names a CPU
+  /// that this process is not allowed to run on.
+  static CpuAffinity Parse(
+      const std::string& spec,
+      const std::string& node_dir = "/sys/devices/system/node");
+
+  /// Returns the CPUs the calling thread is currently allowed to run on.
+  /// \throws std::system_error If the affinity cannot be read.
+  static CpuAffinity Current();
+
+  bool Empty() const { return cpus_.empty(); }
+
+  /// The CPUs of the set in increasing order
+  const std::vector<int>& Cpus() const { return cpus_; }
+
+  /// Returns the set as a CPU list with consecutive CPUs merged into ranges,
+  /// e.g. "0-3,8".
+  std::string ToString() const;
+
+  /// Returns the NUMA nodes that own at least one CPU of the set.
+  /// \param node_dir The sysfs directory that lists the NUMA nodes.
+  std::vector<int> NumaNodes(
+      const std::string& node_dir = "/sys/devices/system/node") const;
+
+  /// Pins the calling thread to the CPUs of the set. Does nothing if the set
+  /// is empty.
+  /// \throws std::system_error If the thread cannot be pinned.
+  void PinCurrentThread() const;
+
+  bool operator==(const CpuAffinity& other) const = default;
+
+ private:
+  static std::vector<int> ParseCpuList(
+      const std::string& list, const std::string& node_dir);
+
+  std::vector<int> cpus_;
+};
+
+}}}  // namespace triton::perfanalyzer::clientbackend
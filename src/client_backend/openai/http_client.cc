@@ -26,8 +26,11 @@
 
 #include "http_client.h"
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iostream>
+#include <system_error>
 
 namespace triton { namespace perfanalyzer { namespace clientbackend {
 namespace openai {
@@ -38,18 +41,12 @@ HttpRequest::HttpRequest(
 {
 }
 
-HttpRequest::~HttpRequest()
-{
-  if (header_list_ != nullptr) {
-    curl_slist_free_all(header_list_);
-    header_list_ = nullptr;
-  }
-}
+HttpRequest::~HttpRequest() {}
 
 void
-HttpRequest::AddInput(uint8_t* buf, size_t byte_size)
+HttpRequest::AddInput(const uint8_t* buf, size_t byte_size)
 {
-  data_buffers_.push_back(std::pair<uint8_t*, size_t>(buf, byte_size));
+  data_buffers_.push_back(std::pair<const uint8_t*, size_t>(buf, byte_size));
   total_input_byte_size_ += byte_size;
 }
 
@@ -79,8 +76,10 @@ HttpRequest::GetNextInput(uint8_t* buf, size_t size, size_t* input_bytes)
 std::mutex HttpClient::curl_init_mtx_{};
 HttpClient::HttpClient(
     const std::string& server_url, bool verbose,
-    const HttpSslOptions& ssl_options)
-    : url_(server_url), verbose_(verbose), ssl_options_(ssl_options)
+    const HttpSslOptions& ssl_options, const CpuAffinity& completion_cpus,
+    size_t transfer_shards, size_t max_connections)
+    : url_(server_url), verbose_(verbose), ssl_options_(ssl_options),
+      completion_cpus_(completion_cpus)
 {
   // [TODO TMA-1670] uncomment below and remove class-wise mutex once confirm
   // curl >= 7.84.0 will always be used
@@ -97,27 +96,51 @@ HttpClient::HttpClient(
     }
   }
 
-  multi_handle_ = curl_multi_init();
-
-  worker_ = std::thread(&HttpClient::AsyncTransfer, this);
+  if (transfer_shards == 0) {
+    throw std::runtime_error("The number of transfer shards must be > 0.");
+  }
+  for (size_t i = 0; i < transfer_shards; i++) {
+    auto& shard{*shards_.emplace_back(std::make_unique<TransferShard>())};
+    shard.multi_handle = curl_multi_init();
+    if (max_connections > 0) {
+      // Cap the open connections, and keep as many of them in the cache so
+      // that they are reused instead of being closed once idle
+      const long max_connections_l{static_cast<long>(max_connections)};
+      curl_multi_setopt(
+          shard.multi_handle, CURLMOPT_MAX_TOTAL_CONNECTIONS,
+          max_connections_l);
+      curl_multi_setopt(
+          shard.multi_handle, CURLMOPT_MAXCONNECTS, max_connections_l);
+    }
+    shard.worker =
+        std::thread(&HttpClient::AsyncTransfer, this, std::ref(shard));
+  }
 }
 
 HttpClient::~HttpClient()
 {
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    exiting_ = true;
-  }
+  StopTransfers();
 
-  curl_multi_wakeup(multi_handle_);
+  for (auto& shard : shards_) {
+    curl_multi_cleanup(shard->multi_handle);
+  }
 
-  // thread not joinable if AsyncInfer() is not called
-  // (it is default constructed thread before the first AsyncInfer() call)
-  if (worker_.joinable()) {
-    worker_.join();
+  for (CURL* handle : easy_handle_pool_) {
+    curl_easy_cleanup(handle);
   }
 
-  curl_multi_cleanup(multi_handle_);
+  if (verbose_) {
+    const auto stats{TransferShardStats()};
+    for (size_t i = 0; i < stats.size(); i++) {
+      std::cout << "Transfer shard " << i << ": "
+                << stats[i].completed_request_count
+                << " completed requests, at most "
+                << stats[i].max_active_handles << " active handles, "
+                << stats[i].poll_wakeups << " poll wakeups, "
+                << stats[i].cumulative_busy_time_ns / 1000
+                << " usec busy" << std::endl;
+    }
+  }
 
   {
     std::lock_guard<std::mutex> lk(curl_init_mtx_);
@@ -125,6 +148,41 @@ HttpClient::~HttpClient()
   }
 }
 
+void
+HttpClient::StopTransfers()
+{
+  for (auto& shard : shards_) {
+    {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      exiting_ = true;
+    }
+    curl_multi_wakeup(shard->multi_handle);
+  }
+
+  for (auto& shard : shards_) {
+    if (shard->worker.joinable()) {
+      shard->worker.join();
+    }
+  }
+}
+
+std::vector<TransferShardStat>
+HttpClient::TransferShardStats() const
+{
+  std::vector<TransferShardStat> stats;
+  stats.reserve(shards_.size());
+  for (const auto& shard : shards_) {
+    TransferShardStat& stat{stats.emplace_back()};
+    stat.outstanding_requests = shard->outstanding_requests;
+    stat.active_handles = shard->active_handles;
+    stat.max_active_handles = shard->max_active_handles;
+    stat.completed_request_count = shard->completed_request_count;
+    stat.cumulative_busy_time_ns = shard->cumulative_busy_time_ns;
+    stat.poll_wakeups = shard->poll_wakeups;
+  }
+  return stats;
+}
+
 const std::string&
 HttpClient::ParseSslCertType(HttpSslOptions::CERTTYPE cert_type)
 {
@@ -179,26 +237,72 @@ HttpClient::SetSSLCurlOptions(CURL* curl_handle)
   }
 }
 
+CURL*
+HttpClient::AcquireEasyHandle()
+{
+  {
+    std::lock_guard<std::mutex> lock(easy_handle_pool_mutex_);
+    if (!easy_handle_pool_.empty()) {
+      CURL* handle{easy_handle_pool_.back()};
+      easy_handle_pool_.pop_back();
+      return handle;
+    }
+  }
+  CURL* handle{curl_easy_init()};
+  SetupEasyHandle(handle);
+  return handle;
+}
+
+void
+HttpClient::SetupEasyHandle(CURL* handle)
+{
+  curl_easy_setopt(handle, CURLOPT_URL, url_.c_str());
+  curl_easy_setopt(handle, CURLOPT_TCP_NODELAY, 1L);
+  // Probe the idle connections so that the ones kept for reuse are not
+  // silently dropped by the network in between requests
+  curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+  if (verbose_) {
+    curl_easy_setopt(handle, CURLOPT_VERBOSE, 1L);
+  }
+  SetSSLCurlOptions(handle);
+}
+
 void
 HttpClient::Send(CURL* handle, std::unique_ptr<HttpRequest>&& request)
 {
   PrintCurlCommand(handle, std::move(request));
+  TransferShard& shard{LeastLoadedShard()};
   {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
     if (exiting_) {
       return;
     }
 
-    auto insert_result = new_async_requests_.emplace(std::make_pair(
+    auto insert_result = shard.new_async_requests.emplace(std::make_pair(
         reinterpret_cast<uintptr_t>(handle), std::move(request)));
     if (!insert_result.second) {
       curl_easy_cleanup(handle);
       throw std::runtime_error(
           "Failed to insert new asynchronous request context.");
     }
+    shard.outstanding_requests++;
   }
-  curl_multi_wakeup(multi_handle_);
+  curl_multi_wakeup(shard.multi_handle);
+}
+
+HttpClient::TransferShard&
+HttpClient::LeastLoadedShard()
+{
+  const size_t first{next_shard_++ % shards_.size()};
+  TransferShard* least_loaded{shards_[first].get()};
+  for (size_t i = 1; i < shards_.size(); i++) {
+    TransferShard* shard{shards_[(first + i) % shards_.size()].get()};
+    if (shard->outstanding_requests < least_loaded->outstanding_requests) {
+      least_loaded = shard;
+    }
+  }
+  return *least_loaded;
 }
 
 void
@@ -225,8 +329,8 @@ HttpClient::PrintCurlCommand(
     if (!request->GetDataBuffers().empty()) {
       curl_command += " -d '";
       for (const auto& buffer : request->GetDataBuffers()) {
-        curl_command +=
-            std::string(reinterpret_cast<char*>(buffer.first), buffer.second);
+        curl_command += std::string(
+            reinterpret_cast<const char*>(buffer.first), buffer.second);
       }
       curl_command += "'";
     }
@@ -246,7 +350,7 @@ HttpClient::PrintCurlCommand(
 }
 
 void
-HttpClient::AsyncTransfer()
+HttpClient::AsyncTransfer(TransferShard& shard)
 {
   int messages_in_queue = 0;
   int still_running = 0;
@@ -254,22 +358,34 @@ HttpClient::AsyncTransfer()
   CURLMsg* msg = nullptr;
   AsyncReqMap ongoing_async_requests;
 
+  try {
+    completion_cpus_.PinCurrentThread();
+  }
+  catch (const std::system_error& e) {
+    std::cerr << "WARNING: " << e.what() << std::endl;
+  }
+
   do {
     {
       // Check for new requests and add them to ongoing requests
 
-      std::lock_guard<std::mutex> lock(mutex_);
+      std::lock_guard<std::mutex> lock(shard.mutex);
 
-      for (auto& pair : new_async_requests_) {
+      for (auto& pair : shard.new_async_requests) {
         curl_multi_add_handle(
-            multi_handle_, reinterpret_cast<CURL*>(pair.first));
+            shard.multi_handle, reinterpret_cast<CURL*>(pair.first));
 
         ongoing_async_requests[pair.first] = std::move(pair.second);
       }
-      new_async_requests_.clear();
+      shard.new_async_requests.clear();
+    }
+    shard.active_handles = ongoing_async_requests.size();
+    if (shard.active_handles > shard.max_active_handles) {
+      shard.max_active_handles = shard.active_handles.load();
     }
 
-    CURLMcode mc = curl_multi_perform(multi_handle_, &still_running);
+    const auto busy_start{std::chrono::steady_clock::now()};
+    CURLMcode mc = curl_multi_perform(shard.multi_handle, &still_running);
 
     if (mc != CURLM_OK) {
       std::cerr << "Unexpected error: curl_multi failed. Code:" << mc
@@ -277,7 +393,8 @@ HttpClient::AsyncTransfer()
       continue;
     }
 
-    while ((msg = curl_multi_info_read(multi_handle_, &messages_in_queue))) {
+    while ((msg = curl_multi_info_read(
+                shard.multi_handle, &messages_in_queue))) {
       if (msg->msg != CURLMSG_DONE) {
         // Something wrong happened.
         std::cerr << "Unexpected error: received CURLMsg=" << msg->msg
@@ -292,37 +409,63 @@ HttpClient::AsyncTransfer()
         std::cerr << "Unexpected error: received completed request that is not "
                      "in the list of asynchronous requests"
                   << std::endl;
-        curl_multi_remove_handle(multi_handle_, msg->easy_handle);
+        curl_multi_remove_handle(shard.multi_handle, msg->easy_handle);
         curl_easy_cleanup(msg->easy_handle);
         continue;
       }
 
-      uint32_t http_code = 400;
+      // CURLINFO_RESPONSE_CODE is written as a long
+      long http_code = 400;
       if (msg->data.result == CURLE_OK) {
         curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &http_code);
       } else if (msg->data.result == CURLE_OPERATION_TIMEDOUT) {
         http_code = 499;
       }
 
+      // A transfer that reused an open connection did not have to connect
+      long num_connects = 0;
+      curl_easy_getinfo(msg->easy_handle, CURLINFO_NUM_CONNECTS, &num_connects);
+      itr->second->new_connection_ = (num_connects > 0);
+      if (itr->second->new_connection_) {
+        curl_off_t connect_time_us = 0;
+        curl_easy_getinfo(
+            msg->easy_handle, CURLINFO_APPCONNECT_TIME_T, &connect_time_us);
+        if (connect_time_us == 0) {
+          curl_easy_getinfo(
+              msg->easy_handle, CURLINFO_CONNECT_TIME_T, &connect_time_us);
+        }
+        itr->second->connect_time_ns_ = connect_time_us * 1000;
+      }
+
       itr->second->http_code_ = http_code;
       itr->second->completion_callback_(itr->second.get());
       ongoing_async_requests.erase(itr);
-      curl_multi_remove_handle(multi_handle_, msg->easy_handle);
-      curl_easy_cleanup(msg->easy_handle);
+      curl_multi_remove_handle(shard.multi_handle, msg->easy_handle);
+      {
+        std::lock_guard<std::mutex> lock(easy_handle_pool_mutex_);
+        easy_handle_pool_.push_back(msg->easy_handle);
+      }
+      shard.completed_request_count++;
+      shard.outstanding_requests--;
     }
-
+    shard.active_handles = ongoing_async_requests.size();
+    shard.cumulative_busy_time_ns +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - busy_start)
+            .count();
 
     // Wait for activity on existing requests or
     // explicit curl_multi_wakeup call
     //
-    // If there are no descriptors in the multi_handle_
+    // If there are no descriptors in the multi handle
     // then curl_multi_poll will wait until curl_multi_wakeup
     // is called
     //
     // curl_multi_wakeup is called when adding a new request
     // or exiting
 
-    mc = curl_multi_poll(multi_handle_, NULL, 0, INT_MAX, &numfds);
+    mc = curl_multi_poll(shard.multi_handle, NULL, 0, INT_MAX, &numfds);
+    shard.poll_wakeups++;
 
     if (mc != CURLM_OK) {
       std::cerr << "Unexpected error: curl_multi failed. Code:" << mc
@@ -333,11 +476,11 @@ HttpClient::AsyncTransfer()
 
   for (auto& request : ongoing_async_requests) {
     CURL* easy_handle = reinterpret_cast<CURL*>(request.first);
-    curl_multi_remove_handle(multi_handle_, easy_handle);
+    curl_multi_remove_handle(shard.multi_handle, easy_handle);
     curl_easy_cleanup(easy_handle);
   }
 
-  for (auto& request : new_async_requests_) {
+  for (auto& request : shard.new_async_requests) {
     CURL* easy_handle = reinterpret_cast<CURL*>(request.first);
     curl_easy_cleanup(easy_handle);
   }
@@ -27,6 +27,7 @@
 
 #include <curl/curl.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <functional>
@@ -35,6 +36,9 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
+
+#include "../cpu_affinity.h"
 
 namespace triton { namespace perfanalyzer { namespace clientbackend {
 namespace openai {
@@ -97,8 +101,9 @@ class HttpRequest {
   virtual ~HttpRequest();
 
   // Adds the input data to be delivered to the server, note that the HTTP
-  // request does not own the buffer.
-  void AddInput(uint8_t* buf, size_t byte_size);
+  // request does not own the buffer. The buffer is read in place by the
+  // transfer, so it must stay valid and unchanged until the request completes.
+  void AddInput(const uint8_t* buf, size_t byte_size);
 
   // Helper function for CURL
   // Copy into 'buf' up to 'size' bytes of input data. Return the
@@ -113,13 +118,18 @@ class HttpRequest {
   // HTTP response code for the inference request
   uint32_t http_code_{200};
 
+  // Whether the transfer opened a new connection rather than reusing an open
+  // one, and the time it took to open it, including the TLS handshake
+  bool new_connection_{false};
+  uint64_t connect_time_ns_{0};
+
   std::function<void(HttpRequest*)> completion_callback_{nullptr};
 
-  // Pointer to the list of the HTTP request header, keep it such that it will
-  // be valid during the transfer and can be freed once transfer is completed.
+  // Pointer to the list of the HTTP request header. The request does not own
+  // the list, whoever built it must keep it valid during the transfer.
   struct curl_slist* header_list_{nullptr};
 
-  const std::deque<std::pair<uint8_t*, size_t>>& GetDataBuffers() const
+  const std::deque<std::pair<const uint8_t*, size_t>>& GetDataBuffers() const
   {
     return data_buffers_;
   }
@@ -128,7 +138,24 @@ class HttpRequest {
   const bool verbose_{false};
 
   // Pointers to the input data.
-  std::deque<std::pair<uint8_t*, size_t>> data_buffers_;
+  std::deque<std::pair<const uint8_t*, size_t>> data_buffers_;
+};
+
+// The counters of one transfer shard of an HttpClient, used to size the number
+// of shards. A shard that spends most of the wall time outside of polling is
+// saturated.
+struct TransferShardStat {
+  // The requests assigned to the shard that have not completed yet
+  size_t outstanding_requests{0};
+  // The easy handles in the multi handle of the shard, now and at most
+  size_t active_handles{0};
+  size_t max_active_handles{0};
+  size_t completed_request_count{0};
+  // The time spent outside of polling, running the transfers and the response
+  // and completion callbacks of the requests
+  uint64_t cumulative_busy_time_ns{0};
+  // The number of times the shard returned from polling its multi handle
+  uint64_t poll_wakeups{0};
 };
 
 // Base class for common HTTP functionalities
@@ -138,39 +165,86 @@ class HttpClient {
 
   virtual ~HttpClient();
 
+  // Returns the counters of each transfer shard.
+  std::vector<TransferShardStat> TransferShardStats() const;
+
  protected:
   void SetSSLCurlOptions(CURL* curl_handle);
 
+  // The requests are transferred by 'transfer_shards' threads, each with its
+  // own curl multi handle. A new request goes to the shard with the least
+  // outstanding requests. Each shard keeps at most 'max_connections'
+  // connections open to the server, 0 for no limit.
   HttpClient(
       const std::string& server_url, bool verbose = false,
-      const HttpSslOptions& ssl_options = HttpSslOptions());
+      const HttpSslOptions& ssl_options = HttpSslOptions(),
+      const CpuAffinity& completion_cpus = CpuAffinity(),
+      size_t transfer_shards = 1, size_t max_connections = 0);
+
+  // Returns an easy handle from the pool, or a new one set up by
+  // SetupEasyHandle() if the pool is empty. The handle goes back to the pool
+  // once its request completes, with all its options kept, so only the
+  // options that differ between requests need to be set again.
+  CURL* AcquireEasyHandle();
+
+  // Sets the options shared by all the requests on a new easy handle
+  virtual void SetupEasyHandle(CURL* handle);
 
   // Note that this function does not block
   void Send(CURL* handle, std::unique_ptr<HttpRequest>&& request);
 
+  // Stops and joins the transfer threads. Subclasses whose members are used
+  // by the requests in flight call it first in their destructor.
+  void StopTransfers();
+
   void PrintCurlCommand(CURL* handle, std::unique_ptr<HttpRequest>&& request);
 
-  void AsyncTransfer();
+  using AsyncReqMap = std::map<uintptr_t, std::unique_ptr<HttpRequest>>;
 
-  bool exiting_{false};
+  // A thread and the curl multi handle it transfers its requests on
+  struct TransferShard {
+    std::thread worker;
+    std::mutex mutex;
+    // curl multi handle for processing asynchronous requests
+    void* multi_handle{nullptr};
+    // map to record new asynchronous requests with pointer to easy handle
+    // or tag id as key
+    AsyncReqMap new_async_requests;
+
+    std::atomic<size_t> outstanding_requests{0};
+    std::atomic<size_t> active_handles{0};
+    std::atomic<size_t> max_active_handles{0};
+    std::atomic<size_t> completed_request_count{0};
+    std::atomic<uint64_t> cumulative_busy_time_ns{0};
+    std::atomic<uint64_t> poll_wakeups{0};
+  };
+
+  void AsyncTransfer(TransferShard& shard);
+
+  // Returns the shard with the least outstanding requests
+  TransferShard& LeastLoadedShard();
+
+  std::atomic<bool> exiting_{false};
 
-  std::thread worker_;
-  std::mutex mutex_;
+  std::vector<std::unique_ptr<TransferShard>> shards_;
+  // The shard that the search for the least loaded one starts from, so that
+  // ties are spread over the shards
+  std::atomic<size_t> next_shard_{0};
+
+  // The easy handles of the completed requests, ready to be reused
+  std::vector<CURL*> easy_handle_pool_;
+  std::mutex easy_handle_pool_mutex_;
 
   // The server url
   const std::string url_;
   // The options for authorizing and authenticating SSL/TLS connections
   HttpSslOptions ssl_options_;
 
-  using AsyncReqMap = std::map<uintptr_t, std::unique_ptr<HttpRequest>>;
-  // curl multi handle for processing asynchronous requests
-  void* multi_handle_;
-  // map to record new asynchronous requests with pointer to easy handle
-  // or tag id as key
-  AsyncReqMap new_async_requests_;
-
   bool verbose_;
 
+  // The CPUs that the transfer threads are pinned to
+  const CpuAffinity completion_cpus_;
+
  private:
   const std::string& ParseSslKeyType(HttpSslOptions::KEYTYPE key_type);
   const std::string& ParseSslCertType(HttpSslOptions::CERTTYPE cert_type);
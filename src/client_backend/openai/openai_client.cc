@@ -33,11 +33,13 @@
 #include <algorithm>
 #include <atomic>
 #include <cctype>
+#include <chrono>
 #include <climits>
 #include <cstdint>
 #include <deque>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "common.h"
@@ -61,20 +63,37 @@ namespace openai {
 //==============================================================================
 
 void
-ChatCompletionRequest::SendResponse(bool is_final, bool is_null)
+ChatCompletionRequest::SendResponse(
+    std::string&& response, bool is_final, bool is_null,
+    std::chrono::system_clock::time_point receive_time)
 {
   final_response_sent_ = is_final;
   response_callback_(new ChatCompletionResult(
-      http_code_, std::move(response_buffer_), is_final, is_null, request_id_));
+      http_code_, std::move(response), is_final, is_null, request_id_,
+      receive_time));
 }
 
 ChatCompletionClient::ChatCompletionClient(
     const std::string& url, const std::string& endpoint, bool verbose,
-    const HttpSslOptions& ssl_options)
-    : HttpClient(std::string(url + "/" + endpoint), verbose, ssl_options)
+    const HttpSslOptions& ssl_options, const CpuAffinity& completion_cpus,
+    size_t transfer_shards, size_t max_connections)
+    : HttpClient(
+          std::string(url + "/" + endpoint), verbose, ssl_options,
+          completion_cpus, transfer_shards, max_connections)
 {
 }
 
+ChatCompletionClient::~ChatCompletionClient()
+{
+  // The requests in flight use the header lists and the members updated by
+  // the completion callback
+  StopTransfers();
+
+  for (auto& header_list : header_lists_) {
+    curl_slist_free_all(header_list.second);
+  }
+}
+
 size_t
 ChatCompletionClient::RequestProvider(
     void* contents, size_t size, size_t nmemb, void* userp)
@@ -115,14 +134,6 @@ size_t
 ChatCompletionClient::ResponseHandler(
     void* contents, size_t size, size_t nmemb, void* userp)
 {
-  // [TODO TMA-1666] verify if the SSE responses received are complete, or the
-  // response need to be stitched first. To verify, print out the received
-  // responses from SendResponse() to make sure the OpenAI server doesn't chunk
-  // the HTTP responses in the way that misaligns with the SSE responses. Reason
-  // of not stitching responses now is that it is a bit complicated that to make
-  // the write callback bulletproof is to assume the response can be chunked at
-  // arbitrary position, then bake in checking for SSE style (data:.*\n\n) by
-  // iterating all received buffer character by character.
   size_t result_bytes = size * nmemb;
   // return early if the response is empty as the response handling is
   // triggered by the content of the response.
@@ -136,16 +147,25 @@ ChatCompletionClient::ResponseHandler(
     request->timer_.CaptureTimestamp(
         triton::client::RequestTimers::Kind::RECV_START);
   }
+  request->last_receive_time_ = std::chrono::system_clock::now();
 
   char* buf = reinterpret_cast<char*>(contents);
-  request->response_buffer_.append(buf, result_bytes);
-  // Send response now if streaming, otherwise wait until request has been
-  // completed
+  // Send a response for each complete event now if streaming, otherwise wait
+  // until request has been completed. All the events completed by this chunk
+  // share its receive time.
   if (request->is_stream_) {
-    auto done_signal =
-        (request->response_buffer_.find("data: [DONE]") != std::string::npos);
-    request->SendResponse(
-        done_signal /* is_final */, done_signal /* is_null */);
+    request->sse_framer_.Append(
+        std::string_view(buf, result_bytes),
+        [request](std::string&& event, bool is_done) {
+          if (request->IsFinalResponseSent()) {
+            return;
+          }
+          request->SendResponse(
+              std::move(event), is_done /* is_final */, is_done /* is_null */,
+              request->last_receive_time_);
+        });
+  } else {
+    request->response_buffer_.append(buf, result_bytes);
   }
 
   // ResponseHandler may be called multiple times so we overwrite
@@ -160,8 +180,8 @@ ChatCompletionClient::ResponseHandler(
 Error
 ChatCompletionClient::AsyncInfer(
     std::function<void(InferResult*)> callback,
-    std::string& serialized_request_body, const std::string& request_id,
-    const Headers& headers)
+    const std::vector<std::pair<const uint8_t*, size_t>>& request_body,
+    const std::string& request_id, const Headers& headers)
 {
   if (callback == nullptr) {
     return Error(
@@ -172,13 +192,23 @@ ChatCompletionClient::AsyncInfer(
     auto request = static_cast<ChatCompletionRequest*>(req);
     request->timer_.CaptureTimestamp(
         triton::client::RequestTimers::Kind::REQUEST_END);
-    UpdateInferStat(request->timer_);
+    UpdateInferStat(*request);
 
     // Send final response on request completion
     // if it has not already been sent.
     // (e.g. in the case of seeing [DONE] in streaming case)
     if (!request->IsFinalResponseSent()) {
-      request->SendResponse(true /* is_final */, false /* is_null */);
+      std::string response{
+          request->is_stream_ ? request->sse_framer_.TakeRemainder()
+                              : std::move(request->response_buffer_)};
+      const auto receive_time{
+          request->last_receive_time_ ==
+                  std::chrono::system_clock::time_point{}
+              ? std::chrono::system_clock::now()
+              : request->last_receive_time_};
+      request->SendResponse(
+          std::move(response), true /* is_final */, false /* is_null */,
+          receive_time);
     }
   };
   std::unique_ptr<HttpRequest> request(new ChatCompletionRequest(
@@ -187,11 +217,13 @@ ChatCompletionClient::AsyncInfer(
   auto raw_request = static_cast<ChatCompletionRequest*>(request.get());
   raw_request->timer_.CaptureTimestamp(
       triton::client::RequestTimers::Kind::REQUEST_START);
-  request->AddInput(
-      reinterpret_cast<uint8_t*>(serialized_request_body.data()),
-      serialized_request_body.size());
+  // The body is sent straight from the buffers of the input, the request only
+  // keeps its own list of them so that the input can be reset for the next one
+  for (const auto& [buf, byte_size] : request_body) {
+    request->AddInput(buf, byte_size);
+  }
 
-  CURL* multi_easy_handle = curl_easy_init();
+  CURL* multi_easy_handle = AcquireEasyHandle();
   Error err = PreRunProcessing(multi_easy_handle, raw_request, headers);
   if (!err.IsOk()) {
     curl_easy_cleanup(multi_easy_handle);
@@ -204,18 +236,13 @@ ChatCompletionClient::AsyncInfer(
   return Error::Success;
 }
 
-Error
-ChatCompletionClient::PreRunProcessing(
-    CURL* curl, ChatCompletionRequest* request, const Headers& headers)
+void
+ChatCompletionClient::SetupEasyHandle(CURL* curl)
 {
-  curl_easy_setopt(curl, CURLOPT_URL, url_.c_str());
+  HttpClient::SetupEasyHandle(curl);
+
   curl_easy_setopt(curl, CURLOPT_USERAGENT, "libcurl-agent/1.0");
   curl_easy_setopt(curl, CURLOPT_POST, 1L);
-  curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1L);
-
-  if (verbose_) {
-    curl_easy_setopt(curl, CURLOPT_VERBOSE, 1L);
-  }
 
   const long buffer_byte_size = 16 * 1024 * 1024;
   curl_easy_setopt(curl, CURLOPT_UPLOAD_BUFFERSIZE, buffer_byte_size);
@@ -223,20 +250,40 @@ ChatCompletionClient::PreRunProcessing(
 
   // request data provided by RequestProvider()
   curl_easy_setopt(curl, CURLOPT_READFUNCTION, RequestProvider);
-  curl_easy_setopt(curl, CURLOPT_READDATA, request);
 
   // response headers handled by ResponseHeaderHandler()
   curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, ResponseHeaderHandler);
-  curl_easy_setopt(curl, CURLOPT_HEADERDATA, request);
 
   // response data handled by ResponseHandler()
   curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, ResponseHandler);
+}
+
+Error
+ChatCompletionClient::PreRunProcessing(
+    CURL* curl, ChatCompletionRequest* request, const Headers& headers)
+{
+  curl_easy_setopt(curl, CURLOPT_READDATA, request);
+  curl_easy_setopt(curl, CURLOPT_HEADERDATA, request);
   curl_easy_setopt(curl, CURLOPT_WRITEDATA, request);
 
   const curl_off_t post_byte_size = request->total_input_byte_size_;
   curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, post_byte_size);
 
-  SetSSLCurlOptions(curl);
+  struct curl_slist* list = HeaderList(headers);
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
+  request->header_list_ = list;
+
+  return Error::Success;
+}
+
+struct curl_slist*
+ChatCompletionClient::HeaderList(const Headers& headers)
+{
+  std::lock_guard<std::mutex> lock(header_lists_mutex_);
+  auto itr = header_lists_.find(headers);
+  if (itr != header_lists_.end()) {
+    return itr->second;
+  }
 
   struct curl_slist* list = nullptr;
   list = curl_slist_append(list, "Expect:");
@@ -247,18 +294,14 @@ ChatCompletionClient::PreRunProcessing(
     list = curl_slist_append(list, hdr.c_str());
   }
 
-  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
-
-  // The list will be freed when the request is destructed
-  request->header_list_ = list;
-
-  return Error::Success;
+  header_lists_.emplace(headers, list);
+  return list;
 }
 
 Error
-ChatCompletionClient::UpdateInferStat(
-    const triton::client::RequestTimers& timer)
+ChatCompletionClient::UpdateInferStat(const ChatCompletionRequest& request)
 {
+  const triton::client::RequestTimers& timer = request.timer_;
   const uint64_t request_time_ns = timer.Duration(
       triton::client::RequestTimers::Kind::REQUEST_START,
       triton::client::RequestTimers::Kind::REQUEST_END);
@@ -306,10 +349,17 @@ ChatCompletionClient::UpdateInferStat(
              : ""));
   }
 
+  std::lock_guard<std::mutex> lock(infer_stat_mutex_);
   infer_stat_.completed_request_count++;
   infer_stat_.cumulative_total_request_time_ns += request_time_ns;
   infer_stat_.cumulative_send_time_ns += send_time_ns;
   infer_stat_.cumulative_receive_time_ns += recv_time_ns;
+  if (request.new_connection_) {
+    infer_stat_.new_connection_count++;
+    infer_stat_.cumulative_connect_time_ns += request.connect_time_ns_;
+  } else {
+    infer_stat_.reused_connection_count++;
+  }
 
   return Error::Success;
 }
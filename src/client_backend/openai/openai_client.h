@@ -25,12 +25,17 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "../client_backend.h"
 #include "common.h"
 #include "http_client.h"
+#include "sse_framer.h"
 
 
 namespace triton { namespace perfanalyzer { namespace clientbackend {
@@ -40,10 +45,12 @@ class ChatCompletionResult : public InferResult {
  public:
   ChatCompletionResult(
       uint32_t http_code, std::string&& serialized_response, bool is_final,
-      bool is_null, const std::string& request_id)
+      bool is_null, const std::string& request_id,
+      std::chrono::system_clock::time_point receive_time)
       : http_code_(http_code),
         serialized_response_(std::move(serialized_response)),
-        is_final_(is_final), is_null_(is_null), request_id_(request_id)
+        is_final_(is_final), is_null_(is_null), request_id_(request_id),
+        receive_time_(receive_time)
   {
   }
   virtual ~ChatCompletionResult() = default;
@@ -83,6 +90,16 @@ class ChatCompletionResult : public InferResult {
     return Error::Success;
   }
 
+  /// See InferResult::RawData()
+  Error RawData(
+      const std::string& output_name, const uint8_t** buf,
+      size_t* byte_size) const override
+  {
+    *buf = reinterpret_cast<const uint8_t*>(serialized_response_.data());
+    *byte_size = serialized_response_.size();
+    return Error::Success;
+  }
+
   /// Get final response bool for this response.
   /// \return Error object indicating the success or failure.
   Error IsFinalResponse(bool* is_final_response) const override
@@ -99,12 +116,23 @@ class ChatCompletionResult : public InferResult {
     return Error::Success;
   };
 
+  /// Returns when the bytes that completed this response were received.
+  /// \return Error object indicating the success or failure.
+  Error ResponseTimestamps(
+      std::vector<std::chrono::time_point<std::chrono::system_clock>>*
+          response_timestamps) const override
+  {
+    response_timestamps->assign(1, receive_time_);
+    return Error::Success;
+  };
+
  private:
   const uint32_t http_code_{200};
   const std::string serialized_response_;
   const bool is_final_{false};
   const bool is_null_{false};
   const std::string request_id_;
+  const std::chrono::system_clock::time_point receive_time_;
 };
 
 
@@ -121,8 +149,14 @@ class ChatCompletionRequest : public HttpRequest {
   {
   }
   bool IsFinalResponseSent() { return final_response_sent_; };
-  void SendResponse(bool is_final, bool is_null);
+  void SendResponse(
+      std::string&& response, bool is_final, bool is_null,
+      std::chrono::system_clock::time_point receive_time);
   bool is_stream_{false};
+  // Splits the streamed response into its events
+  SseFramer sse_framer_;
+  // When the last bytes of the response were received
+  std::chrono::system_clock::time_point last_receive_time_{};
   std::function<void(InferResult*)> response_callback_{nullptr};
   // The timers for infer request.
   triton::client::RequestTimers timer_;
@@ -132,7 +166,7 @@ class ChatCompletionRequest : public HttpRequest {
 
 class ChatCompletionClient : public HttpClient {
  public:
-  virtual ~ChatCompletionClient() = default;
+  virtual ~ChatCompletionClient();
 
   /// Create a client that can be used to communicate with the server.
   /// \param server_url The inference server name, port, optional
@@ -147,26 +181,45 @@ class ChatCompletionClient : public HttpClient {
   /// The use of SSL/TLS depends entirely on the server endpoint.
   /// These options will be ignored if the server_url does not
   /// expose `https://` scheme.
+  /// \param completion_cpus The CPUs that the transfer threads are pinned to.
+  /// \param transfer_shards The number of threads transferring the requests,
+  /// each with its own curl multi handle.
+  /// \param max_connections The maximum number of connections each transfer
+  /// thread keeps open to the server, 0 for no limit.
   ChatCompletionClient(
       const std::string& server_url, const std::string& endpoint,
       bool verbose = false,
-      const HttpSslOptions& ssl_options = HttpSslOptions());
+      const HttpSslOptions& ssl_options = HttpSslOptions(),
+      const CpuAffinity& completion_cpus = CpuAffinity(),
+      size_t transfer_shards = 1, size_t max_connections = 0);
 
   /// Simplified AsyncInfer() where the request body is expected to be
   /// prepared by the caller, the client here is responsible to communicate
   /// with a OpenAI-compatible server in both streaming and non-streaming case.
+  /// The request body is the concatenation of the given buffers, which are
+  /// read in place and must stay valid until the callback of the request.
   Error AsyncInfer(
       std::function<void(InferResult*)> callback,
-      std::string& serialized_request_body, const std::string& request_id,
-      const Headers& headers);
+      const std::vector<std::pair<const uint8_t*, size_t>>& request_body,
+      const std::string& request_id, const Headers& headers);
 
-  const InferStat& ClientInferStat() { return infer_stat_; }
+  InferStat ClientInferStat()
+  {
+    std::lock_guard<std::mutex> lock(infer_stat_mutex_);
+    return infer_stat_;
+  }
 
  private:
-  // setup curl handle
+  // Sets the options shared by all the requests on a new curl handle
+  void SetupEasyHandle(CURL* curl) override;
+
+  // Sets the options of the request on a curl handle from the pool
   Error PreRunProcessing(
       CURL* curl, ChatCompletionRequest* request, const Headers& headers);
 
+  // Returns the cached list of the HTTP request headers for 'headers'
+  struct curl_slist* HeaderList(const Headers& headers);
+
   static size_t ResponseHandler(
       void* contents, size_t size, size_t nmemb, void* userp);
   static size_t RequestProvider(
@@ -174,8 +227,15 @@ class ChatCompletionClient : public HttpClient {
   static size_t ResponseHeaderHandler(
       void* contents, size_t size, size_t nmemb, void* userp);
 
-  Error UpdateInferStat(const triton::client::RequestTimers& timer);
+  Error UpdateInferStat(const ChatCompletionRequest& request);
   InferStat infer_stat_;
+  // Guards infer_stat_, which the transfer shards update concurrently
+  std::mutex infer_stat_mutex_;
+
+  // The lists of the HTTP request headers built so far, shared by the
+  // requests until the client is destroyed
+  std::map<Headers, struct curl_slist*> header_lists_;
+  std::mutex header_lists_mutex_;
 };
 
 }}}}  // namespace triton::perfanalyzer::clientbackend::openai
@@ -37,7 +37,9 @@ Error
 OpenAiClientBackend::Create(
     const std::string& url, const std::string& endpoint,
     const ProtocolType protocol, std::shared_ptr<Headers> http_headers,
-    const bool verbose, std::unique_ptr<ClientBackend>* client_backend)
+    const bool verbose, const CpuAffinity& completion_cpus,
+    const size_t transfer_shards, const size_t max_connections,
+    std::unique_ptr<ClientBackend>* client_backend)
 {
   if (protocol == ProtocolType::GRPC) {
     return Error(
@@ -47,7 +49,9 @@ OpenAiClientBackend::Create(
       new OpenAiClientBackend(http_headers));
 
   openai_client_backend->http_client_.reset(
-      new ChatCompletionClient(url, endpoint, verbose));
+      new ChatCompletionClient(
+          url, endpoint, verbose, HttpSslOptions(), completion_cpus,
+          transfer_shards, max_connections));
 
   *client_backend = std::move(openai_client_backend);
 
@@ -65,7 +69,6 @@ OpenAiClientBackend::AsyncInfer(
   }
 
   auto raw_input = dynamic_cast<OpenAiInferInput*>(inputs[0]);
-  raw_input->PrepareForRequest();
   RETURN_IF_CB_ERROR(http_client_->AsyncInfer(
       callback, raw_input->GetRequestBody(), options.request_id_,
       *http_headers_));
@@ -61,13 +61,19 @@ class OpenAiClientBackend : public ClientBackend {
   /// \param http_headers Map of HTTP headers. The map key/value indicates
   /// the header name/value.
   /// \param verbose Enables the verbose mode.
+  /// \param completion_cpus The CPUs that the transfer threads are pinned to.
+  /// \param transfer_shards The number of threads transferring the requests.
+  /// \param max_connections The maximum number of connections each transfer
+  /// thread keeps open to the server, 0 for no limit.
   /// \param client_backend Returns a new OpenAiClientBackend
   /// object.
   /// \return Error object indicating success or failure.
   static Error Create(
       const std::string& url, const std::string& endpoint,
       const ProtocolType protocol, std::shared_ptr<Headers> http_headers,
-      const bool verbose, std::unique_ptr<ClientBackend>* client_backend);
+      const bool verbose, const CpuAffinity& completion_cpus,
+      const size_t transfer_shards, const size_t max_connections,
+      std::unique_ptr<ClientBackend>* client_backend);
 
   /// See ClientBackend::AsyncInfer()
   Error AsyncInfer(
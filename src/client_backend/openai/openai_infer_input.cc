@@ -51,10 +51,7 @@ OpenAiInferInput::SetShape(const std::vector<int64_t>& shape)
 Error
 OpenAiInferInput::Reset()
 {
-  data_str_.clear();
-
   bufs_.clear();
-  buf_byte_sizes_.clear();
   byte_size_ = 0;
   return Error::Success;
 }
@@ -62,12 +59,9 @@ OpenAiInferInput::Reset()
 Error
 OpenAiInferInput::AppendRaw(const uint8_t* input, size_t input_byte_size)
 {
-  data_str_.clear();
-
   byte_size_ += input_byte_size;
 
-  bufs_.push_back(input);
-  buf_byte_sizes_.push_back(input_byte_size);
+  bufs_.emplace_back(input, input_byte_size);
   return Error::Success;
 }
 
@@ -75,21 +69,8 @@ Error
 OpenAiInferInput::RawData(const uint8_t** buf, size_t* byte_size)
 {
   // TMA-1775 - handle multi-batch case
-  *buf = bufs_[0];
-  *byte_size = buf_byte_sizes_[0];
-  return Error::Success;
-}
-
-Error
-OpenAiInferInput::PrepareForRequest()
-{
-  // Reset position so request sends entire input.
-  if (data_str_.empty() && (byte_size_ != 0)) {
-    for (size_t i = 0; i < bufs_.size(); ++i) {
-      data_str_.append(
-          reinterpret_cast<const char*>(bufs_[i]), buf_byte_sizes_[i]);
-    }
-  }
+  *buf = bufs_[0].first;
+  *byte_size = bufs_[0].second;
   return Error::Success;
 }
 
@@ -26,6 +26,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../../perf_utils.h"
 #include "../client_backend.h"
@@ -53,11 +55,12 @@ class OpenAiInferInput : public InferInput {
   Error AppendRaw(const uint8_t* input, size_t input_byte_size) override;
   /// See InferInput::RawData()
   Error RawData(const uint8_t** buf, size_t* byte_size) override;
-  /// Prepare the input to be in the form expected by an OpenAI client,
-  /// must call before accessing the data.
-  Error PrepareForRequest();
-  /// Get the contiguous request body string
-  std::string& GetRequestBody() { return data_str_; }
+  /// Get the buffers that make up the request body, in order. The buffers are
+  /// the ones appended to the input, they are not copied.
+  const std::vector<std::pair<const uint8_t*, size_t>>& GetRequestBody() const
+  {
+    return bufs_;
+  }
 
  private:
   explicit OpenAiInferInput(
@@ -67,9 +70,7 @@ class OpenAiInferInput : public InferInput {
   std::vector<int64_t> shape_;
   size_t byte_size_{0};
 
-  std::vector<const uint8_t*> bufs_;
-  std::vector<size_t> buf_byte_sizes_;
-  std::string data_str_;
+  std::vector<std::pair<const uint8_t*, size_t>> bufs_;
 };
 
 }}}}  // namespace triton::perfanalyzer::clientbackend::openai
@@ -0,0 +1,119 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "sse_framer.h"
+
+namespace triton { namespace perfanalyzer { namespace clientbackend {
+namespace openai {
+
+namespace {
+
+// Returns whether the event has a data field, and sets 'is_done' if one of
+// its data fields is [DONE]
+bool
+ParseEventData(std::string_view event, bool* is_done)
+{
+  constexpr std::string_view data_field{"data:"};
+  bool has_data{false};
+  *is_done = false;
+  while (!event.empty()) {
+    const size_t line_end{event.find_first_of("\r\n")};
+    std::string_view line{event.substr(0, line_end)};
+    event.remove_prefix(
+        line_end == std::string_view::npos ? event.size() : line_end + 1);
+    if (line.substr(0, data_field.size()) != data_field) {
+      continue;
+    }
+    line.remove_prefix(data_field.size());
+    if (!line.empty() && line.front() == ' ') {
+      line.remove_prefix(1);
+    }
+    has_data = true;
+    *is_done |= (line == "[DONE]");
+  }
+  return has_data;
+}
+
+}  // namespace
+
+void
+SseFramer::Append(std::string_view bytes, const EventCallback& on_event)
+{
+  size_t scanned{buffer_.size()};
+  buffer_.append(bytes);
+
+  // The start of the event being scanned in buffer_
+  size_t event_start{0};
+  for (; scanned < buffer_.size(); scanned++) {
+    const char c{buffer_[scanned]};
+    if (c == '\n' && after_cr_) {
+      // The second half of a CRLF, which may be left over from the event
+      // sent before
+      after_cr_ = false;
+      if (event_start == scanned) {
+        event_start++;
+      }
+      continue;
+    }
+    after_cr_ = (c == '\r');
+    if (c != '\n' && c != '\r') {
+      at_line_start_ = false;
+      continue;
+    }
+    if (!at_line_start_) {
+      at_line_start_ = true;
+      continue;
+    }
+
+    // An empty line ends the event
+    size_t event_end{scanned + 1};
+    if (after_cr_ && event_end < buffer_.size() && buffer_[event_end] == '\n') {
+      after_cr_ = false;
+      event_end++;
+      scanned++;
+    }
+    const std::string_view event{
+        std::string_view(buffer_).substr(event_start, event_end - event_start)};
+    bool is_done{false};
+    if (ParseEventData(event, &is_done)) {
+      on_event(std::string(event), is_done);
+    }
+    event_start = event_end;
+  }
+  buffer_.erase(0, event_start);
+}
+
+std::string
+SseFramer::TakeRemainder()
+{
+  std::string remainder{std::move(buffer_)};
+  buffer_.clear();
+  at_line_start_ = true;
+  after_cr_ = false;
+  return remainder;
+}
+
+}}}}  // namespace triton::perfanalyzer::clientbackend::openai
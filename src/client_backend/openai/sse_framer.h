@@ -0,0 +1,63 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace triton { namespace perfanalyzer { namespace clientbackend {
+namespace openai {
+
+// Splits a stream of server-sent events into its events as the bytes arrive.
+// The events may be split across the received chunks, or several of them may
+// be packed into one chunk. Each received byte is scanned once.
+class SseFramer {
+ public:
+  using EventCallback = std::function<void(std::string&& event, bool is_done)>;
+
+  // Appends the received bytes and calls 'on_event' with each event that
+  // they complete. The event is passed as its raw text, including the blank
+  // line that ends it, and 'is_done' tells whether its data is [DONE]. Events
+  // without data, such as the comments used as keep-alives, are dropped.
+  void Append(std::string_view bytes, const EventCallback& on_event);
+
+  // Returns the bytes of the incomplete event at the end of the stream, and
+  // clears them.
+  std::string TakeRemainder();
+
+ private:
+  // The bytes of the event being received
+  std::string buffer_;
+  // Whether the last scanned byte ended a line, so that a line terminator
+  // next ends the event
+  bool at_line_start_{true};
+  // Whether the last scanned byte was a carriage return, so that a line feed
+  // next belongs to the same line terminator
+  bool after_cr_{false};
+};
+
+}}}}  // namespace triton::perfanalyzer::clientbackend::openai
@@ -38,6 +38,7 @@ TFServeClientBackend::Create(
     const std::string& url, const ProtocolType protocol,
     const grpc_compression_algorithm compression_algorithm,
     std::shared_ptr<Headers> http_headers, const bool verbose,
+    const CpuAffinity& completion_cpus,
     std::unique_ptr<ClientBackend>* client_backend)
 {
   if (protocol == ProtocolType::HTTP) {
@@ -48,7 +49,8 @@ TFServeClientBackend::Create(
       new TFServeClientBackend(compression_algorithm, http_headers));
 
   RETURN_IF_CB_ERROR(GrpcClient::Create(
-      &(tfserve_client_backend->grpc_client_), url, verbose));
+      &(tfserve_client_backend->grpc_client_), url, verbose, false,
+      SslOptions(), completion_cpus));
 
   *client_backend = std::move(tfserve_client_backend);
 
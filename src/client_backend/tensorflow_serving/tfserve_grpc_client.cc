@@ -32,6 +32,7 @@
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <system_error>
 
 #include "tfserve_client_backend.h"
 
@@ -163,9 +164,11 @@ class GrpcInferRequest {
 Error
 GrpcClient::Create(
     std::unique_ptr<GrpcClient>* client, const std::string& server_url,
-    bool verbose, bool use_ssl, const SslOptions& ssl_options)
+    bool verbose, bool use_ssl, const SslOptions& ssl_options,
+    const CpuAffinity& completion_cpus)
 {
-  client->reset(new GrpcClient(server_url, verbose, use_ssl, ssl_options));
+  client->reset(new GrpcClient(
+      server_url, verbose, use_ssl, ssl_options, completion_cpus));
   return Error::Success;
 }
 
@@ -321,6 +324,13 @@ GrpcClient::AsyncInfer(
 void
 GrpcClient::AsyncTransfer()
 {
+  try {
+    completion_cpus_.PinCurrentThread();
+  }
+  catch (const std::system_error& e) {
+    std::cerr << "WARNING: " << e.what() << std::endl;
+  }
+
   while (!exiting_) {
     // GRPC async APIs are thread-safe https://github.com/grpc/grpc/issues/4486
     GrpcInferRequest* raw_async_request;
@@ -667,10 +677,11 @@ GrpcClient::PopulateUint64Val(tensorflow::TensorProto* input_tensor_proto)
 
 GrpcClient::GrpcClient(
     const std::string& url, bool verbose, bool use_ssl,
-    const SslOptions& ssl_options)
+    const SslOptions& ssl_options, const CpuAffinity& completion_cpus)
     : InferenceServerClient(verbose),
       stub_(tensorflow::serving::PredictionService::NewStub(
-          GetChannel(url, use_ssl, ssl_options)))
+          GetChannel(url, use_ssl, ssl_options))),
+      completion_cpus_(completion_cpus)
 {
 }
 
@@ -83,11 +83,13 @@ class GrpcClient : public tc::InferenceServerClient {
   /// \param use_ssl If true use encrypted channel to the server.
   /// \param ssl_options Specifies the files required for
   /// SSL encryption and authorization.
+  /// \param completion_cpus The CPUs that the completion thread is pinned to.
   /// \return Error object indicating success or failure.
   static Error Create(
       std::unique_ptr<GrpcClient>* client, const std::string& server_url,
       bool verbose = false, bool use_ssl = false,
-      const SslOptions& ssl_options = SslOptions());
+      const SslOptions& ssl_options = SslOptions(),
+      const CpuAffinity& completion_cpus = CpuAffinity());
 
   /// Contact the inference server and get the metadata of specified model.
   /// \param model_metadata Returns model metadata as ModelMetadataResponse
@@ -157,7 +159,7 @@ class GrpcClient : public tc::InferenceServerClient {
  private:
   GrpcClient(
       const std::string& url, bool verbose, bool use_ssl,
-      const SslOptions& ssl_options);
+      const SslOptions& ssl_options, const CpuAffinity& completion_cpus);
   Error PreRunProcessing(
       const InferOptions& options, const std::vector<InferInput*>& inputs,
       const std::vector<const InferRequestedOutput*>& outputs);
@@ -190,6 +192,8 @@ class GrpcClient : public tc::InferenceServerClient {
   tensorflow::serving::PredictRequest infer_request_;
   // A temporary buffer to hold serialized data
   std::string temp_buffer_;
+  // The CPUs that the completion thread is pinned to
+  const CpuAffinity completion_cpus_;
 };
 
 //======================================================================
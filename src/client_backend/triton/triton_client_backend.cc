@@ -845,6 +845,15 @@ TritonInferResult::RawData(
   return Error::Success;
 }
 
+Error
+TritonInferResult::RawData(
+    const std::string& output_name, const uint8_t** buf,
+    size_t* byte_size) const
+{
+  RETURN_IF_TRITON_ERROR(result_->RawData(output_name, buf, byte_size));
+  return Error::Success;
+}
+
 Error
 TritonInferResult::IsFinalResponse(bool* is_final_response) const
 {
@@ -338,6 +338,10 @@ class TritonInferResult : public InferResult {
   /// See InferResult::RawData()
   Error RawData(
       const std::string& output_name, std::vector<uint8_t>& buf) const override;
+  /// See InferResult::RawData()
+  Error RawData(
+      const std::string& output_name, const uint8_t** buf,
+      size_t* byte_size) const override;
   /// See InferResult::IsFinalResponse()
   Error IsFinalResponse(bool* is_final_response) const override;
   /// See InferResult::IsNullResponse()
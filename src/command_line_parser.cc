@@ -32,10 +32,13 @@
 #include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <string>
+#include <tuple>
 
 #include "data_loader.h"
 #include "inference_load_mode.h"
+#include "load_curve.h"
 #include "perf_analyzer_exception.h"
 
 namespace triton { namespace perfanalyzer {
@@ -49,23 +52,6 @@ CLParser::Parse(int argc, char** argv)
   return params_;
 }
 
-std::vector<std::string>
-SplitString(const std::string& str, const std::string& delimiter = ":")
-{
-  std::vector<std::string> substrs;
-  size_t pos = 0;
-  while (pos != std::string::npos) {
-    size_t colon_pos = str.find(delimiter, pos);
-    substrs.push_back(str.substr(pos, colon_pos - pos));
-    if (colon_pos == std::string::npos) {
-      pos = colon_pos;
-    } else {
-      pos = colon_pos + 1;
-    }
-  }
-  return substrs;
-}
-
 void
 ToLowerCase(std::string& s)
 {
@@ -113,22 +99,39 @@ CLParser::Usage(const std::string& msg)
   std::cerr << "\t--measurement-interval (-p) <measurement window (in msec)>"
             << std::endl;
   std::cerr << "\t--concurrency-range <start:end:step>" << std::endl;
+  std::cerr << "\t--concurrency-engine <threaded|event-loop>" << std::endl;
   std::cerr << "\t--periodic-concurrency-range <start:end:step>" << std::endl;
   std::cerr << "\t--session-concurrency <session concurrency>" << std::endl;
   std::cerr << "\t--request-period <number of responses>" << std::endl;
   std::cerr << "\t--request-rate-range <start:end:step>" << std::endl;
-  std::cerr << "\t--request-distribution <\"poisson\"|\"constant\">"
+  std::cerr << "\t--request-rate-curve <linear|sine>:<key=value>,..."
+            << std::endl;
+  std::cerr << "\t--request-distribution "
+               "<\"poisson\"|\"constant\"|\"gamma\"|\"mmpp\"|\"lognormal\"|"
+               "\"pareto\">[:<key=value>,...]"
             << std::endl;
+  std::cerr << "\t--request-pacing <sleep|hybrid|deadline|batched>"
+            << std::endl;
+  std::cerr << "\t--request-pacing-slack <microseconds>" << std::endl;
+  std::cerr << "\t--request-dispatch <worker|timing-wheel>" << std::endl;
   std::cerr << "\t--request-intervals <path to file containing time intervals "
                "in microseconds>"
             << std::endl;
   std::cerr << "\t--serial-sequences" << std::endl;
   std::cerr << "\t--binary-search" << std::endl;
+  std::cerr << "\t--goodput-slo p<percentile>=<milliseconds>"
+               "[,error-rate=<fraction>]"
+            << std::endl;
   std::cerr << "\t--num-of-sequences <number of concurrent sequences>"
             << std::endl;
   std::cerr << "\t--latency-threshold (-l) <latency threshold (in msec)>"
             << std::endl;
   std::cerr << "\t--max-threads <thread counts>" << std::endl;
+  std::cerr << "\t--worker-cpus <cpu list>" << std::endl;
+  std::cerr << "\t--completion-cpus <cpu list>" << std::endl;
+  std::cerr << "\t--transfer-shards <number of threads>" << std::endl;
+  std::cerr << "\t--max-connections <number of connections>" << std::endl;
+  std::cerr << "\t--profiler-cpus <cpu list>" << std::endl;
   std::cerr << "\t--stability-percentage (-s) <deviation threshold for stable "
                "measurement (in percentage)>"
             << std::endl;
@@ -136,6 +139,8 @@ CLParser::Usage(const std::string& msg)
                "profiling>"
             << std::endl;
   std::cerr << "\t--percentile <percentile>" << std::endl;
+  std::cerr << "\t--latency-histogram-precision <significant digits>"
+            << std::endl;
   std::cerr << "\t--request-count <number of requests>" << std::endl;
   std::cerr << "\t--warmup-request-count <number of warmup requests>"
             << std::endl;
@@ -147,6 +152,7 @@ CLParser::Usage(const std::string& msg)
   std::cerr << "II. INPUT DATA OPTIONS: " << std::endl;
   std::cerr << "\t-b <batch size>" << std::endl;
   std::cerr << "\t--input-data <\"zero\"|\"random\"|<path>>" << std::endl;
+  std::cerr << "\t--convert-input-data <path>" << std::endl;
   std::cerr << "\t--shared-memory <\"system\"|\"cuda\"|\"none\">" << std::endl;
   std::cerr << "\t--output-shared-memory-size <size in bytes>" << std::endl;
   std::cerr << "\t--shape <name:shape>" << std::endl;
@@ -181,6 +187,8 @@ CLParser::Usage(const std::string& msg)
   std::cerr << "\t-f <filename for storing report in csv format>" << std::endl;
   std::cerr << "\t--profile-export-file <path>" << std::endl;
   std::cerr << "\t--simple " << std::endl;
+  std::cerr << "\t--output-capture <none|hash|sampled|full>" << std::endl;
+  std::cerr << "\t--output-capture-sample-rate <N>" << std::endl;
   std::cerr << "\t-H <HTTP header>" << std::endl;
   std::cerr << "\t--streaming" << std::endl;
   std::cerr << "\t--grpc-compression-algorithm <compression_algorithm>"
@@ -318,6 +326,20 @@ CLParser::Usage(const std::string& msg)
              "not be 0 for sequence models while using asynchronous mode.",
              18)
       << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --concurrency-engine [threaded|event-loop]: Specifies how the "
+             "workers keep their concurrency of requests in flight. "
+             "'threaded' wakes up the worker thread after every completed "
+             "request to send the next one. 'event-loop' sends the next "
+             "request right away from the completion callback, so that a few "
+             "threads can sustain thousands of requests in flight, and "
+             "--max-threads is no longer raised to the 'end' of "
+             "--concurrency-range. It only applies to the asynchronous API. "
+             "This option is ignored if not using --concurrency-range. By "
+             "default, this option is set to be threaded.",
+             18)
+      << std::endl;
   std::cerr
       << FormatMessage(
              " --periodic-concurrency-range <start:end:step>: Determines the "
@@ -344,8 +366,9 @@ CLParser::Usage(const std::string& msg)
              "concurrency inference load mode and specifies the number of "
              "concurrent multi-turn chat sessions to run during the benchmark. "
              "A dataset must be provided using --input-data with at least as "
-             "many unique sessions as the specified session concurrency. Only "
-             "supported with --service-kind=openai.",
+             "many unique sessions as the specified session concurrency. The "
+             "sessions share the --max-threads threads instead of needing a "
+             "thread each. Only supported with --service-kind=openai.",
              18)
       << std::endl;
   std::cerr
@@ -386,14 +409,77 @@ CLParser::Usage(const std::string& msg)
       << std::endl;
   std::cerr
       << FormatMessage(
-             " --request-distribution [constant|poisson]: Specifies the time "
-             "interval distribution between dispatching inference "
+             " --request-distribution "
+             "[constant|poisson|gamma|mmpp|lognormal|pareto]: Specifies the "
+             "time interval distribution between dispatching inference "
              "requests to the server. Poisson distribution closely mimics the "
-             "real-world work load on a server. This option is ignored if not "
-             "using --request-rate-range. By default, this option is set to be "
+             "real-world work load on a server. The other distributions model "
+             "bursty and heavy-tailed traffic and take shape parameters after "
+             "a colon, e.g. 'gamma:cv=2'. 'gamma' and 'lognormal' take the "
+             "coefficient of variation of the intervals 'cv' (default 1). "
+             "'pareto' takes the tail index 'alpha' (> 1, default 2.5). 'mmpp' "
+             "alternates between bursts and idle periods and takes the burst "
+             "to idle rate 'ratio' (default 10), the fraction of time in "
+             "bursts 'fraction' (default 0.1) and the mean burst length "
+             "'burst_ms' (default 50). The mean interval always follows the "
+             "request rate. This option is ignored if not using "
+             "--request-rate-range. By default, this option is set to be "
              "constant.",
              18)
       << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --request-pacing [sleep|hybrid|deadline|batched]: Specifies how "
+             "the request rate workers wait for the scheduled time of each "
+             "request. 'sleep' sleeps for the remaining time. 'hybrid' sleeps "
+             "until the pacing slack before the scheduled time and spins for "
+             "the rest. 'deadline' sleeps until the absolute scheduled time. "
+             "'batched' wakes up once for all the requests scheduled within "
+             "the pacing slack and sends them back to back. This option is "
+             "ignored if not using --request-rate-range or "
+             "--request-intervals. By default, this option is set to be "
+             "sleep.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --request-pacing-slack: The spin time of the 'hybrid' and the "
+             "release window of the 'batched' request pacing, in "
+             "microseconds. The default is 100.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --request-dispatch [worker|timing-wheel]: Specifies what sends "
+             "the requests of the request rate workers at their scheduled "
+             "time. 'worker' makes every worker wait for the requests of its "
+             "own schedule. 'timing-wheel' makes one thread release the "
+             "requests of all the schedules from a timing wheel onto a queue "
+             "that any worker with a free context takes them from, so that "
+             "the request rate holds up to the combined capacity of the "
+             "workers. The dispatch thread waits according to "
+             "--request-pacing. This option is ignored if not using "
+             "--request-rate-range, --request-rate-curve or "
+             "--request-intervals. By default, this option is set to be "
+             "worker.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --request-rate-curve: Makes the request rate follow a curve "
+             "over time in a single run, instead of sweeping fixed request "
+             "rates. 'linear:<seconds>=<rate>,...' goes in straight lines "
+             "between the given points, where two points at the same time make "
+             "a step. 'sine:base=<rate>,amplitude=<rate>,period=<seconds>,"
+             "duration=<seconds>' oscillates around the base rate. The run "
+             "sends the number of requests the curve adds up to, unless "
+             "--request-count is given, and the profile export includes the "
+             "throughput and latency of every second of the curve. "
+             "--request-distribution sets the shape of the arrivals along the "
+             "curve. This option can not be used with --request-rate-range, "
+             "--request-intervals or --concurrency-range.",
+             18)
+      << std::endl;
   std::cerr
       << FormatMessage(
              " --request-intervals: Specifies a path to a file containing time "
@@ -418,6 +504,23 @@ CLParser::Usage(const std::string& msg)
              "By default, linear search is used.",
              18)
       << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --goodput-slo: Searches the --concurrency-range or "
+             "--request-rate-range for the highest load that meets the given "
+             "service level objective, instead of measuring every load of the "
+             "range until it is stable. 'p<percentile>=<milliseconds>' is the "
+             "limit on a latency percentile, and 'error-rate=<fraction>' the "
+             "largest fraction of the requests of a measurement that may be "
+             "left without a response. The search probes loads growing from "
+             "'start' with short measurements until the SLO is violated, "
+             "narrows the knee down to 'step' with full measurements and "
+             "reports the highest load meeting the SLO with a confidence "
+             "interval. That load is then profiled as usual. 'end' may be 0 "
+             "for no limit. This option can not be used with "
+             "--binary-search.",
+             18)
+      << std::endl;
 
   std::cerr << FormatMessage(
                    " --num-of-sequences: Sets the number of concurrent "
@@ -447,6 +550,48 @@ CLParser::Usage(const std::string& msg)
              "is specified otherwise default is 16.",
              18)
       << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --worker-cpus <cpu list>: Pins the threads that send the "
+             "requests to the given CPUs, e.g. '0-7,16' or 'node:0' for all "
+             "CPUs of NUMA node 0. Each thread pins itself before it "
+             "allocates its buffers, so that they are placed on the memory of "
+             "those CPUs. By default, the threads are not pinned.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --completion-cpus <cpu list>: Pins the threads of the OpenAI "
+             "and TensorFlow Serving clients that receive the responses to "
+             "the given CPUs, in the same format as --worker-cpus. By "
+             "default, they run on the CPUs of the worker that created them.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --transfer-shards <n>: Sets the number of threads that transfer "
+             "the requests of each OpenAI client, each with its own curl multi "
+             "handle. A new request goes to the thread with the least "
+             "outstanding requests. Raise it when a single thread cannot keep "
+             "up with thousands of concurrent streams. Default is 1.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --max-connections <n>: Sets the maximum number of connections "
+             "that each --transfer-shards thread keeps open to the server. "
+             "Requests wait for a free connection once it is reached, and the "
+             "idle connections are kept for reuse rather than closed. By "
+             "default, the number of connections is not limited.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --profiler-cpus <cpu list>: Pins the thread that collects and "
+             "reports the measurements to the given CPUs, in the same format "
+             "as --worker-cpus. By default, the thread is not pinned.",
+             18)
+      << std::endl;
   std::cerr
       << FormatMessage(
              " --stability-percentage (-s): Indicates the allowed variation in "
@@ -477,6 +622,14 @@ CLParser::Usage(const std::string& msg)
              "that the average latency is used to determine stability",
              18)
       << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --latency-histogram-precision: The number of significant "
+             "decimal digits the latency histograms resolve latencies to, "
+             "from 1 to 5. Reported percentiles are within a relative error "
+             "of 10^-N of the measured latency. The default is 3.",
+             18)
+      << std::endl;
   std::cerr
       << FormatMessage(
              " --request-count: Specifies a total number of requests to "
@@ -524,7 +677,18 @@ CLParser::Usage(const std::string& msg)
              "can also be provided (--input-data json_file1 --input-data "
              "json-file2 and so on) and the analyzer will append data streams "
              "from each file. When using --service-kind=torchserve make sure "
-             "this option points to a json file. Default is \"random\".",
+             "this option points to a json file. With --service-kind=openai, "
+             "the option can also point to a binary trace written by "
+             "--convert-input-data. Default is \"random\".",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --convert-input-data <path>: Converts the input data json "
+             "passed to --input-data to a binary trace at the given path and "
+             "exits. Only supported with --service-kind=openai. A binary "
+             "trace is read in place instead of being parsed, so large "
+             "datasets load in a fraction of the time.",
              18)
       << std::endl;
   std::cerr << FormatMessage(
@@ -729,6 +893,22 @@ CLParser::Usage(const std::string& msg)
              "timestamps.",
              18)
       << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --output-capture: Specifies how the response outputs are "
+             "recorded in the profile export. 'none' does not record them, "
+             "'hash' records a 64-bit hash and the size of each output, "
+             "'sampled' records the outputs of a random one in every N "
+             "requests in full, and 'full' records every output. Default is "
+             "'full'.",
+             18)
+      << std::endl;
+  std::cerr
+      << FormatMessage(
+             " --output-capture-sample-rate: The N of '--output-capture "
+             "sampled'. Default is 1.",
+             18)
+      << std::endl;
   std::cerr
       << std::setw(9) << std::left << " -H: "
       << FormatMessage(
@@ -949,6 +1129,31 @@ CLParser::ParseCommandLine(int argc, char** argv)
       {"session-concurrency", required_argument, 0, long_option_idx_base + 65},
       {"grpc-method", required_argument, 0, long_option_idx_base + 66},
       {"simple", no_argument, 0, long_option_idx_base + 67},
+      {"output-capture", required_argument, 0, long_option_idx_base + 68},
+      {"output-capture-sample-rate", required_argument, 0,
+       long_option_idx_base + 69},
+      {"latency-histogram-precision", required_argument, 0,
+       long_option_idx_base + 70},
+      {"request-pacing", required_argument, 0, long_option_idx_base + 71},
+      {"request-pacing-slack", required_argument, 0,
+       long_option_idx_base + 72},
+      {"request-rate-curve", required_argument, 0, long_option_idx_base + 73},
+      {"request-dispatch", required_argument, 0, long_option_idx_base + 74},
+      {"goodput-slo", required_argument, 0, long_option_idx_base + 75},
+      {"concurrency-engine", required_argument, 0, long_option_idx_base + 76},
+      {"worker-cpus", required_argument, 0, long_option_idx_base + 77},
+      {"completion-cpus", required_argument, 0, long_option_idx_base + 78},
+      {"profiler-cpus", required_argument, 0, long_option_idx_base + 79},
+      {"fixed-schedule-trace", required_argument, 0, long_option_idx_base + 80},
+      {"fixed-schedule-time-unit", required_argument, 0,
+       long_option_idx_base + 81},
+      {"fixed-schedule-speedup", required_argument, 0,
+       long_option_idx_base + 82},
+      {"fixed-schedule-window", required_argument, 0,
+       long_option_idx_base + 83},
+      {"convert-input-data", required_argument, 0, long_option_idx_base + 84},
+      {"transfer-shards", required_argument, 0, long_option_idx_base + 85},
+      {"max-connections", required_argument, 0, long_option_idx_base + 86},
       {0, 0, 0, 0}};
 
   // Parse commandline...
@@ -1185,21 +1390,14 @@ CLParser::ParseCommandLine(int argc, char** argv)
           break;
         }
         case long_option_idx_base + 18: {
+          if (params_->search_mode == SearchMode::GOODPUT) {
+            Usage("Cannot use both --binary-search and --goodput-slo.");
+          }
           params_->search_mode = SearchMode::BINARY;
           break;
         }
         case long_option_idx_base + 19: {
-          std::string arg = optarg;
-          if (arg.compare("poisson") == 0) {
-            params_->request_distribution = Distribution::POISSON;
-          } else if (arg.compare("constant") == 0) {
-            params_->request_distribution = Distribution::CONSTANT;
-          } else {
-            Usage(
-                "Failed to parse --request-distribution. Unsupported type "
-                "provided: '" +
-                std::string(optarg) + "'. Choices are 'posson' or 'constant'.");
-          }
+          ParseRequestDistribution(optarg);
           break;
         }
         case long_option_idx_base + 20: {
@@ -1772,6 +1970,231 @@ CLParser::ParseCommandLine(int argc, char** argv)
           params_->simple = true;
           break;
         }
+        case long_option_idx_base + 68: {
+          std::string arg{optarg};
+          if (arg == "none") {
+            params_->output_capture.policy = OutputCapturePolicy::None;
+          } else if (arg == "hash") {
+            params_->output_capture.policy = OutputCapturePolicy::Hash;
+          } else if (arg == "sampled") {
+            params_->output_capture.policy = OutputCapturePolicy::Sampled;
+          } else if (arg == "full") {
+            params_->output_capture.policy = OutputCapturePolicy::Full;
+          } else {
+            Usage(
+                "Failed to parse --output-capture. Unsupported type provided: "
+                "'" +
+                arg + "'. Choices are 'none', 'hash', 'sampled' or 'full'.");
+          }
+          break;
+        }
+        case long_option_idx_base + 69: {
+          if (std::stoll(optarg) <= 0) {
+            Usage(
+                "Failed to parse --output-capture-sample-rate. The value must "
+                "be > 0.");
+          }
+          params_->output_capture.sample_rate = std::stoull(optarg);
+          break;
+        }
+        case long_option_idx_base + 70: {
+          const int64_t precision{std::stoll(optarg)};
+          if (precision < 1 ||
+              precision > LatencyHistogram::MAX_SIGNIFICANT_DIGITS) {
+            Usage(
+                "Failed to parse --latency-histogram-precision. The value "
+                "must be in range [1, 5].");
+          }
+          params_->latency_histogram_precision = precision;
+          break;
+        }
+        case long_option_idx_base + 71: {
+          std::string arg{optarg};
+          if (arg == "sleep") {
+            params_->request_pacing.strategy = PacingStrategy::Sleep;
+          } else if (arg == "hybrid") {
+            params_->request_pacing.strategy = PacingStrategy::Hybrid;
+          } else if (arg == "deadline") {
+            params_->request_pacing.strategy = PacingStrategy::Deadline;
+          } else if (arg == "batched") {
+            params_->request_pacing.strategy = PacingStrategy::Batched;
+          } else {
+            Usage(
+                "Failed to parse --request-pacing. Unsupported type provided: "
+                "'" +
+                arg +
+                "'. Choices are 'sleep', 'hybrid', 'deadline' or 'batched'.");
+          }
+          break;
+        }
+        case long_option_idx_base + 72: {
+          if (std::stoll(optarg) < 0) {
+            Usage(
+                "Failed to parse --request-pacing-slack. The value must be >= "
+                "0.");
+          }
+          params_->request_pacing.slack =
+              std::chrono::microseconds(std::stoull(optarg));
+          break;
+        }
+        case long_option_idx_base + 73: {
+          if (params_->inference_load_mode != InferenceLoadMode::None) {
+            Usage(
+                "Cannot use both " + to_string(params_->inference_load_mode) +
+                " and --request-rate-curve.");
+          }
+          double mean_rate{0};
+          try {
+            const LoadCurve curve{LoadCurve::Parse(optarg)};
+            if (curve.Duration() < 1) {
+              throw std::invalid_argument("The duration must be >= 1 second.");
+            }
+            mean_rate = curve.MeanRate();
+          }
+          catch (const std::invalid_argument& e) {
+            Usage(
+                "Failed to parse --request-rate-curve. " +
+                std::string(e.what()));
+          }
+          params_->inference_load_mode = InferenceLoadMode::RequestRate;
+          params_->request_rate_curve = optarg;
+          // The whole curve is one run at its mean request rate
+          params_->request_rate_range[SEARCH_RANGE::kSTART] = mean_rate;
+          params_->request_rate_range[SEARCH_RANGE::kEND] = mean_rate;
+          break;
+        }
+        case long_option_idx_base + 74: {
+          std::string arg{optarg};
+          if (arg == "worker") {
+            params_->request_pacing.dispatch = RequestDispatch::PerWorker;
+          } else if (arg == "timing-wheel") {
+            params_->request_pacing.dispatch = RequestDispatch::TimingWheel;
+          } else {
+            Usage(
+                "Failed to parse --request-dispatch. Unsupported type "
+                "provided: '" +
+                arg + "'. Choices are 'worker' or 'timing-wheel'.");
+          }
+          break;
+        }
+        case long_option_idx_base + 75: {
+          if (params_->search_mode == SearchMode::BINARY) {
+            Usage("Cannot use both --binary-search and --goodput-slo.");
+          }
+          try {
+            params_->goodput_slo = GoodputSlo::Parse(optarg);
+          }
+          catch (const std::invalid_argument& e) {
+            Usage("Failed to parse --goodput-slo. " + std::string(e.what()));
+          }
+          params_->search_mode = SearchMode::GOODPUT;
+          break;
+        }
+        case long_option_idx_base + 76: {
+          std::string arg{optarg};
+          if (arg == "threaded") {
+            params_->concurrency_engine = ConcurrencyEngine::Threaded;
+          } else if (arg == "event-loop") {
+            params_->concurrency_engine = ConcurrencyEngine::EventLoop;
+          } else {
+            Usage(
+                "Failed to parse --concurrency-engine. Unsupported type "
+                "provided: '" +
+                arg + "'. Choices are 'threaded' or 'event-loop'.");
+          }
+          break;
+        }
+        case long_option_idx_base + 77: {
+          try {
+            params_->worker_cpus = cb::CpuAffinity::Parse(optarg);
+          }
+          catch (const std::invalid_argument& e) {
+            Usage("Failed to parse --worker-cpus. " + std::string(e.what()));
+          }
+          break;
+        }
+        case long_option_idx_base + 78: {
+          try {
+            params_->completion_cpus = cb::CpuAffinity::Parse(optarg);
+          }
+          catch (const std::invalid_argument& e) {
+            Usage(
+                "Failed to parse --completion-cpus. " + std::string(e.what()));
+          }
+          break;
+        }
+        case long_option_idx_base + 79: {
+          try {
+            params_->profiler_cpus = cb::CpuAffinity::Parse(optarg);
+          }
+          catch (const std::invalid_argument& e) {
+            Usage("Failed to parse --profiler-cpus. " + std::string(e.what()));
+          }
+          break;
+        }
+        case long_option_idx_base + 80: {
+          params_->fixed_schedule_trace = optarg;
+          break;
+        }
+        case long_option_idx_base + 81: {
+          std::string arg{optarg};
+          if (arg == "ms") {
+            params_->trace_replay.time_unit = std::chrono::milliseconds(1);
+          } else if (arg == "us") {
+            params_->trace_replay.time_unit = std::chrono::microseconds(1);
+          } else {
+            Usage(
+                "Failed to parse --fixed-schedule-time-unit. Unsupported type "
+                "provided: '" +
+                arg + "'. Choices are 'ms' or 'us'.");
+          }
+          break;
+        }
+        case long_option_idx_base + 82: {
+          params_->trace_replay.speedup = std::atof(optarg);
+          if (!(params_->trace_replay.speedup > 0)) {
+            Usage(
+                "Failed to parse --fixed-schedule-speedup. The value must be "
+                "> 0.");
+          }
+          break;
+        }
+        case long_option_idx_base + 83: {
+          try {
+            std::tie(
+                params_->trace_replay.window_start,
+                params_->trace_replay.window_end) =
+                TraceReplay::ParseWindow(optarg);
+          }
+          catch (const std::invalid_argument& e) {
+            Usage(
+                "Failed to parse --fixed-schedule-window. " +
+                std::string(e.what()));
+          }
+          break;
+        }
+        case long_option_idx_base + 84: {
+          params_->convert_input_data = optarg;
+          break;
+        }
+        case long_option_idx_base + 85: {
+          std::string transfer_shards{optarg};
+          if (std::stoi(transfer_shards) > 0) {
+            params_->transfer_shards = std::stoull(transfer_shards);
+          } else {
+            Usage("Failed to parse --transfer-shards. The value must be > 0.");
+          }
+          break;
+        }
+        case long_option_idx_base + 86: {
+          std::string max_connections{optarg};
+          if (std::stoi(max_connections) > 0) {
+            params_->max_connections = std::stoull(max_connections);
+          } else {
+            Usage("Failed to parse --max-connections. The value must be > 0.");
+          }
+          break;
+        }
         case 'v':
           params_->extra_verbose = params_->verbose;
           params_->verbose = true;
@@ -1911,11 +2334,19 @@ CLParser::ParseCommandLine(int argc, char** argv)
     }
   }
 
-  // Overriding the max_threads default for concurrency mode
+  // Overriding the max_threads default for concurrency mode. The event loop
+  // engine doesn't need a thread per concurrent request, but it only runs with
+  // the asynchronous API and sync workers fall back to the threaded loop.
+  // Streaming always runs with the asynchronous API
   if (!params_->max_threads_specified &&
       params_->inference_load_mode == InferenceLoadMode::Concurrency) {
-    params_->max_threads =
-        std::max(DEFAULT_MAX_THREADS, params_->concurrency_range.end);
+    if ((params_->async || params_->streaming) &&
+        params_->concurrency_engine == ConcurrencyEngine::EventLoop) {
+      params_->max_threads = DEFAULT_MAX_THREADS;
+    } else {
+      params_->max_threads =
+          std::max(DEFAULT_MAX_THREADS, params_->concurrency_range.end);
+    }
   }
 
   if (params_->inference_load_mode == InferenceLoadMode::CustomIntervals) {
@@ -1938,6 +2369,12 @@ CLParser::ParseCommandLine(int argc, char** argv)
     params_->request_count = pa::DataLoader::GetDatasetSize(params_->user_data);
   }
 
+  // A load curve runs for the number of requests it adds up to
+  if (!params_->request_rate_curve.empty() && params_->request_count == 0) {
+    params_->request_count =
+        LoadCurve::Parse(params_->request_rate_curve).ExpectedRequestCount();
+  }
+
   // When the request-count feature is enabled, override the measurement mode to
   // be count windows with a window size of the requested count
   if (params_->request_count) {
@@ -1946,6 +2383,86 @@ CLParser::ParseCommandLine(int argc, char** argv)
   }
 }
 
+void
+CLParser::ParseRequestDistribution(const std::string& arg)
+{
+  const size_t colon_pos{arg.find(':')};
+  const std::string type{arg.substr(0, colon_pos)};
+
+  std::map<std::string, double> shape_params{};
+  if (colon_pos != std::string::npos) {
+    for (const auto& key_value : SplitString(arg.substr(colon_pos + 1), ",")) {
+      const size_t equal_pos{key_value.find('=')};
+      if (equal_pos == std::string::npos) {
+        Usage(
+            "Failed to parse --request-distribution. The shape parameter '" +
+            key_value + "' does not match <key=value>.");
+      }
+      shape_params[key_value.substr(0, equal_pos)] =
+          std::stod(key_value.substr(equal_pos + 1));
+    }
+  }
+
+  // Consumes the given shape parameter if it was provided
+  const auto take{[&shape_params](const std::string& key, double& value) {
+    const auto it{shape_params.find(key)};
+    if (it != shape_params.end()) {
+      value = it->second;
+      shape_params.erase(it);
+    }
+  }};
+
+  DistributionParams& params{params_->request_distribution_params};
+  if (type == "poisson") {
+    params_->request_distribution = Distribution::POISSON;
+  } else if (type == "constant") {
+    params_->request_distribution = Distribution::CONSTANT;
+  } else if (type == "gamma" || type == "lognormal") {
+    params_->request_distribution =
+        type == "gamma" ? Distribution::GAMMA : Distribution::LOGNORMAL;
+    take("cv", params.cv);
+    if (params.cv <= 0) {
+      Usage("Failed to parse --request-distribution. The cv must be > 0.");
+    }
+  } else if (type == "pareto") {
+    params_->request_distribution = Distribution::PARETO;
+    take("alpha", params.pareto_alpha);
+    if (params.pareto_alpha <= 1) {
+      Usage("Failed to parse --request-distribution. The alpha must be > 1.");
+    }
+  } else if (type == "mmpp") {
+    params_->request_distribution = Distribution::MMPP;
+    take("ratio", params.burst_ratio);
+    take("fraction", params.burst_fraction);
+    take("burst_ms", params.burst_ms);
+    if (params.burst_ratio < 1) {
+      Usage("Failed to parse --request-distribution. The ratio must be >= 1.");
+    }
+    if (params.burst_fraction <= 0 || params.burst_fraction >= 1) {
+      Usage(
+          "Failed to parse --request-distribution. The fraction must be > 0 "
+          "and < 1.");
+    }
+    if (params.burst_ms <= 0) {
+      Usage(
+          "Failed to parse --request-distribution. The burst_ms must be > 0.");
+    }
+  } else {
+    Usage(
+        "Failed to parse --request-distribution. Unsupported type provided: '" +
+        type +
+        "'. Choices are 'poisson', 'constant', 'gamma', 'mmpp', 'lognormal' "
+        "or 'pareto'.");
+  }
+
+  if (!shape_params.empty()) {
+    Usage(
+        "Failed to parse --request-distribution. Unsupported shape parameter "
+        "for '" +
+        type + "': '" + shape_params.begin()->first + "'.");
+  }
+}
+
 void
 CLParser::VerifyOptions()
 {
@@ -1997,12 +2514,34 @@ CLParser::VerifyOptions()
   if (params_->async && params_->forced_sync) {
     Usage("Cannot specify --async and --sync simultaneously.");
   }
+  if (params_->concurrency_engine == ConcurrencyEngine::EventLoop &&
+      !params_->async && !params_->streaming) {
+    Usage(
+        "The --concurrency-engine=event-loop option requires --async or "
+        "--streaming.");
+  }
 
   if (params_->inference_load_mode == InferenceLoadMode::FixedSchedule &&
       params_->warmup_request_count > 0) {
     Usage("Cannot use warmup options with --fixed-schedule");
   }
 
+  if (params_->inference_load_mode != InferenceLoadMode::FixedSchedule &&
+      (!params_->fixed_schedule_trace.empty() ||
+       params_->trace_replay != TraceReplay{})) {
+    Usage(
+        "The --fixed-schedule-trace, --fixed-schedule-time-unit, "
+        "--fixed-schedule-speedup and --fixed-schedule-window options require "
+        "--fixed-schedule.");
+  }
+
+  if (!params_->fixed_schedule_trace.empty() &&
+      !std::filesystem::is_regular_file(params_->fixed_schedule_trace)) {
+    Usage(
+        "The trace file '" + params_->fixed_schedule_trace +
+        "' passed to --fixed-schedule-trace is not a file.");
+  }
+
   if (params_->inference_load_mode == InferenceLoadMode::PeriodicConcurrency &&
       !params_->streaming) {
     Usage(
@@ -2059,12 +2598,26 @@ CLParser::VerifyOptions()
   if (((params_->concurrency_range.end == NO_LIMIT) ||
        (params_->request_rate_range[SEARCH_RANGE::kEND] ==
         static_cast<double>(NO_LIMIT))) &&
-      (params_->latency_threshold_ms == NO_LIMIT)) {
+      (params_->latency_threshold_ms == NO_LIMIT) &&
+      (params_->search_mode != SearchMode::GOODPUT)) {
     Usage(
         "The end of the search range and the latency limit can not be both 0 "
         "(or 0.0) simultaneously");
   }
 
+  if (params_->search_mode == SearchMode::GOODPUT) {
+    if ((params_->inference_load_mode != InferenceLoadMode::Concurrency &&
+         params_->inference_load_mode != InferenceLoadMode::RequestRate) ||
+        !params_->request_rate_curve.empty()) {
+      Usage(
+          "The --goodput-slo option requires --concurrency-range or "
+          "--request-rate-range.");
+    }
+    if (params_->request_count != 0) {
+      Usage("--request-count not supported with --goodput-slo.");
+    }
+  }
+
   if (((params_->concurrency_range.end == NO_LIMIT) ||
        (params_->request_rate_range[SEARCH_RANGE::kEND] ==
         static_cast<double>(NO_LIMIT))) &&
@@ -2181,6 +2734,13 @@ CLParser::VerifyOptions()
     if (params_->user_data.empty()) {
       Usage("Must supply --input-data for OpenAI service kind.");
     }
+    if (!params_->convert_input_data.empty() &&
+        (params_->user_data.size() != 1 ||
+         !std::filesystem::is_regular_file(params_->user_data[0]))) {
+      Usage(
+          "The --convert-input-data option requires a single input data json "
+          "file passed to --input-data.");
+    }
     if (params_->endpoint.empty()) {
       Usage(
           "Must supply --endpoint for OpenAI service kind. For example, "
@@ -2249,6 +2809,27 @@ CLParser::VerifyOptions()
     Usage(
         "Session concurrency mode is only supported with OpenAI service kind.");
   }
+
+  if (!params_->convert_input_data.empty() &&
+      params_->kind != cb::BackendKind::OPENAI) {
+    Usage(
+        "The --convert-input-data option is only supported with OpenAI service "
+        "kind.");
+  }
+
+  if (params_->transfer_shards != 1 &&
+      params_->kind != cb::BackendKind::OPENAI) {
+    Usage(
+        "The --transfer-shards option is only supported with OpenAI service "
+        "kind.");
+  }
+
+  if (params_->max_connections != 0 &&
+      params_->kind != cb::BackendKind::OPENAI) {
+    Usage(
+        "The --max-connections option is only supported with OpenAI service "
+        "kind.");
+  }
 }
 
 }}  // namespace triton::perfanalyzer
@@ -31,9 +31,14 @@
 #include <vector>
 
 #include "constants.h"
+#include "goodput_search.h"
 #include "inference_load_mode.h"
 #include "mpi_utils.h"
+#include "latency_histogram.h"
+#include "output_capture.h"
+#include "request_pacer.h"
 #include "perf_utils.h"
+#include "trace_replay.h"
 
 namespace triton { namespace perfanalyzer {
 
@@ -56,11 +61,28 @@ struct PerfAnalyzerParameters {
   bool sequence_length_specified = false;
   double sequence_length_variation = 20.0;
   int32_t percentile = -1;
+  uint32_t latency_histogram_precision{
+      LatencyHistogram::DEFAULT_SIGNIFICANT_DIGITS};
   std::vector<std::string> user_data;
+  // Where to write the binary trace of the input data JSON, if not empty
+  std::string convert_input_data{};
   std::unordered_map<std::string, std::vector<int64_t>> input_shapes;
   std::vector<cb::ModelIdentifier> bls_composing_models;
   uint64_t measurement_window_ms = 5000;
   Range<uint64_t> concurrency_range{1, 1, 1};
+  ConcurrencyEngine concurrency_engine{ConcurrencyEngine::Threaded};
+  cb::CpuAffinity worker_cpus{};
+  cb::CpuAffinity completion_cpus{};
+  // The number of threads transferring the requests of each OpenAI client
+  size_t transfer_shards{1};
+  // The maximum number of connections each of these threads keeps open, 0 for
+  // no limit
+  size_t max_connections{0};
+  cb::CpuAffinity profiler_cpus{};
+  // How the fixed schedule is replayed, and the trace file it is read from
+  // instead of the dataset if not empty
+  TraceReplay trace_replay{};
+  std::string fixed_schedule_trace{};
   std::unordered_map<std::string, cb::RequestParameter> request_parameters;
   uint64_t latency_threshold_ms = NO_LIMIT;
   double stability_threshold = 0.1;
@@ -75,7 +97,11 @@ struct PerfAnalyzerParameters {
   uint32_t num_of_sequences = 4;
   bool serial_sequences = false;
   SearchMode search_mode = SearchMode::LINEAR;
+  GoodputSlo goodput_slo{};
   Distribution request_distribution = Distribution::CONSTANT;
+  DistributionParams request_distribution_params{};
+  std::string request_rate_curve{""};
+  RequestPacing request_pacing{};
   std::string request_intervals_file{""};
   SharedMemoryType shared_memory_type = NO_SHARED_MEMORY;
   size_t output_shm_size = 100 * 1024;
@@ -140,6 +166,9 @@ struct PerfAnalyzerParameters {
   // The profile export file path.
   std::string profile_export_file{""};
 
+  // How the response outputs are recorded in the profile export.
+  OutputCapture output_capture{};
+
   Range<uint64_t> periodic_concurrency_range{1, 1, 1};
   uint64_t request_period{10};
   size_t warmup_request_count{0};
@@ -169,6 +198,7 @@ class CLParser {
   virtual void Usage(const std::string& msg = std::string());
   void PrintVersion();
   void ParseCommandLine(int argc, char** argv);
+  void ParseRequestDistribution(const std::string& arg);
   void VerifyOptions();
 };
 }}  // namespace triton::perfanalyzer
@@ -144,11 +144,13 @@ ConcurrencyManager::ReconfigThreads(
     // Launch new thread for inferencing
     threads_stat_.emplace_back(new ThreadStat());
     threads_config_.emplace_back(new ThreadConfig(threads_config_.size()));
+    threads_config_.back()->output_capture_ = output_capture_;
+    threads_config_.back()->concurrency_engine_ = concurrency_engine_;
 
     workers_.push_back(
         MakeWorker(threads_stat_.back(), threads_config_.back()));
 
-    threads_.emplace_back(&IWorker::Infer, workers_.back());
+    LaunchWorkerThread(workers_.back());
   }
 
   {
@@ -27,6 +27,7 @@
 #include "concurrency_worker.h"
 
 #include <algorithm>
+#include <thread>
 
 #include "client_backend/client_backend.h"
 #include "perf_utils.h"
@@ -44,9 +45,15 @@ ConcurrencyWorker::Infer()
   CreateCtxIdTracker();
   ReserveContexts();
 
+  const bool event_loop{UsingEventLoop()};
+  if (event_loop) {
+    // The thread counts as idle whenever no one holds the send token
+    thread_stat_->idle_timer.Start();
+  }
+
   // run inferencing until receiving exit signal to maintain server load.
   do {
-    if (RunInference()) {
+    if (event_loop ? RunEventLoop() : RunInference()) {
       break;
     }
   } while (true);
@@ -74,6 +81,36 @@ ConcurrencyWorker::RunInference()
   return false;
 }
 
+bool
+ConcurrencyWorker::RunEventLoop()
+{
+  // While the worker thread holds the send token the callbacks only return
+  // their context ids, so that contexts can be created and sequences completed
+  // without a request being sent from under it
+  AcquireSendToken();
+  HandleExecuteOff();
+  const bool no_concurrency{HandleNoConcurrency()};
+  if (!no_concurrency) {
+    CreateContextsAsNecessary();
+    SendInferRequests();
+  }
+  ReleaseSendToken();
+  if (no_concurrency) {
+    return true;
+  }
+
+  if (ShouldExit()) {
+    AcquireSendToken();
+    HandleExitConditions();
+    // HandleExitConditions already restarted the idle timer
+    sending_ = false;
+    return true;
+  }
+
+  WaitForEventLoopWake();
+  return false;
+}
+
 void
 ConcurrencyWorker::CreateCtxIdTracker()
 {
@@ -153,6 +190,8 @@ ConcurrencyWorker::CreateContextsAsNecessary()
       CreateContext();
     }
     ResetFreeCtxIds();
+  } else if (!on_sequence_model_) {
+    ResizeFreeCtxIds();
   }
 
   // TODO REFACTOR TMA-1043 -- this shouldn't be handled here
@@ -192,11 +231,117 @@ ConcurrencyWorker::WaitForResponses()
   }
 }
 
+void
+ConcurrencyWorker::WaitForEventLoopWake()
+{
+  std::unique_lock<std::mutex> lk(cb_mtx_);
+  cb_cv_.wait_for(lk, event_loop_poll_interval_, [this] {
+    if (notified_) {
+      notified_ = false;
+      return true;
+    }
+    return false;
+  });
+}
+
 void
 ConcurrencyWorker::ResetFreeCtxIds()
 {
   std::lock_guard<std::mutex> lock(cb_mtx_);
   ctx_id_tracker_->Reset(thread_config_->concurrency_);
+  applied_concurrency_ = thread_config_->concurrency_;
+  surplus_ctx_ids_ = 0;
+}
+
+void
+ConcurrencyWorker::ResizeFreeCtxIds()
+{
+  std::lock_guard<std::mutex> lock(cb_mtx_);
+  const size_t concurrency{thread_config_->concurrency_};
+  for (; applied_concurrency_ < concurrency; applied_concurrency_++) {
+    if (surplus_ctx_ids_ > 0) {
+      surplus_ctx_ids_--;
+    } else {
+      ctx_id_tracker_->Restore(0);
+    }
+  }
+  for (; applied_concurrency_ > concurrency; applied_concurrency_--) {
+    if (ctx_id_tracker_->IsAvailable()) {
+      ctx_id_tracker_->Get();
+    } else {
+      surplus_ctx_ids_++;
+    }
+  }
+}
+
+void
+ConcurrencyWorker::FinalizeRequest(uint32_t ctx_id)
+{
+  const bool event_loop{UsingEventLoop()};
+  {
+    std::lock_guard<std::mutex> lk(cb_mtx_);
+    if (surplus_ctx_ids_ > 0) {
+      surplus_ctx_ids_--;
+    } else {
+      ctx_id_tracker_->Restore(ctx_id);
+    }
+    if (!event_loop) {
+      notified_ = true;
+    }
+  }
+
+  if (event_loop) {
+    // Send the next request from here instead of waking up the worker thread
+    // for it, unless the worker thread has to pause or exit
+    send_requested_ = true;
+    SendPendingRequests();
+    if (execute_ && !ShouldExit()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lk(cb_mtx_);
+    notified_ = true;
+  }
+
+  cb_cv_.notify_all();
+}
+
+bool
+ConcurrencyWorker::TryAcquireSendToken()
+{
+  if (sending_.exchange(true)) {
+    return false;
+  }
+  thread_stat_->idle_timer.Stop();
+  return true;
+}
+
+void
+ConcurrencyWorker::AcquireSendToken()
+{
+  while (!TryAcquireSendToken()) {
+    std::this_thread::yield();
+  }
+}
+
+void
+ConcurrencyWorker::ReleaseSendToken()
+{
+  thread_stat_->idle_timer.Start();
+  sending_ = false;
+  SendPendingRequests();
+}
+
+void
+ConcurrencyWorker::SendPendingRequests()
+{
+  // A callback that finds the token taken leaves its request to the holder,
+  // which checks for one more round after giving the token back
+  while (send_requested_ && TryAcquireSendToken()) {
+    send_requested_ = false;
+    SendInferRequests();
+    thread_stat_->idle_timer.Start();
+    sending_ = false;
+  }
 }
 
 uint32_t
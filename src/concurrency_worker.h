@@ -25,6 +25,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "load_worker.h"
@@ -48,6 +50,12 @@ class NaggyMockConcurrencyWorker;
 ///   at the same time. Thus it uses one single context as every infer context
 ///   creates a worker thread implicitly.
 ///
+/// With the EventLoop engine and the async API, the callback of a completed
+/// request sends the next one itself. Sends are serialized by a token that
+/// the callbacks and the worker thread take turns holding, so the worker
+/// thread only wakes up to pause, exit or apply a new concurrency and the
+/// concurrency is no longer tied to the number of threads.
+///
 class ConcurrencyWorker : public LoadWorker {
  public:
   ConcurrencyWorker(
@@ -79,6 +87,9 @@ class ConcurrencyWorker : public LoadWorker {
 
   void CreateCtxIdTracker();
 
+  // One pass of the event loop engine. Returns true if the worker should exit
+  bool RunEventLoop();
+
   // Reserve vector size for contexts
   void ReserveContexts();
 
@@ -105,15 +116,52 @@ class ConcurrencyWorker : public LoadWorker {
 
   void ResetFreeCtxIds();
 
+  // Add or take away free context ids to match a concurrency change of a
+  // non-sequence model while requests are in flight
+  void ResizeFreeCtxIds();
+
+  // Return the context id of a completed request, and either send the next
+  // request right away or wake up the worker thread
+  void FinalizeRequest(uint32_t ctx_id);
+
+  bool UsingEventLoop() const
+  {
+    return async_ && thread_config_->concurrency_engine_ ==
+                         ConcurrencyEngine::EventLoop;
+  }
+
+  // Take the token for sending requests. Whoever holds it isn't idle
+  bool TryAcquireSendToken();
+  void AcquireSendToken();
+  void ReleaseSendToken();
+
+  // Send the requests that callbacks asked for while another thread held the
+  // token
+  void SendPendingRequests();
+
+  // Wait until a callback hands control back or the poll interval ends
+  void WaitForEventLoopWake();
+
   uint32_t GetSeqStatIndex(uint32_t ctx_id) override;
 
   void CreateContextFinalize(std::shared_ptr<InferContext> ctx) override
   {
     ctx->RegisterAsyncCallbackFinalize(std::bind(
-        &ConcurrencyWorker::AsyncCallbackFinalize, this,
-        std::placeholders::_1));
+        &ConcurrencyWorker::FinalizeRequest, this, std::placeholders::_1));
   }
 
+  // The concurrency that the free context ids currently add up to
+  size_t applied_concurrency_{0};
+  // The number of context ids to drop when their requests complete, because
+  // the concurrency was lowered while they were in flight
+  size_t surplus_ctx_ids_{0};
+
+  std::atomic<bool> sending_{false};
+  std::atomic<bool> send_requested_{false};
+  // How often the event loop worker thread checks for pauses, exits and
+  // concurrency changes that no callback tells it about
+  std::chrono::milliseconds event_loop_poll_interval_{10};
+
 #ifndef DOCTEST_CONFIG_DISABLE
   friend NaggyMockConcurrencyWorker;
 #endif
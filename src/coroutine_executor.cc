@@ -0,0 +1,221 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "coroutine_executor.h"
+
+#include <stdexcept>
+
+namespace triton { namespace perfanalyzer {
+
+CoroutineExecutor::CoroutineExecutor(
+    const size_t num_threads, const std::function<void()>& on_thread_start)
+{
+  threads_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; i++) {
+    threads_.emplace_back([this, on_thread_start]() {
+      if (on_thread_start) {
+        on_thread_start();
+      }
+      Run();
+    });
+  }
+}
+
+CoroutineExecutor::~CoroutineExecutor()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Completions of the stopping tasks may still be posted until then
+    idle_cv_.wait(lock, [this]() { return num_pending_tasks_ == 0; });
+    stop_ = true;
+  }
+  ready_cv_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void
+CoroutineExecutor::Spawn(Task task)
+{
+  Task::Handle handle{task.Release()};
+  if (!handle) {
+    return;
+  }
+  handle.promise().on_detached_done = [this](std::exception_ptr exception) {
+    FinishTask(exception);
+  };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (failed_) {
+      handle.destroy();
+      return;
+    }
+    num_pending_tasks_++;
+  }
+  Post(handle);
+}
+
+void
+CoroutineExecutor::Wait()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_cv_.wait(
+      lock, [this]() { return num_pending_tasks_ == 0 || failed_; });
+  if (first_exception_) {
+    std::rethrow_exception(std::exchange(first_exception_, nullptr));
+  }
+}
+
+void
+CoroutineExecutor::ThrowIfFailed() const
+{
+  if (failed_) {
+    throw std::runtime_error("Stopped because another task failed.");
+  }
+}
+
+void
+CoroutineExecutor::Post(std::coroutine_handle<> handle)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_.push_back(handle);
+  }
+  ready_cv_.notify_one();
+}
+
+size_t
+CoroutineExecutor::NumPendingTasks()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_pending_tasks_;
+}
+
+void
+CoroutineExecutor::AddTimer(
+    const Clock::time_point deadline, std::coroutine_handle<> handle)
+{
+  bool is_earliest{false};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A coroutine that sleeps after a failure wakes up right away to stop
+    timers_.push(
+        Timer{failed_ ? Clock::time_point{} : deadline, next_timer_order_++,
+              handle});
+    is_earliest = timers_.top().handle == handle;
+  }
+  // Only a timer that is due before all the others changes how long the
+  // threads have to wait
+  if (is_earliest) {
+    ready_cv_.notify_one();
+  }
+}
+
+void
+CoroutineExecutor::Run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    const Clock::time_point now{Clock::now()};
+    while (!timers_.empty() && timers_.top().deadline <= now) {
+      ready_.push_back(timers_.top().handle);
+      timers_.pop();
+    }
+
+    if (!ready_.empty()) {
+      std::coroutine_handle<> handle{ready_.front()};
+      ready_.pop_front();
+      lock.unlock();
+      handle.resume();
+      lock.lock();
+    } else if (stop_) {
+      break;
+    } else if (!timers_.empty()) {
+      // The heap may be reallocated while waiting, so wait on a copy
+      const Clock::time_point deadline{timers_.top().deadline};
+      ready_cv_.wait_until(lock, deadline);
+    } else {
+      ready_cv_.wait(lock);
+    }
+  }
+}
+
+void
+CoroutineExecutor::FinishTask(std::exception_ptr exception)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (exception && !failed_) {
+      first_exception_ = exception;
+      failed_ = true;
+      // Wake up the sleeping coroutines so that they stop
+      while (!timers_.empty()) {
+        ready_.push_back(timers_.top().handle);
+        timers_.pop();
+      }
+    }
+    num_pending_tasks_--;
+  }
+  ready_cv_.notify_all();
+  idle_cv_.notify_all();
+}
+
+bool
+CompletionAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+  handle_ = handle;
+  start_(*this);
+  if (!started_) {
+    return false;
+  }
+  // Stay suspended unless the operation already completed during the start
+  return !completed_.exchange(true);
+}
+
+void
+CompletionAwaiter::await_resume() const
+{
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+  executor_.ThrowIfFailed();
+}
+
+void
+CompletionAwaiter::Complete(std::exception_ptr error)
+{
+  error_ = error;
+  // The awaiter is gone once the start has seen completed_, so everything it
+  // takes is read before
+  CoroutineExecutor& executor{executor_};
+  const std::coroutine_handle<> handle{handle_};
+  if (completed_.exchange(true)) {
+    executor.Post(handle);
+  }
+}
+
+}}  // namespace triton::perfanalyzer
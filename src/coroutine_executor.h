@@ -0,0 +1,297 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace triton { namespace perfanalyzer {
+
+/// A coroutine that returns nothing. It doesn't start until it is awaited by
+/// another coroutine, which it then resumes once it has finished, or until it
+/// is spawned on a CoroutineExecutor. An exception thrown by the coroutine is
+/// rethrown to whoever awaits it.
+///
+class Task {
+ public:
+  struct promise_type;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  struct FinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(Handle handle) noexcept;
+    void await_resume() const noexcept {}
+  };
+
+  struct promise_type {
+    Task get_return_object() { return Task{Handle::from_promise(*this)}; }
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() noexcept
+    {
+      exception = std::current_exception();
+    }
+
+    // The coroutine awaiting this one
+    std::coroutine_handle<> continuation{};
+    std::exception_ptr exception{};
+    // Called instead of resuming a continuation when the task was spawned.
+    // The frame is destroyed before it is called
+    std::function<void(std::exception_ptr)> on_detached_done{};
+  };
+
+  Task() = default;
+  explicit Task(Handle handle) : handle_(handle) {}
+  Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+  Task& operator=(Task&& other) noexcept
+  {
+    if (this != &other) {
+      Reset();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  ~Task() { Reset(); }
+
+  bool await_ready() const noexcept { return !handle_ || handle_.done(); }
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting)
+  {
+    handle_.promise().continuation = awaiting;
+    return handle_;
+  }
+  void await_resume() const
+  {
+    if (handle_ && handle_.promise().exception) {
+      std::rethrow_exception(handle_.promise().exception);
+    }
+  }
+
+  /// Gives up the ownership of the coroutine frame
+  Handle Release() { return std::exchange(handle_, {}); }
+
+ private:
+  void Reset()
+  {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = {};
+    }
+  }
+
+  Handle handle_{};
+};
+
+inline std::coroutine_handle<>
+Task::FinalAwaiter::await_suspend(Handle handle) noexcept
+{
+  promise_type& promise{handle.promise()};
+  if (promise.continuation) {
+    return promise.continuation;
+  }
+  if (promise.on_detached_done) {
+    auto on_done{std::move(promise.on_detached_done)};
+    const std::exception_ptr exception{promise.exception};
+    handle.destroy();
+    on_done(exception);
+  }
+  return std::noop_coroutine();
+}
+
+/// Runs coroutines on a fixed set of threads. A coroutine that waits for a
+/// backend completion or a timer doesn't hold on to a thread, so the number of
+/// logical users that can be simulated is bounded by memory for their
+/// coroutine frames rather than by threads. Timers are kept in a heap that the
+/// threads wait on between coroutines.
+///
+/// Once a task fails, no more tasks are started and the others stop at their
+/// next co_await of a timer or completion, which throws. Sleeping coroutines
+/// are woken up right away for it.
+///
+class CoroutineExecutor {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// \param num_threads The number of threads that resume coroutines.
+  /// \param on_thread_start Called first on each of the threads, if set.
+  explicit CoroutineExecutor(
+      const size_t num_threads,
+      const std::function<void()>& on_thread_start = nullptr);
+
+  /// Waits for the tasks that are still stopping after a failure, then stops
+  /// the threads. Coroutines that are still suspended at this point are never
+  /// resumed, so Wait() should be called first.
+  ~CoroutineExecutor();
+
+  CoroutineExecutor(const CoroutineExecutor&) = delete;
+  CoroutineExecutor& operator=(const CoroutineExecutor&) = delete;
+
+  /// Starts a task on one of the threads. The executor owns the task from
+  /// then on. The task is dropped without running if a task has failed.
+  /// \param task The task to start.
+  void Spawn(Task task);
+
+  /// Waits until every spawned task has finished, or until the first one
+  /// fails. The other tasks then keep stopping in the background.
+  /// \throws The first exception thrown by any of the tasks.
+  void Wait();
+
+  /// \return Whether any of the tasks has failed
+  bool Failed() const { return failed_; }
+
+  /// Stops the calling coroutine once a task has failed.
+  /// \throws std::runtime_error if any of the tasks has failed.
+  void ThrowIfFailed() const;
+
+  /// Schedules a suspended coroutine to be resumed on one of the threads.
+  /// Safe to call from any thread, including backend callbacks.
+  /// \param handle The coroutine to resume.
+  void Post(std::coroutine_handle<> handle);
+
+  /// Awaitable that resumes the awaiting coroutine at the given time
+  auto SleepUntil(const Clock::time_point deadline)
+  {
+    struct Awaiter {
+      CoroutineExecutor& executor;
+      Clock::time_point deadline;
+
+      bool await_ready() const
+      {
+        return executor.Failed() || deadline <= Clock::now();
+      }
+      void await_suspend(std::coroutine_handle<> handle)
+      {
+        executor.AddTimer(deadline, handle);
+      }
+      void await_resume() const { executor.ThrowIfFailed(); }
+    };
+    return Awaiter{*this, deadline};
+  }
+
+  /// Awaitable that resumes the awaiting coroutine after the given duration
+  template <typename Rep, typename Period>
+  auto SleepFor(const std::chrono::duration<Rep, Period> duration)
+  {
+    return SleepUntil(
+        Clock::now() +
+        std::chrono::duration_cast<Clock::duration>(duration));
+  }
+
+  /// \return The number of spawned tasks that have not finished yet
+  size_t NumPendingTasks();
+
+ private:
+  struct Timer {
+    Clock::time_point deadline;
+    // Breaks ties between equal deadlines in the order they were added
+    uint64_t order;
+    std::coroutine_handle<> handle;
+
+    bool operator>(const Timer& other) const
+    {
+      return deadline != other.deadline ? deadline > other.deadline
+                                        : order > other.order;
+    }
+  };
+
+  void AddTimer(
+      const Clock::time_point deadline, std::coroutine_handle<> handle);
+
+  void Run();
+
+  void FinishTask(std::exception_ptr exception);
+
+  std::mutex mutex_;
+  std::condition_variable ready_cv_;
+  std::deque<std::coroutine_handle<>> ready_;
+  std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers_;
+  uint64_t next_timer_order_{0};
+  bool stop_{false};
+
+  std::condition_variable idle_cv_;
+  size_t num_pending_tasks_{0};
+  std::exception_ptr first_exception_{};
+  std::atomic<bool> failed_{false};
+
+  std::vector<std::thread> threads_;
+};
+
+/// Awaitable completion of an asynchronous operation, such as a request sent
+/// to a client backend. The operation is started when the coroutine suspends,
+/// and the coroutine is resumed on the executor once the operation completes.
+/// If the operation couldn't be started, the coroutine continues right away.
+///
+class CompletionAwaiter {
+ public:
+  /// \param executor The executor the coroutine is resumed on.
+  /// \param start Starts the operation, and calls Started() on the awaiter
+  /// once Complete() is certain to follow. An exception it throws is rethrown
+  /// to the coroutine.
+  CompletionAwaiter(
+      CoroutineExecutor& executor,
+      std::function<void(CompletionAwaiter&)> start)
+      : executor_(executor), start_(std::move(start))
+  {
+  }
+
+  bool await_ready() const { return executor_.Failed(); }
+  bool await_suspend(std::coroutine_handle<> handle);
+  /// \throws The error the operation completed with, if any, or
+  /// std::runtime_error if a task of the executor has failed.
+  void await_resume() const;
+
+  /// Marks the operation as started, so that the coroutine waits for it.
+  void Started() { started_ = true; }
+
+  /// Called once the operation has completed, from any thread. The coroutine
+  /// is resumed by whichever of the start and the completion is last, so that
+  /// it never runs on another thread while the start is still returning.
+  /// \param error The error the operation completed with, if any.
+  void Complete(std::exception_ptr error = nullptr);
+
+ private:
+  CoroutineExecutor& executor_;
+  std::function<void(CompletionAwaiter&)> start_;
+  std::coroutine_handle<> handle_{};
+  bool started_{false};
+  std::exception_ptr error_{};
+  std::atomic<bool> completed_{false};
+};
+
+}}  // namespace triton::perfanalyzer
@@ -35,7 +35,6 @@ namespace triton { namespace perfanalyzer {
 cb::Error
 CustomLoadManager::Create(
     const bool async, const bool streaming,
-    const uint64_t measurement_window_ms, const size_t max_trials,
     const std::string& request_intervals_file, const int32_t batch_size,
     const size_t max_threads, const uint32_t num_of_sequences,
     const SharedMemoryType shared_memory_type, const size_t output_shm_size,
@@ -46,10 +45,9 @@ CustomLoadManager::Create(
         request_parameters)
 {
   std::unique_ptr<CustomLoadManager> local_manager(new CustomLoadManager(
-      async, streaming, request_intervals_file, batch_size,
-      measurement_window_ms, max_trials, max_threads, num_of_sequences,
-      shared_memory_type, output_shm_size, serial_sequences, parser, factory,
-      request_parameters));
+      async, streaming, request_intervals_file, batch_size, max_threads,
+      num_of_sequences, shared_memory_type, output_shm_size, serial_sequences,
+      parser, factory, request_parameters));
 
   *manager = std::move(local_manager);
 
@@ -59,7 +57,6 @@ CustomLoadManager::Create(
 CustomLoadManager::CustomLoadManager(
     const bool async, const bool streaming,
     const std::string& request_intervals_file, int32_t batch_size,
-    const uint64_t measurement_window_ms, const size_t max_trials,
     const size_t max_threads, const uint32_t num_of_sequences,
     const SharedMemoryType shared_memory_type, const size_t output_shm_size,
     const bool serial_sequences, const std::shared_ptr<ModelParser>& parser,
@@ -67,10 +64,9 @@ CustomLoadManager::CustomLoadManager(
     const std::unordered_map<std::string, cb::RequestParameter>&
         request_parameters)
     : RequestRateManager(
-          async, streaming, Distribution::CUSTOM, batch_size,
-          measurement_window_ms, max_trials, max_threads, num_of_sequences,
-          shared_memory_type, output_shm_size, serial_sequences, parser,
-          factory, request_parameters),
+          async, streaming, Distribution::CUSTOM, batch_size, max_threads,
+          num_of_sequences, shared_memory_type, output_shm_size,
+          serial_sequences, parser, factory, request_parameters),
       request_intervals_file_(request_intervals_file)
 {
 }
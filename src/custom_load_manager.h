@@ -52,8 +52,6 @@ class CustomLoadManager : public RequestRateManager {
   /// \param async Whether to use asynchronous or synchronous API for infer
   /// request.
   /// \param streaming Whether to use gRPC streaming API for infer request
-  /// \param measurement_window_ms The time window for measurements.
-  /// \param max_trials The maximum number of windows that will be measured
   /// \param request_intervals_file The path to the file to use to pick up the
   /// time intervals between the successive requests.
   /// \param batch_size The batch size used for each request.
@@ -76,7 +74,6 @@ class CustomLoadManager : public RequestRateManager {
   /// \return cb::Error object indicating success or failure.
   static cb::Error Create(
       const bool async, const bool streaming,
-      const uint64_t measurement_window_ms, const size_t max_trials,
       const std::string& request_intervals_file, const int32_t batch_size,
       const size_t max_threads, const uint32_t num_of_sequences,
       const SharedMemoryType shared_memory_type, const size_t output_shm_size,
@@ -109,7 +106,6 @@ class CustomLoadManager : public RequestRateManager {
   CustomLoadManager(
       const bool async, const bool streaming,
       const std::string& request_intervals_file, const int32_t batch_size,
-      const uint64_t measurement_window_ms, const size_t max_trials,
       const size_t max_threads, const uint32_t num_of_sequences,
       const SharedMemoryType shared_memory_type, const size_t output_shm_size,
       const bool serial_sequences, const std::shared_ptr<ModelParser>& parser,
@@ -49,10 +49,11 @@ CustomRequestScheduleManager::CustomRequestScheduleManager(
     const std::shared_ptr<cb::ClientBackendFactory>& factory)
     : RequestRateManager(
           params.async, params.streaming, Distribution::CUSTOM,
-          params.batch_size, params.measurement_window_ms, params.max_trials,
-          params.max_threads, params.num_of_sequences,
+          params.batch_size, params.max_threads, params.num_of_sequences,
           params.shared_memory_type, params.output_shm_size,
-          params.serial_sequences, parser, factory, params.request_parameters)
+          params.serial_sequences, parser, factory, params.request_parameters),
+      trace_replay_(params.trace_replay),
+      trace_path_(params.fixed_schedule_trace)
 {
   max_threads_ = std::min(max_threads_, params.request_count);
 }
@@ -71,13 +72,14 @@ CustomRequestScheduleManager::InitCustomSchedule(const size_t request_count)
 void
 CustomRequestScheduleManager::GenerateSchedule()
 {
-  auto worker_schedules = CreateWorkerSchedules(schedule_);
+  auto worker_schedules = trace_path_.empty() ? CreateWorkerSchedules(schedule_)
+                                              : CreateTraceWorkerSchedules();
   GiveSchedulesToWorkers(worker_schedules);
 }
 
 std::vector<RateSchedulePtr_t>
 CustomRequestScheduleManager::CreateWorkerSchedules(
-    const std::vector<std::chrono::milliseconds>& schedule)
+    const std::vector<std::chrono::nanoseconds>& schedule)
 {
   std::vector<RateSchedulePtr_t> worker_schedules =
       CreateEmptyWorkerSchedules();
@@ -86,28 +88,81 @@ CustomRequestScheduleManager::CreateWorkerSchedules(
   size_t worker_index = 0;
 
   for (const auto& timestamp : schedule) {
-    const auto timestamp_ns{
-        std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp)};
     worker_index = thread_ids[thread_id_index];
     thread_id_index = ++thread_id_index % thread_ids.size();
-    worker_schedules[worker_index]->intervals.push_back(timestamp_ns);
+    worker_schedules[worker_index]->intervals.push_back(timestamp);
   }
   SetScheduleDurations(worker_schedules);
 
   return worker_schedules;
 }
 
+std::vector<RateSchedulePtr_t>
+CustomRequestScheduleManager::CreateTraceWorkerSchedules()
+{
+  // Once the trace ends it starts over one trace duration later, like the
+  // schedules of a dataset do
+  auto source{[replay = trace_replay_, path = trace_path_,
+               duration = trace_duration_,
+               reader = std::make_shared<TraceReader>(
+                   trace_replay_, trace_path_),
+               offset = std::chrono::nanoseconds(0)]() mutable {
+    auto send_time{reader->Next()};
+    if (!send_time) {
+      reader = std::make_shared<TraceReader>(replay, path);
+      offset += duration;
+      send_time = reader->Next();
+    }
+    if (!send_time) {
+      throw std::runtime_error(
+          "The trace file '" + path + "' no longer has any timestamp to "
+          "replay.");
+    }
+    return *send_time + offset;
+  }};
+  auto stream{std::make_shared<SharedRateStream>(
+      std::move(source), CalculateThreadIds(), workers_.size())};
+
+  std::vector<RateSchedulePtr_t> worker_schedules;
+  for (size_t i = 0; i < workers_.size(); i++) {
+    worker_schedules.push_back(std::make_shared<RateSchedule>(stream, i));
+  }
+  return worker_schedules;
+}
+
+void
+CustomRequestScheduleManager::ScanTrace()
+{
+  TraceReader reader{trace_replay_, trace_path_};
+  trace_size_ = 0;
+  while (const auto send_time{reader.Next()}) {
+    trace_size_++;
+    trace_duration_ = *send_time;
+  }
+}
+
 void
 CustomRequestScheduleManager::InitManagerFinalize()
 {
-  schedule_ = GetScheduleFromDataset();
+  if (trace_path_.empty()) {
+    schedule_ = GetScheduleFromDataset();
+  } else {
+    ScanTrace();
+  }
+  if (ScheduleSize() == 0) {
+    throw std::runtime_error(
+        "The fixed schedule does not have any timestamp to replay. Check that "
+        "--fixed-schedule-window covers some of its timestamps.");
+  }
+  // The window may leave fewer requests than there are payloads
+  max_threads_ = std::min(max_threads_, ScheduleSize());
   parser_->Inputs()->erase("timestamp");
 }
 
-std::vector<std::chrono::milliseconds>
+std::vector<std::chrono::nanoseconds>
 CustomRequestScheduleManager::GetScheduleFromDataset() const
 {
-  std::vector<std::chrono::milliseconds> schedule{};
+  std::vector<std::chrono::nanoseconds> schedule{};
 
   if (data_loader_->GetDataStreamsCount() != 1) {
     throw std::runtime_error(
@@ -119,8 +174,10 @@ CustomRequestScheduleManager::GetScheduleFromDataset() const
   const size_t dataset_size{data_loader_->GetTotalSteps(0)};
 
   for (size_t dataset_index{0}; dataset_index < dataset_size; ++dataset_index) {
-    const auto timestamp{GetTimestamp(dataset_index)};
-    schedule.push_back(timestamp);
+    const auto send_time{trace_replay_.SendTime(GetTimestamp(dataset_index))};
+    if (send_time) {
+      schedule.push_back(*send_time);
+    }
   }
 
   std::sort(schedule.begin(), schedule.end());
@@ -128,7 +185,7 @@ CustomRequestScheduleManager::GetScheduleFromDataset() const
   return schedule;
 }
 
-std::chrono::milliseconds
+uint64_t
 CustomRequestScheduleManager::GetTimestamp(size_t dataset_index) const
 {
   TensorData timestamp_tensor_data{};
@@ -141,10 +198,7 @@ CustomRequestScheduleManager::GetTimestamp(size_t dataset_index) const
     throw std::runtime_error(error.Message());
   }
 
-  const uint64_t timestamp_ms{
-      *reinterpret_cast<const uint64_t*>(timestamp_tensor_data.data_ptr)};
-
-  return std::chrono::milliseconds(timestamp_ms);
+  return *reinterpret_cast<const uint64_t*>(timestamp_tensor_data.data_ptr);
 }
 
 }  // namespace triton::perfanalyzer
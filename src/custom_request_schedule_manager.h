@@ -28,6 +28,7 @@
 #include "command_line_parser.h"
 #include "load_manager.h"
 #include "request_rate_manager.h"
+#include "trace_replay.h"
 
 namespace triton::perfanalyzer {
 
@@ -44,6 +45,10 @@ namespace triton::perfanalyzer {
 /// CustomRequestScheduleManager sends request at 1st second, 2nd second, 4th
 /// second and so on.
 ///
+/// The timestamps are taken from the `timestamp` input of the dataset, or
+/// streamed from a trace file so that long traces do not have to be loaded
+/// as input data. Either way they are scaled and windowed by a TraceReplay.
+///
 
 class CustomRequestScheduleManager : public RequestRateManager {
  public:
@@ -65,6 +70,12 @@ class CustomRequestScheduleManager : public RequestRateManager {
   /// \return cb::Error object indicating success or failure
   cb::Error InitCustomSchedule(const size_t request_count);
 
+  /// \return The number of requests of the schedule
+  size_t ScheduleSize() const
+  {
+    return trace_path_.empty() ? schedule_.size() : trace_size_;
+  }
+
  protected:
   /// Constructor for CustomRequestScheduleManager
   ///
@@ -88,17 +99,35 @@ class CustomRequestScheduleManager : public RequestRateManager {
   /// \param schedule The vector containing the schedule for requests
   /// \return A vector of RateSchedulePtr_t representing the worker schedules
   std::vector<RateSchedulePtr_t> CreateWorkerSchedules(
-      const std::vector<std::chrono::milliseconds>& schedule);
+      const std::vector<std::chrono::nanoseconds>& schedule);
+
+  /// Creates worker schedules that read their timestamps from the trace file
+  /// as the workers go, dealt out in the same order as CreateWorkerSchedules()
+  /// \return A vector of RateSchedulePtr_t representing the worker schedules
+  std::vector<RateSchedulePtr_t> CreateTraceWorkerSchedules();
+
+  /// Reads through the trace file to count its requests inside the window
+  void ScanTrace();
 
-  /// The vector containing the schedule for requests
-  std::vector<std::chrono::milliseconds> schedule_{};
+  /// The vector containing the schedule for requests, unless it is read from
+  /// a trace file
+  std::vector<std::chrono::nanoseconds> schedule_{};
 
  private:
   void InitManagerFinalize() override;
 
-  std::vector<std::chrono::milliseconds> GetScheduleFromDataset() const;
+  std::vector<std::chrono::nanoseconds> GetScheduleFromDataset() const;
+
+  uint64_t GetTimestamp(size_t dataset_index) const;
 
-  std::chrono::milliseconds GetTimestamp(size_t dataset_index) const;
+  const TraceReplay trace_replay_{};
+  // The trace file the schedule is read from, or empty to read it from the
+  // dataset
+  const std::string trace_path_{};
+  // The number of requests of the trace inside the window, and the send time
+  // of the last of them
+  size_t trace_size_{0};
+  std::chrono::nanoseconds trace_duration_{0};
 };
 
 }  // namespace triton::perfanalyzer
@@ -161,6 +161,12 @@ DataLoader::ReadDataFromJSON(
     const std::shared_ptr<ModelTensorMap>& outputs,
     const std::string& json_file)
 {
+  if (binary_trace_) {
+    return cb::Error(
+        "JSON input data can not be combined with a binary trace",
+        pa::GENERIC_ERROR);
+  }
+
   FILE* data_file = fopen(json_file.c_str(), "r");
   if (data_file == nullptr) {
     return cb::Error(
@@ -179,6 +185,105 @@ DataLoader::ReadDataFromJSON(
   return ParseData(d, inputs, outputs);
 }
 
+cb::Error
+DataLoader::ReadDataFromBinaryTrace(
+    const std::shared_ptr<ModelTensorMap>& inputs,
+    const std::string& trace_file)
+{
+  if (data_stream_cnt_ != 0) {
+    return cb::Error(
+        "A binary trace can not be combined with other input data",
+        pa::GENERIC_ERROR);
+  }
+
+  try {
+    binary_trace_ = std::make_shared<const BinaryTrace>(trace_file);
+  }
+  catch (const std::runtime_error& e) {
+    return cb::Error(e.what(), pa::GENERIC_ERROR);
+  }
+
+  for (const auto& [name, input] : *inputs) {
+    if (!binary_trace_->HasInput(name) && !input.is_optional_) {
+      binary_trace_.reset();
+      return cb::Error(
+          "The binary trace '" + trace_file + "' has no data for input '" +
+              name + "'",
+          pa::GENERIC_ERROR);
+    }
+  }
+
+  data_stream_cnt_ = 1;
+  step_num_.push_back(binary_trace_->Size());
+
+  return cb::Error::Success;
+}
+
+cb::Error
+DataLoader::ConvertToBinaryTrace(
+    const std::string& json_file, const std::string& trace_file)
+{
+  // The inputs an OpenAI input data JSON can have in any inference load mode
+  auto inputs{std::make_shared<ModelTensorMap>()};
+  const auto add_input{[&inputs](
+                           const std::string& name,
+                           const std::string& datatype, bool is_optional) {
+    auto& input{(*inputs)[name]};
+    input.name_ = name;
+    input.datatype_ = datatype;
+    input.shape_.push_back(1);
+    input.is_optional_ = is_optional;
+  }};
+  add_input("payload", "JSON", false);
+  add_input("timestamp", "UINT64", true);
+  add_input("delay", "UINT64", true);
+  add_input("session_id", "BYTES", true);
+
+  DataLoader loader(1);
+  RETURN_IF_ERROR(loader.ReadDataFromJSON(
+      inputs, std::make_shared<ModelTensorMap>(), json_file));
+  if (loader.GetDataStreamsCount() != 1) {
+    return cb::Error(
+        "Only an input data JSON with a single flat array for the \"data\" "
+        "field can be converted to a binary trace",
+        pa::GENERIC_ERROR);
+  }
+
+  const auto record_at{[&loader, &inputs](size_t index) {
+    BinaryTraceRecord record{};
+    TensorData data{};
+    // Every step was validated when the JSON was read
+    loader.GetInputData((*inputs)["payload"], 0, index, data);
+    record.payload = std::string_view(
+        reinterpret_cast<const char*>(data.data_ptr), data.batch1_size);
+    loader.GetInputData((*inputs)["timestamp"], 0, index, data);
+    if (data.is_valid) {
+      record.timestamp = *reinterpret_cast<const uint64_t*>(data.data_ptr);
+    }
+    loader.GetInputData((*inputs)["delay"], 0, index, data);
+    if (data.is_valid) {
+      record.delay = *reinterpret_cast<const uint64_t*>(data.data_ptr);
+    }
+    loader.GetInputData((*inputs)["session_id"], 0, index, data);
+    if (data.is_valid) {
+      // Drop the byte size that prefixes a BYTES element
+      record.session_id = std::string_view(
+          reinterpret_cast<const char*>(data.data_ptr) + sizeof(uint32_t),
+          data.batch1_size - sizeof(uint32_t));
+    }
+    return record;
+  }};
+
+  try {
+    BinaryTrace::Write(trace_file, loader.GetTotalSteps(0), record_at);
+  }
+  catch (const std::runtime_error& e) {
+    return cb::Error(e.what(), pa::GENERIC_ERROR);
+  }
+
+  return cb::Error::Success;
+}
+
 cb::Error
 DataLoader::ParseData(
     const rapidjson::Document& json,
@@ -422,6 +527,21 @@ DataLoader::GetInputData(
   data.batch1_size = 0;
   data.is_valid = false;
 
+  if (binary_trace_) {
+    RETURN_IF_ERROR(ValidateIndexes(stream_id, step_id));
+
+    try {
+      const TensorData trace_data{
+          binary_trace_->GetInputData(input.name_, step_id)};
+      data.data_ptr = trace_data.data_ptr;
+      data.batch1_size = trace_data.batch1_size;
+      data.is_valid = trace_data.is_valid;
+    }
+    catch (const std::runtime_error& e) {
+      return cb::Error(e.what(), pa::GENERIC_ERROR);
+    }
+  }
+
   // If json data is available then try to retrieve the data from there
   if (!input_data_.empty()) {
     RETURN_IF_ERROR(ValidateIndexes(stream_id, step_id));
@@ -519,6 +639,11 @@ DataLoader::GetDatasetSize(const std::vector<std::string>& input_data_paths)
   size_t dataset_size{0};
 
   for (const auto& path : input_data_paths) {
+    if (BinaryTrace::IsBinaryTrace(path)) {
+      dataset_size += BinaryTrace(path).Size();
+      continue;
+    }
+
     FILE* fp{std::fopen(path.c_str(), "rb")};
 
     if (!fp) {
@@ -29,6 +29,7 @@
 #include <fstream>
 #include <unordered_set>
 
+#include "binary_trace.h"
 #include "model_parser.h"
 #include "perf_utils.h"
 #include "tensor_data.h"
@@ -91,6 +92,25 @@ class DataLoader {
       const std::shared_ptr<ModelTensorMap>& outputs,
       const std::string& json_file);
 
+  /// Maps the input data of the specified binary trace. The data is read in
+  /// place from the trace, as a single stream with one step per request.
+  /// \param inputs The pointer to the map holding the information about
+  /// input tensors of a model
+  /// \param trace_file The binary trace containing the user-provided input
+  /// data.
+  /// Returns error object indicating status
+  cb::Error ReadDataFromBinaryTrace(
+      const std::shared_ptr<ModelTensorMap>& inputs,
+      const std::string& trace_file);
+
+  /// Converts an OpenAI input data JSON with a single stream to a binary
+  /// trace.
+  /// \param json_file The input data JSON to convert.
+  /// \param trace_file The path of the binary trace to write.
+  /// Returns error object indicating status
+  static cb::Error ConvertToBinaryTrace(
+      const std::string& json_file, const std::string& trace_file);
+
   /// Generates the input data to use with the inference requests
   /// \param inputs The pointer to the map holding the information about
   /// input tensors of a model
@@ -239,6 +259,8 @@ class DataLoader {
 
   // User provided input data, it will be preferred over synthetic data
   std::unordered_map<std::string, std::vector<char>> input_data_;
+  // User provided input data mapped from a binary trace
+  std::shared_ptr<const BinaryTrace> binary_trace_;
   std::unordered_map<std::string, std::vector<int64_t>> input_shapes_;
 
   // User provided output data for validation
@@ -0,0 +1,331 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "goodput_search.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "perf_utils.h"
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+// Returns the value of the given 1-based order statistic of the histogram
+uint64_t
+ValueAtRank(const LatencyHistogram& latency_histogram, const uint64_t rank)
+{
+  const uint64_t count{latency_histogram.Count()};
+  if (count <= 1) {
+    return latency_histogram.ValueAtPercentile(0);
+  }
+  return latency_histogram.ValueAtPercentile(
+      100.0 * (rank - 1) / static_cast<double>(count - 1));
+}
+
+}  // namespace
+
+GoodputSlo
+GoodputSlo::Parse(const std::string& spec)
+{
+  GoodputSlo slo{};
+  bool has_latency{false};
+
+  for (const auto& arg : SplitString(spec, ",")) {
+    const auto [key, value_str]{SplitKeyValue(arg)};
+    const double value{ParseNumber(value_str)};
+
+    if (key.size() > 1 && key[0] == 'p') {
+      slo.percentile = ParseNumber(key.substr(1));
+      if (slo.percentile <= 0 || slo.percentile >= 100) {
+        throw std::invalid_argument(
+            "The latency percentile must be in range (0, 100).");
+      }
+      if (value <= 0) {
+        throw std::invalid_argument("The latency limit must be > 0.");
+      }
+      slo.latency_limit_ns = static_cast<uint64_t>(value * 1e6);
+      has_latency = true;
+    } else if (key == "error-rate") {
+      if (value < 0 || value >= 1) {
+        throw std::invalid_argument("The error rate must be in range [0, 1).");
+      }
+      slo.max_error_rate = value;
+    } else {
+      throw std::invalid_argument(
+          "Unsupported key '" + key +
+          "'. Choices are 'p<percentile>' or 'error-rate'.");
+    }
+  }
+
+  if (!has_latency) {
+    throw std::invalid_argument(
+        "The SLO requires a latency limit 'p<percentile>=<milliseconds>'.");
+  }
+  return slo;
+}
+
+GoodputSearch::GoodputSearch(
+    const GoodputSlo& slo, const double start, const double end,
+    const double precision, const bool integral,
+    const size_t max_windows_per_load)
+    : slo_(slo), end_(end),
+      precision_(integral ? std::max(precision, 1.0) : precision),
+      integral_(integral),
+      max_windows_per_load_(std::max<size_t>(max_windows_per_load, 1)),
+      next_load_(Round(start))
+{
+}
+
+void
+GoodputSearch::AddWindow(
+    const LatencyHistogram& latency_histogram, const uint64_t sent_count,
+    const uint64_t in_flight_start, const uint64_t in_flight_end,
+    const double duration_s)
+{
+  if (!next_load_) {
+    return;
+  }
+  const double load{*next_load_};
+  auto& probe{probes_[load]};
+  probe.latency_histogram.Merge(latency_histogram);
+  // Only the requests that had to complete within the window can miss their
+  // response
+  const uint64_t due_count{
+      sent_count + in_flight_start > in_flight_end
+          ? sent_count + in_flight_start - in_flight_end
+          : 0};
+  probe.sent_count += std::max(due_count, latency_histogram.Count());
+  probe.completed_count += latency_histogram.Count();
+  probe.duration_s += duration_s;
+  probe.num_windows++;
+  num_windows_++;
+
+  probe.verdict = Evaluate(load);
+  if (probe.verdict == SloVerdict::Inconclusive) {
+    if (probe.num_windows < max_windows_per_load_) {
+      // Measure the same load again
+      return;
+    }
+    // Out of windows, so go by the point estimates
+    const uint64_t latency{
+        probe.latency_histogram.ValueAtPercentile(slo_.percentile)};
+    const double error_rate{
+        probe.sent_count == 0
+            ? 0
+            : 1 - probe.completed_count /
+                      static_cast<double>(probe.sent_count)};
+    const bool meets{
+        !probe.latency_histogram.Empty() &&
+        latency < slo_.latency_limit_ns && error_rate <= slo_.max_error_rate};
+    probe.verdict = meets ? SloVerdict::Meets : SloVerdict::Violates;
+  }
+
+  Advance(load, probe.verdict);
+}
+
+void
+GoodputSearch::Advance(const double load, const SloVerdict verdict)
+{
+  if (verdict == SloVerdict::Meets) {
+    meets_ = load;
+  } else {
+    violates_ = load;
+  }
+
+  if (!refining_) {
+    if (verdict == SloVerdict::Meets) {
+      if (end_ > 0 && load >= end_) {
+        next_load_.reset();
+        return;
+      }
+      // Grow geometrically to find the knee in few probes
+      double next{Round(std::max(2 * load, load + precision_))};
+      if (end_ > 0) {
+        next = std::min(next, end_);
+      }
+      next_load_ = next;
+      return;
+    }
+    if (!meets_) {
+      // Even the start of the range violates the SLO
+      next_load_.reset();
+      return;
+    }
+    refining_ = true;
+  }
+
+  const double low{*meets_};
+  const double high{*violates_};
+  const double middle{Round((low + high) / 2)};
+  if (high - low <= precision_ || middle <= low || middle >= high) {
+    next_load_.reset();
+    return;
+  }
+  next_load_ = middle;
+}
+
+double
+GoodputSearch::Round(const double load) const
+{
+  return integral_ ? std::floor(load) : load;
+}
+
+std::pair<uint64_t, uint64_t>
+GoodputSearch::PercentileInterval(
+    const LatencyHistogram& latency_histogram, const double percentile)
+{
+  const double count{static_cast<double>(latency_histogram.Count())};
+  if (count == 0) {
+    return {0, std::numeric_limits<uint64_t>::max()};
+  }
+
+  // The ranks of the order statistics that bound the percentile, from the
+  // normal approximation of the binomial distribution of the number of
+  // latencies below it
+  const double quantile{percentile / 100};
+  const double center{count * quantile};
+  const double spread{
+      CONFIDENCE_Z * std::sqrt(count * quantile * (1 - quantile))};
+  const double low_rank{std::floor(center - spread)};
+  const double high_rank{std::ceil(center + spread) + 1};
+
+  const uint64_t low{
+      low_rank < 1 ? 0
+                   : ValueAtRank(
+                         latency_histogram, static_cast<uint64_t>(low_rank))};
+  const uint64_t high{
+      high_rank > count
+          ? std::numeric_limits<uint64_t>::max()
+          : ValueAtRank(latency_histogram, static_cast<uint64_t>(high_rank))};
+  return {low, high};
+}
+
+std::pair<double, double>
+GoodputSearch::ErrorRateInterval(
+    const uint64_t sent_count, const uint64_t completed_count)
+{
+  if (sent_count == 0) {
+    return {0, 1};
+  }
+  const double count{static_cast<double>(sent_count)};
+  const double rate{
+      1 - std::min(completed_count, sent_count) / static_cast<double>(count)};
+  const double z2{CONFIDENCE_Z * CONFIDENCE_Z};
+  const double denominator{1 + z2 / count};
+  const double center{(rate + z2 / (2 * count)) / denominator};
+  const double spread{
+      CONFIDENCE_Z / denominator *
+      std::sqrt(rate * (1 - rate) / count + z2 / (4 * count * count))};
+  return {std::max(0.0, center - spread), std::min(1.0, center + spread)};
+}
+
+SloBounds
+GoodputSearch::OwnBounds(const GoodputProbe& probe) const
+{
+  SloBounds bounds{};
+  std::tie(bounds.latency_low_ns, bounds.latency_high_ns) =
+      PercentileInterval(probe.latency_histogram, slo_.percentile);
+  std::tie(bounds.error_rate_low, bounds.error_rate_high) =
+      ErrorRateInterval(probe.sent_count, probe.completed_count);
+  return bounds;
+}
+
+SloBounds
+GoodputSearch::Bounds(const double load) const
+{
+  SloBounds bounds{};
+  for (const auto& [other_load, probe] : probes_) {
+    const SloBounds other{OwnBounds(probe)};
+    // A lower load can only have a lower latency and error rate, and a higher
+    // load a higher one
+    if (other_load <= load) {
+      bounds.latency_low_ns =
+          std::max(bounds.latency_low_ns, other.latency_low_ns);
+      bounds.error_rate_low =
+          std::max(bounds.error_rate_low, other.error_rate_low);
+    }
+    if (other_load >= load) {
+      bounds.latency_high_ns =
+          std::min(bounds.latency_high_ns, other.latency_high_ns);
+      bounds.error_rate_high =
+          std::min(bounds.error_rate_high, other.error_rate_high);
+    }
+  }
+  return bounds;
+}
+
+SloVerdict
+GoodputSearch::Evaluate(const double load) const
+{
+  const SloBounds bounds{Bounds(load)};
+  const bool limits_error_rate{slo_.max_error_rate < 1};
+
+  if (bounds.latency_low_ns >= slo_.latency_limit_ns ||
+      (limits_error_rate && bounds.error_rate_low > slo_.max_error_rate)) {
+    return SloVerdict::Violates;
+  }
+  if (bounds.latency_high_ns < slo_.latency_limit_ns &&
+      (!limits_error_rate || bounds.error_rate_high <= slo_.max_error_rate)) {
+    return SloVerdict::Meets;
+  }
+  return SloVerdict::Inconclusive;
+}
+
+GoodputSearchResult
+GoodputSearch::Result() const
+{
+  GoodputSearchResult result{};
+  result.num_windows = num_windows_;
+  if (!meets_) {
+    return result;
+  }
+
+  result.found = true;
+  result.max_load = *meets_;
+  result.next_load = violates_ ? *violates_ : *meets_;
+
+  const auto& probe{probes_.at(*meets_)};
+  result.latency_ns =
+      probe.latency_histogram.ValueAtPercentile(slo_.percentile);
+  result.bounds = OwnBounds(probe);
+
+  uint64_t good_count{0};
+  for (const auto& bucket : probe.latency_histogram.Buckets()) {
+    if (bucket.highest < slo_.latency_limit_ns) {
+      good_count += bucket.count;
+    }
+  }
+  if (probe.duration_s > 0) {
+    result.goodput = good_count / probe.duration_s;
+  }
+  return result;
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,195 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "latency_histogram.h"
+
+namespace triton { namespace perfanalyzer {
+
+/// A service level objective that a load must meet to count as sustainable
+struct GoodputSlo {
+  /// Parses a specification of the form
+  ///   p<percentile>=<milliseconds>[,error-rate=<fraction>]
+  /// \param spec The SLO specification.
+  /// \return The SLO.
+  /// \throws std::invalid_argument If the specification is not valid.
+  static GoodputSlo Parse(const std::string& spec);
+
+  // The latency percentile that the objective is set on
+  double percentile{99};
+  // The latency the percentile must stay below, in nanoseconds
+  uint64_t latency_limit_ns{0};
+  // The largest fraction of the requests due to complete during a probe that
+  // may end without a response. Requests still in flight at the end of the
+  // probe are not due yet.
+  double max_error_rate{1};
+};
+
+/// Whether a load meets the SLO, as far as the measurements tell with
+/// confidence
+enum class SloVerdict { Meets, Violates, Inconclusive };
+
+/// The measurements of one load, accumulated over all its probe windows
+struct GoodputProbe {
+  LatencyHistogram latency_histogram{};
+  uint64_t sent_count{0};
+  uint64_t completed_count{0};
+  double duration_s{0};
+  size_t num_windows{0};
+  SloVerdict verdict{SloVerdict::Inconclusive};
+};
+
+/// Confidence intervals of the quantities an SLO is set on
+struct SloBounds {
+  uint64_t latency_low_ns{0};
+  uint64_t latency_high_ns{std::numeric_limits<uint64_t>::max()};
+  double error_rate_low{0};
+  double error_rate_high{1};
+};
+
+struct GoodputSearchResult {
+  // Whether any load of the search range met the SLO
+  bool found{false};
+  // The highest load that met the SLO
+  double max_load{0};
+  // The lowest load above it that violated the SLO, which is the max load if
+  // the end of the search range met it
+  double next_load{0};
+  // The latency percentile of the SLO at the max load and its confidence
+  // interval, in nanoseconds
+  uint64_t latency_ns{0};
+  SloBounds bounds{};
+  // The rate of the requests completed within the latency limit at the max
+  // load, per second
+  double goodput{0};
+  // The number of probe windows measured
+  size_t num_windows{0};
+};
+
+/// Searches for the highest concurrency or request rate that meets a goodput
+/// SLO. The search first probes loads growing geometrically from the start of
+/// the range with short windows to find the knee, and then bisects between the
+/// last load that met the SLO and the first that violated it with full
+/// windows. A load is probed again, merging the new window into its
+/// histogram, until it meets or violates the SLO with confidence. Since
+/// latency and error rate only grow with the load, the confidence interval of
+/// every load is also narrowed by the probes of the loads next to it.
+///
+class GoodputSearch {
+ public:
+  /// The standard score of the two-sided 95% confidence intervals
+  static constexpr double CONFIDENCE_Z{1.96};
+
+  /// \param slo The SLO to meet.
+  /// \param start The load to start from.
+  /// \param end The highest load to probe, or 0 for no limit.
+  /// \param precision The width of the interval the knee is narrowed to.
+  /// \param integral Whether the load only takes whole numbers.
+  /// \param max_windows_per_load The number of windows after which a load is
+  /// judged by its point estimates if it is still inconclusive.
+  GoodputSearch(
+      const GoodputSlo& slo, const double start, const double end,
+      const double precision, const bool integral,
+      const size_t max_windows_per_load);
+
+  /// \return The load to measure the next window at, if the search is not
+  /// done
+  std::optional<double> NextLoad() const { return next_load_; }
+
+  /// \return Whether the search is refining the knee, where it measures full
+  /// windows instead of short ones
+  bool IsRefining() const { return refining_; }
+
+  /// Adds a measurement window of the load returned by NextLoad and moves the
+  /// search on
+  /// \param latency_histogram The latencies of the requests of the window.
+  /// \param sent_count The number of requests sent during the window.
+  /// \param in_flight_start The number of requests in flight at the start of
+  /// the window, which may complete during it.
+  /// \param in_flight_end The number of requests still in flight at the end of
+  /// the window, which are not counted as errors.
+  /// \param duration_s The duration of the window in seconds.
+  void AddWindow(
+      const LatencyHistogram& latency_histogram, const uint64_t sent_count,
+      const uint64_t in_flight_start, const uint64_t in_flight_end,
+      const double duration_s);
+
+  /// \return The result of the search so far
+  GoodputSearchResult Result() const;
+
+  /// Returns the confidence interval of a latency percentile
+  /// \param latency_histogram The latencies measured.
+  /// \param percentile The percentile between 0 and 100.
+  /// \return The low and high end of the interval. The high end is the largest
+  /// uint64_t if there are too few latencies to bound it.
+  static std::pair<uint64_t, uint64_t> PercentileInterval(
+      const LatencyHistogram& latency_histogram, const double percentile);
+
+  /// Returns the Wilson score interval of the error rate
+  /// \param sent_count The number of requests sent.
+  /// \param completed_count The number of them that completed.
+  /// \return The low and high end of the interval.
+  static std::pair<double, double> ErrorRateInterval(
+      const uint64_t sent_count, const uint64_t completed_count);
+
+ private:
+  /// \return The confidence intervals of the load from its own probe only
+  SloBounds OwnBounds(const GoodputProbe& probe) const;
+
+  /// \return The confidence intervals of the load, narrowed by the probes of
+  /// the loads below and above it
+  SloBounds Bounds(const double load) const;
+
+  SloVerdict Evaluate(const double load) const;
+
+  /// Picks the next load to probe after the given load got its verdict
+  void Advance(const double load, const SloVerdict verdict);
+
+  double Round(const double load) const;
+
+  const GoodputSlo slo_;
+  const double end_;
+  const double precision_;
+  const bool integral_;
+  const size_t max_windows_per_load_;
+
+  std::map<double, GoodputProbe> probes_{};
+  std::optional<double> next_load_{};
+  bool refining_{false};
+  // The highest load that met the SLO and the lowest that violated it
+  std::optional<double> meets_{};
+  std::optional<double> violates_{};
+  size_t num_windows_{0};
+};
+
+}}  // namespace triton::perfanalyzer
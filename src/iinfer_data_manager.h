@@ -31,6 +31,7 @@
 #include "infer_data.h"
 #include "model_parser.h"
 #include "perf_utils.h"
+#include "request_record.h"
 
 namespace triton { namespace perfanalyzer {
 
@@ -58,6 +59,16 @@ class IInferDataManager {
   virtual cb::Error UpdateInferData(
       size_t thread_id, int stream_index, int step_index,
       InferData& infer_data) = 0;
+
+  /// Gets the input data that a request for the given data step is sent
+  /// with, in the form it is recorded in the profile export
+  /// \param stream_index The data stream of the request
+  /// \param step_index The step index of the request
+  /// \param inputs Output parameter storing the data of each valid input
+  /// \return cb::Error object indicating success or failure.
+  virtual cb::Error GetRecordInputs(
+      int stream_index, int step_index,
+      RequestRecord::RequestInput& inputs) = 0;
 };
 
 }}  // namespace triton::perfanalyzer
@@ -26,6 +26,11 @@
 
 #include "infer_context.h"
 
+#include <charconv>
+#include <iterator>
+#include <limits>
+#include <utility>
+
 namespace triton { namespace perfanalyzer {
 
 void
@@ -47,17 +52,18 @@ InferContext::Init()
 }
 
 void
-InferContext::SendInferRequest(bool delayed)
+InferContext::SendInferRequest(bool delayed, uint64_t scheduled_ns)
 {
   // Update the inputs if required
   if (using_json_data_) {
     UpdateJsonData();
   }
-  SendRequest(request_id_++, delayed);
+  SendRequest(delayed, 0, scheduled_ns);
 }
 
 void
-InferContext::SendSequenceInferRequest(uint32_t seq_stat_index, bool delayed)
+InferContext::SendSequenceInferRequest(
+    uint32_t seq_stat_index, bool delayed, uint64_t scheduled_ns)
 {
   // Need lock to protect the order of dispatch across worker threads.
   // This also helps in reporting the realistic latencies.
@@ -75,8 +81,8 @@ InferContext::SendSequenceInferRequest(uint32_t seq_stat_index, bool delayed)
     sequence_manager_->DecrementRemainingQueries(seq_stat_index);
 
     SendRequest(
-        request_id_++, delayed,
-        sequence_manager_->GetSequenceID(seq_stat_index));
+        delayed, sequence_manager_->GetSequenceID(seq_stat_index),
+        scheduled_ns);
   }
 }
 
@@ -97,38 +103,58 @@ InferContext::CompleteOngoingSequence(uint32_t seq_stat_index)
     sequence_manager_->DecrementRemainingQueries(seq_stat_index);
 
     bool is_delayed = false;
-    SendRequest(
-        request_id_++, is_delayed,
-        sequence_manager_->GetSequenceID(seq_stat_index));
+    SendRequest(is_delayed, sequence_manager_->GetSequenceID(seq_stat_index));
   }
 }
 
 void
 InferContext::SendRequest(
-    const uint64_t request_id, const bool delayed, const uint64_t sequence_id)
+    const bool delayed, const uint64_t sequence_id, const uint64_t scheduled_ns)
 {
   if (!thread_stat_->status_.IsOk()) {
     return;
   }
 
   thread_stat_->num_sent_requests_++;
-
-  // Parse the request inputs to save in the profile export file
-  RequestRecord::RequestInput request_inputs{GetInputs()};
+  thread_stat_->num_in_flight_requests_++;
 
   if (async_) {
-    uint64_t unique_request_id{(thread_id_ << 48) | ((request_id << 16) >> 16)};
-    infer_data_.options_->request_id_ = std::to_string(unique_request_id);
+    uint32_t slot{0};
+    CompletionAwaiter* awaiter{std::exchange(pending_awaiter_, nullptr)};
     {
       std::lock_guard<std::mutex> lock(thread_stat_->mu_);
-      auto it = async_req_map_
-                    .emplace(infer_data_.options_->request_id_, RequestRecord())
-                    .first;
-      it->second.request_inputs_ = {request_inputs};
-      it->second.start_time_ = std::chrono::system_clock::now();
-      it->second.sequence_end_ = infer_data_.options_->sequence_end_;
-      it->second.delayed_ = delayed;
-      it->second.sequence_id_ = sequence_id;
+      slot = AcquireAsyncSlot();
+      async_slots_[slot].awaiter = awaiter;
+
+      // The responses of a request are matched to its slot through the
+      // request id, which is the only field every protocol echoes back. The
+      // id stays unique across the run for the server logs and traces: the
+      // thread, the context and the count of requests of the context come
+      // before the slot number. The id string keeps its capacity, so only the
+      // first request of the context allocates
+      const uint64_t request_id_fields[]{
+          thread_id_, id_, num_sent_async_requests_++, slot};
+      char request_id[std::size(request_id_fields) *
+                      (std::numeric_limits<uint64_t>::digits10 + 2)];
+      char* request_id_end{request_id};
+      for (const uint64_t field : request_id_fields) {
+        if (request_id_end != request_id) {
+          *request_id_end++ = '-';
+        }
+        request_id_end =
+            std::to_chars(
+                request_id_end, request_id + sizeof(request_id), field)
+                .ptr;
+      }
+      infer_data_.options_->request_id_.assign(request_id, request_id_end);
+
+      auto& record{async_slots_[slot].record};
+      record.Reset(infer_data_.options_->sequence_end_, delayed, sequence_id);
+      record.SetScheduledNs(scheduled_ns);
+      record.SetOutputCapture(output_capture_sampler_.Next());
+      // The request inputs are resolved from the dataset when exported
+      record.SetInputRef(input_ref_.stream_id, input_ref_.step_id);
+      record.SetStartNs(CHRONO_TO_NANOS(std::chrono::system_clock::now()));
     }
 
     thread_stat_->idle_timer.Start();
@@ -144,21 +170,37 @@ InferContext::SendRequest(
     thread_stat_->idle_timer.Stop();
 
     total_ongoing_requests_++;
+
+    if (awaiter != nullptr) {
+      if (thread_stat_->status_.IsOk()) {
+        awaiter->Started();
+      } else {
+        // No response will arrive, so the coroutine continues right away
+        std::lock_guard<std::mutex> lock(thread_stat_->mu_);
+        async_slots_[slot].awaiter = nullptr;
+      }
+    }
   } else {
+    sync_record_.Reset(
+        infer_data_.options_->sequence_end_, delayed, sequence_id);
+    sync_record_.SetScheduledNs(scheduled_ns);
+    sync_record_.SetOutputCapture(output_capture_sampler_.Next());
+    // The request inputs are resolved from the dataset when exported
+    sync_record_.SetInputRef(input_ref_.stream_id, input_ref_.step_id);
+
     cb::InferResult* results = nullptr;
     thread_stat_->idle_timer.Start();
-    auto start_time_sync = std::chrono::system_clock::now();
+    sync_record_.SetStartNs(CHRONO_TO_NANOS(std::chrono::system_clock::now()));
     thread_stat_->status_ = infer_backend_->Infer(
         &results, *(infer_data_.options_), infer_data_.valid_inputs_,
         infer_data_.outputs_);
     thread_stat_->idle_timer.Stop();
-    std::vector<std::chrono::time_point<std::chrono::system_clock>>
-        response_timestamps{std::chrono::system_clock::now()};
-    RequestRecord::ResponseOutput response_outputs{};
+    sync_record_.AddResponse(
+        CHRONO_TO_NANOS(std::chrono::system_clock::now()), false);
 
     if (results != nullptr) {
       if (thread_stat_->status_.IsOk()) {
-        response_outputs = GetOutputs(*results);
+        AddOutputs(*results, sync_record_);
         thread_stat_->status_ = ValidateOutputs(results);
       }
       delete results;
@@ -167,13 +209,10 @@ InferContext::SendRequest(
       return;
     }
     {
-      // Add the request record to thread request records vector with proper
-      // locking
+      // Add the request record to thread request records with proper locking
       std::lock_guard<std::mutex> lock(thread_stat_->mu_);
-      thread_stat_->request_records_.emplace_back(RequestRecord(
-          start_time_sync, std::move(response_timestamps), {request_inputs},
-          {response_outputs}, infer_data_.options_->sequence_end_, delayed,
-          sequence_id, false));
+      thread_stat_->request_records_.Append(sync_record_);
+      thread_stat_->num_in_flight_requests_--;
       thread_stat_->status_ =
           infer_backend_->ClientInferStat(&(thread_stat_->contexts_stat_[id_]));
       if (!thread_stat_->status_.IsOk()) {
@@ -183,48 +222,42 @@ InferContext::SendRequest(
   }
 }
 
-const RequestRecord::RequestInput
-InferContext::GetInputs()
+void
+InferContext::AddOutputs(
+    const cb::InferResult& infer_result, RequestRecordBuilder& record)
 {
-  RequestRecord::RequestInput input{};
-  for (const auto& request_input : infer_data_.valid_inputs_) {
-    std::string data_type{request_input->Datatype()};
+  const OutputCapturePolicy capture{record.GetOutputCapture()};
+  // Skip reading the outputs from the result entirely when they aren't kept
+  if (capture == OutputCapturePolicy::None) {
+    return;
+  }
+
+  for (const auto& requested_output : infer_data_.outputs_) {
+    const std::string& data_type{requested_output->Datatype()};
+    // Read the output in place when the result can lend it, and only copy it
+    // out otherwise
     const uint8_t* buf{nullptr};
     size_t byte_size{0};
-    request_input->RawData(&buf, &byte_size);
-
-    // The first 4 bytes of BYTES data is a 32-bit integer to indicate the size
-    // of the rest of the data (which we already know based on byte_size). It
-    // should be ignored here, as it isn't part of the actual request
+    if (!infer_result.RawData(requested_output->Name(), &buf, &byte_size)
+             .IsOk()) {
+      infer_result.RawData(requested_output->Name(), output_buf_);
+      buf = output_buf_.data();
+      byte_size = output_buf_.size();
+    }
     if (data_type == "BYTES" && byte_size >= 4) {
       buf += 4;
       byte_size -= 4;
     }
-    std::vector<uint8_t> buf_vec(buf, buf + byte_size);
-
-    input.emplace(
-        request_input->Name(), RecordData(std::move(buf_vec), data_type));
-  }
-  return input;
-}
-
-const RequestRecord::ResponseOutput
-InferContext::GetOutputs(const cb::InferResult& infer_result)
-{
-  RequestRecord::ResponseOutput output{};
-  for (const auto& requested_output : infer_data_.outputs_) {
-    std::string data_type{requested_output->Datatype()};
-    std::vector<uint8_t> buf{};
-    infer_result.RawData(requested_output->Name(), buf);
 
-    if (data_type == "BYTES" && buf.size() >= 4) {
-      buf.erase(buf.begin(), buf.begin() + 4);
+    const uint32_t name_id{RecordStringTable::Intern(requested_output->Name())};
+    const uint32_t data_type_id{RecordStringTable::Intern(data_type)};
+    if (capture == OutputCapturePolicy::Hash) {
+      record.AddOutputHash(
+          name_id, data_type_id, HashOutputData(buf, byte_size), byte_size);
+    } else {
+      record.AddOutput(name_id, data_type_id, buf, byte_size);
     }
-
-    output.emplace(
-        requested_output->Name(), RecordData(std::move(buf), data_type));
   }
-  return output;
 }
 
 void
@@ -232,6 +265,7 @@ InferContext::UpdateJsonData()
 {
   int step_id = (data_step_id_ * batch_size_) % data_loader_->GetTotalSteps(0);
   data_step_id_ += GetNumActiveThreads();
+  input_ref_ = {0, step_id};
   thread_stat_->status_ =
       infer_data_manager_->UpdateInferData(thread_id_, 0, step_id, infer_data_);
 }
@@ -247,6 +281,7 @@ InferContext::UpdateSeqJsonData(size_t seq_stat_index)
       sequence_manager_->GetDataStreamID(seq_stat_index)};
   const size_t total_steps{data_loader_->GetTotalSteps(data_stream_id)};
   int step_id = (sequence_length - remaining_queries) % total_steps;
+  input_ref_ = {static_cast<int32_t>(data_stream_id), step_id};
   thread_stat_->status_ = infer_data_manager_->UpdateInferData(
       thread_id_, data_stream_id, step_id, infer_data_);
 }
@@ -289,11 +324,69 @@ InferContext::ValidateOutputs(const cb::InferResult* result_ptr)
   return cb::Error::Success;
 }
 
+uint32_t
+InferContext::AcquireAsyncSlot()
+{
+  uint32_t slot{0};
+  if (free_async_slots_.empty()) {
+    slot = async_slots_.size();
+    async_slots_.emplace_back();
+  } else {
+    slot = free_async_slots_.back();
+    free_async_slots_.pop_back();
+  }
+  async_slots_[slot].in_flight = true;
+  return slot;
+}
+
+InferContext::AsyncSlot*
+InferContext::FindAsyncSlot(const std::string& request_id)
+{
+  // Only the slot number at the end of the id is needed
+  const size_t slot_pos{request_id.rfind('-') + 1};
+  uint32_t slot{0};
+  const char* end{request_id.data() + request_id.size()};
+  const auto from_chars_result{
+      std::from_chars(request_id.data() + slot_pos, end, slot)};
+  if (from_chars_result.ec != std::errc() || from_chars_result.ptr != end ||
+      slot >= async_slots_.size() || !async_slots_[slot].in_flight) {
+    return nullptr;
+  }
+  return &async_slots_[slot];
+}
+
+uint64_t
+InferContext::ResponseTimestampNs(const cb::InferResult& result) const
+{
+  // Only the OpenAI client backend reports the receive time of each response,
+  // which is earlier than the callback when a chunk completes several of them
+  if (infer_backend_->Kind() == cb::BackendKind::OPENAI) {
+    std::vector<std::chrono::time_point<std::chrono::system_clock>> timestamps;
+    if (result.ResponseTimestamps(&timestamps).IsOk() && !timestamps.empty()) {
+      return CHRONO_TO_NANOS(timestamps.back());
+    }
+  }
+  return CHRONO_TO_NANOS(std::chrono::system_clock::now());
+}
+
+CompletionAwaiter*
+InferContext::TakeFailedRequestAwaiter(const cb::InferResult& result)
+{
+  std::string request_id;
+  if (!result.Id(&request_id).IsOk()) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(thread_stat_->mu_);
+  AsyncSlot* slot{FindAsyncSlot(request_id)};
+  return slot != nullptr ? std::exchange(slot->awaiter, nullptr) : nullptr;
+}
+
 void
 InferContext::AsyncCallbackFuncImpl(cb::InferResult* result)
 {
   std::shared_ptr<cb::InferResult> result_ptr(result);
   bool is_final_response{true};
+  CompletionAwaiter* awaiter{nullptr};
   if (thread_stat_->cb_status_.IsOk()) {
     // Add the request record to thread request records vector with
     // proper locking
@@ -302,21 +395,18 @@ InferContext::AsyncCallbackFuncImpl(cb::InferResult* result)
     if (thread_stat_->cb_status_.IsOk()) {
       std::string request_id;
       thread_stat_->cb_status_ = result_ptr->Id(&request_id);
-      const auto& it = async_req_map_.find(request_id);
-      if (it != async_req_map_.end()) {
+      AsyncSlot* slot{FindAsyncSlot(request_id)};
+      if (slot != nullptr) {
+        auto& record{slot->record};
         bool is_null_response{false};
         thread_stat_->cb_status_ =
             result_ptr->IsNullResponse(&is_null_response);
         if (thread_stat_->cb_status_.IsOk() == false) {
           return;
         }
-        it->second.response_timestamps_.push_back(
-            std::chrono::system_clock::now());
-        it->second.response_outputs_.push_back(GetOutputs(*result));
+        record.AddResponse(ResponseTimestampNs(*result), is_null_response);
+        AddOutputs(*result, record);
         num_responses_++;
-        if (is_null_response == true) {
-          it->second.has_null_last_response_ = true;
-        }
         thread_stat_->cb_status_ =
             result_ptr->IsFinalResponse(&is_final_response);
         if (thread_stat_->cb_status_.IsOk() == false) {
@@ -324,19 +414,23 @@ InferContext::AsyncCallbackFuncImpl(cb::InferResult* result)
         }
         if (is_final_response) {
           has_received_final_response_ = is_final_response;
-          thread_stat_->request_records_.emplace_back(
-              it->second.start_time_, it->second.response_timestamps_,
-              it->second.request_inputs_, it->second.response_outputs_,
-              it->second.sequence_end_, it->second.delayed_,
-              it->second.sequence_id_, it->second.has_null_last_response_);
+          thread_stat_->request_records_.Append(record);
+          thread_stat_->num_in_flight_requests_--;
           infer_backend_->ClientInferStat(&(thread_stat_->contexts_stat_[id_]));
           thread_stat_->cb_status_ = ValidateOutputs(result);
-          async_req_map_.erase(request_id);
+          awaiter = std::exchange(slot->awaiter, nullptr);
+          slot->in_flight = false;
+          free_async_slots_.push_back(slot - async_slots_.data());
         }
       }
     }
   }
 
+  if (is_final_response && awaiter == nullptr &&
+      !thread_stat_->cb_status_.IsOk()) {
+    awaiter = TakeFailedRequestAwaiter(*result_ptr);
+  }
+
   if (worker_callback_) {
     worker_callback_(id_);
   }
@@ -348,7 +442,34 @@ InferContext::AsyncCallbackFuncImpl(cb::InferResult* result)
     if (async_callback_finalize_func_ != nullptr) {
       async_callback_finalize_func_(id_);
     }
+    if (awaiter != nullptr) {
+      awaiter->Complete();
+    }
+  }
+}
+
+void
+InferContext::SendAwaitedRequest(
+    CompletionAwaiter& awaiter, std::optional<uint32_t> seq_stat_index)
+{
+  pending_awaiter_ = &awaiter;
+  if (seq_stat_index) {
+    SendSequenceInferRequest(*seq_stat_index);
+  } else {
+    SendInferRequest();
   }
+  // Left over when no async request was sent
+  pending_awaiter_ = nullptr;
+}
+
+Task
+InferContext::RunSequence(CoroutineExecutor& executor, uint32_t seq_stat_index)
+{
+  do {
+    co_await AsyncSequenceInfer(executor, seq_stat_index);
+  } while (sequence_manager_->GetRemainingQueries(seq_stat_index) != 0 &&
+           !early_exit && execute_ && thread_stat_->status_.IsOk() &&
+           thread_stat_->cb_status_.IsOk());
 }
 
 }}  // namespace triton::perfanalyzer
@@ -29,15 +29,18 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 #include "client_backend/client_backend.h"
+#include "coroutine_executor.h"
 #include "data_loader.h"
 #include "idle_timer.h"
 #include "iinfer_data_manager.h"
 #include "infer_data.h"
+#include "output_capture.h"
 #include "perf_utils.h"
-#include "request_record.h"
+#include "request_record_store.h"
 #include "sequence_manager.h"
 #include "thread_stat.h"
 
@@ -82,15 +85,53 @@ class InferContext {
   // Initialize the context. Must be done before any inferences are sent
   void Init();
 
-  // Send a single inference request to the server
-  void SendInferRequest(bool delayed = false);
+  // Send a single inference request to the server. scheduled_ns is when the
+  // request was due to be sent, or 0 if it isn't sent on a schedule
+  void SendInferRequest(bool delayed = false, uint64_t scheduled_ns = 0);
 
   // Send a single sequence inference request to the server
-  void SendSequenceInferRequest(uint32_t seq_index, bool delayed = false);
+  void SendSequenceInferRequest(
+      uint32_t seq_index, bool delayed = false, uint64_t scheduled_ns = 0);
 
   // Finish the active sequence at the given seq_stat_index
   void CompleteOngoingSequence(uint32_t seq_stat_index);
 
+  /// Send a request from a coroutine, which is resumed on the executor once
+  /// the final response of the request has arrived. If no request could be
+  /// sent, or the context is synchronous, the coroutine continues right away.
+  /// Only one coroutine may send on a context at a time.
+  /// \param executor The executor the coroutine is resumed on.
+  /// \return The awaitable request.
+  CompletionAwaiter AsyncInfer(CoroutineExecutor& executor)
+  {
+    return CompletionAwaiter{executor, [this](CompletionAwaiter& awaiter) {
+                               SendAwaitedRequest(awaiter, std::nullopt);
+                             }};
+  }
+
+  /// Send the next request of the sequence at seq_stat_index from a
+  /// coroutine, which is resumed once it has completed.
+  /// \param executor The executor the coroutine is resumed on.
+  /// \param seq_stat_index The index of the sequence.
+  /// \return The awaitable request.
+  CompletionAwaiter AsyncSequenceInfer(
+      CoroutineExecutor& executor, uint32_t seq_stat_index)
+  {
+    return CompletionAwaiter{
+        executor, [this, seq_stat_index](CompletionAwaiter& awaiter) {
+          SendAwaitedRequest(awaiter, seq_stat_index);
+        }};
+  }
+
+  /// Send the requests of one whole sequence one after another, each once the
+  /// previous one has completed. Stops early if the context is paused or
+  /// perf_analyzer is exiting, in which case CompleteOngoingSequence() ends
+  /// the sequence.
+  /// \param executor The executor the coroutine runs on.
+  /// \param seq_stat_index The index of the sequence.
+  /// \return The coroutine, which starts once it is awaited or spawned.
+  Task RunSequence(CoroutineExecutor& executor, uint32_t seq_stat_index);
+
   // Returns the total number of async requests that have been sent by this
   // object and have not returned
   uint GetNumOngoingRequests() { return total_ongoing_requests_; }
@@ -117,15 +158,23 @@ class InferContext {
 
   bool HasReceivedFinalResponse() { return has_received_final_response_; }
 
+  // Set how the response outputs of the requests are recorded
+  void SetOutputCapture(const OutputCapture& output_capture)
+  {
+    output_capture_sampler_ =
+        OutputCaptureSampler(output_capture, (thread_id_ << 32) | id_);
+  }
+
  protected:
   /// A helper function to issue inference request to the server.
-  /// \param request_id The unique id to be associated with the request.
   /// \param delayed Whether the request fell behind its scheduled time.
   /// \param sequence_id Sequence ID of the request. Note that the default of
   /// `0` means the request is not a sequence.
+  /// \param scheduled_ns The timestamp of when the request was scheduled to be
+  /// sent. Note that the default of `0` means the request has no schedule.
   virtual void SendRequest(
-      const uint64_t request_id, const bool delayed,
-      const uint64_t sequence_id = 0);
+      const bool delayed, const uint64_t sequence_id = 0,
+      const uint64_t scheduled_ns = 0);
 
   /// Update inputs based on custom json data
   void UpdateJsonData();
@@ -150,10 +199,52 @@ class InferContext {
   std::shared_ptr<cb::ClientBackendFactory> factory_;
   std::shared_ptr<IInferDataManager> infer_data_manager_;
 
-  uint64_t request_id_ = 0;
-  std::map<std::string, RequestRecord> async_req_map_;
+  /// The record of an in-flight async request
+  struct AsyncSlot {
+    RequestRecordBuilder record;
+    bool in_flight{false};
+    // The coroutine request waiting for the request to complete, if any
+    CompletionAwaiter* awaiter{nullptr};
+  };
+
+  /// Claims a free slot for a new async request
+  uint32_t AcquireAsyncSlot();
+
+  /// Returns the in-flight slot that the given request id refers to, or
+  /// nullptr if there is none
+  AsyncSlot* FindAsyncSlot(const std::string& request_id);
+
+  /// Takes the coroutine request waiting for a request that failed, which
+  /// still has to be resumed
+  CompletionAwaiter* TakeFailedRequestAwaiter(const cb::InferResult& result);
+
+  /// Sends the request of a coroutine, which awaits it through the given
+  /// awaiter, or the next request of the sequence at seq_stat_index if set
+  void SendAwaitedRequest(
+      CompletionAwaiter& awaiter, std::optional<uint32_t> seq_stat_index);
+
+  /// Returns when the response was received, as reported by the client
+  /// backend if it reports it, or the current time otherwise
+  uint64_t ResponseTimestampNs(const cb::InferResult& result) const;
+
+  // The coroutine request that the next SendRequest() is sent for
+  CompletionAwaiter* pending_awaiter_{nullptr};
+
+  // Table of the async requests of this context, indexed by the slot number
+  // that ends the request id. Slots are recycled through
+  // free_async_slots_ so that their records keep their capacity across
+  // requests, and the table only grows up to the peak number of requests in
+  // flight.
+  std::vector<AsyncSlot> async_slots_;
+  std::vector<uint32_t> free_async_slots_;
+  // Count of the async requests sent by this context, which keeps the request
+  // ids unique while the slots are reused
+  uint64_t num_sent_async_requests_{0};
   std::atomic<uint> total_ongoing_requests_{0};
   size_t data_step_id_;
+  // The dataset entry that the current inputs were taken from. Inputs that
+  // don't come from custom json data are always taken from the first step
+  RecordInputRef input_ref_{0, 0};
 
   // Function pointer to the async callback function implementation
   std::function<void(cb::InferResult*)> async_callback_func_ = std::bind(
@@ -163,10 +254,14 @@ class InferContext {
   std::function<void(uint32_t)> async_callback_finalize_func_ = nullptr;
 
  private:
-  const RequestRecord::RequestInput GetInputs();
-
-  const RequestRecord::ResponseOutput GetOutputs(
-      const cb::InferResult& infer_result);
+  void AddOutputs(
+      const cb::InferResult& infer_result, RequestRecordBuilder& record);
+
+  // Reused record of the in-flight sync request
+  RequestRecordBuilder sync_record_;
+  // Scratch buffer that response outputs are read into
+  std::vector<uint8_t> output_buf_;
+  OutputCaptureSampler output_capture_sampler_{};
 
   const uint32_t id_{0};
   const size_t thread_id_{0};
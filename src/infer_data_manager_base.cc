@@ -134,6 +134,44 @@ InferDataManagerBase::UpdateInferData(
   return cb::Error::Success;
 }
 
+cb::Error
+InferDataManagerBase::GetRecordInputs(
+    int stream_index, int step_index, RequestRecord::RequestInput& inputs)
+{
+  RETURN_IF_ERROR(data_loader_->ValidateIndexes(stream_index, step_index));
+
+  inputs.clear();
+  for (const auto& [name, tensor] : *(parser_->Inputs())) {
+    std::vector<TensorData> input_datas;
+    RETURN_IF_ERROR(
+        GetInputData(name, tensor, stream_index, step_index, input_datas));
+
+    // Optional inputs without data are not sent with the request
+    const bool is_valid{std::all_of(
+        input_datas.begin(), input_datas.end(),
+        [](const TensorData& input_data) { return input_data.is_valid; })};
+    if (input_datas.empty() || !is_valid) {
+      continue;
+    }
+
+    std::vector<uint8_t> data;
+    for (const auto& input_data : input_datas) {
+      data.insert(
+          data.end(), input_data.data_ptr,
+          input_data.data_ptr + input_data.batch1_size);
+    }
+
+    // The first 4 bytes of BYTES data is a 32-bit integer to indicate the size
+    // of the rest of the data. It isn't part of the actual request
+    if (tensor.datatype_ == "BYTES" && data.size() >= 4) {
+      data.erase(data.begin(), data.begin() + 4);
+    }
+
+    inputs.emplace(name, RecordData(std::move(data), tensor.datatype_));
+  }
+  return cb::Error::Success;
+}
+
 cb::Error
 InferDataManagerBase::UpdateValidationOutputs(
     int stream_index, int step_index, InferData& infer_data)
@@ -69,6 +69,16 @@ class InferDataManagerBase : public IInferDataManager {
       size_t thread_id, int stream_index, int step_index,
       InferData& infer_data) override;
 
+  /// Gets the input data that a request for the given data step is sent
+  /// with, in the form it is recorded in the profile export
+  /// \param stream_index The data stream of the request
+  /// \param step_index The step index of the request
+  /// \param inputs Output parameter storing the data of each valid input
+  /// \return cb::Error object indicating success or failure.
+  cb::Error GetRecordInputs(
+      int stream_index, int step_index,
+      RequestRecord::RequestInput& inputs) override;
+
  protected:
   size_t batch_size_;
   std::shared_ptr<ModelParser> parser_;
@@ -48,6 +48,8 @@ to_string(InferenceLoadMode inference_load_mode)
       return "None";
     case InferenceLoadMode::Concurrency:
       return "Concurrency";
+    case InferenceLoadMode::RequestRate:
+      return "RequestRate";
     case InferenceLoadMode::CustomIntervals:
       return "CustomIntervals";
     case InferenceLoadMode::PeriodicConcurrency:
@@ -338,7 +338,8 @@ ReportClientSideStats(
     const cb::ProtocolType protocol, const bool verbose,
     const bool on_sequence_model, const bool include_lib_stats,
     const double overhead_pct, const double send_request_rate,
-    const bool is_decoupled_model)
+    const LatencyHistogram& schedule_skew,
+    const uint64_t record_handoff_wait_ns, const bool is_decoupled_model)
 {
   const uint64_t avg_latency_us = stats.avg_latency_ns / 1000;
   const uint64_t std_us = stats.std_us;
@@ -398,6 +399,13 @@ ReportClientSideStats(
                  "desired request rate. ";
     std::cout << delay_pct << "% of the requests were delayed. " << std::endl;
   }
+  if (!schedule_skew.Empty() && (verbose || delay_pct > DELAY_PCT_THRESHOLD)) {
+    std::cout << "    Send schedule skew: p50 "
+              << (schedule_skew.ValueAtPercentile(50) / 1000) << " usec, p90 "
+              << (schedule_skew.ValueAtPercentile(90) / 1000) << " usec, p99 "
+              << (schedule_skew.ValueAtPercentile(99) / 1000) << " usec, max "
+              << (schedule_skew.Max() / 1000) << " usec" << std::endl;
+  }
   if (on_sequence_model) {
     std::cout << "    Sequence count: " << stats.sequence_count << " ("
               << stats.sequence_per_sec << " seq/sec)" << std::endl;
@@ -414,6 +422,8 @@ ReportClientSideStats(
     client_overhead << "    " << "Avg client overhead: " << std::fixed
                     << std::setprecision(2) << overhead_pct << "%";
     std::cout << client_overhead.str() << std::endl;
+    std::cout << "    Record hand-off wait: " << (record_handoff_wait_ns / 1000)
+              << " usec" << std::endl;
   }
 
   if (percentile == -1) {
@@ -425,8 +435,27 @@ ReportClientSideStats(
               << " latency: " << (percentile.second / 1000) << " usec"
               << std::endl;
   }
+  if (!stats.percentile_corrected_latency_ns.empty()) {
+    if (percentile == -1) {
+      std::cout << "    Avg schedule-corrected latency: "
+                << (stats.avg_corrected_latency_ns / 1000) << " usec"
+                << std::endl;
+    }
+    for (const auto& percentile : stats.percentile_corrected_latency_ns) {
+      std::cout << "    p" << percentile.first
+                << " schedule-corrected latency: " << (percentile.second / 1000)
+                << " usec" << std::endl;
+    }
+  }
 
   std::cout << client_library_detail << std::endl;
+  if (include_lib_stats &&
+      (stats.new_connection_count + stats.reused_connection_count) > 0) {
+    std::cout << "    Connections: " << stats.new_connection_count
+              << " new (avg setup " << (stats.avg_connect_time_ns / 1000)
+              << " usec), " << stats.reused_connection_count << " reused"
+              << std::endl;
+  }
 
   return cb::Error::Success;
 }
@@ -443,7 +472,9 @@ Report(
   ReportClientSideStats(
       summary.client_stats, percentile, protocol, verbose,
       summary.on_sequence_model, include_lib_stats, summary.overhead_pct,
-      summary.send_request_rate, parser->IsDecoupled());
+      summary.send_request_rate, summary.schedule_skew,
+      summary.record_handoff_wait_ns,
+      parser->IsDecoupled());
 
   if (include_server_stats) {
     std::cout << "  Server: " << std::endl;
@@ -463,6 +494,23 @@ Report(
   return cb::Error::Success;
 }
 
+// Reports how late the requests of a replayed fixed schedule were sent. The
+// lateness of each request is in the profile export as the difference of its
+// timestamp and scheduled timestamp.
+void
+ReportReplayLateness(const LatencyHistogram& schedule_skew)
+{
+  if (schedule_skew.Empty()) {
+    return;
+  }
+  std::cout << "  Replay lateness: avg " << (schedule_skew.Mean() / 1000)
+            << " usec, p50 " << (schedule_skew.ValueAtPercentile(50) / 1000)
+            << " usec, p90 " << (schedule_skew.ValueAtPercentile(90) / 1000)
+            << " usec, p99 " << (schedule_skew.ValueAtPercentile(99) / 1000)
+            << " usec, max " << (schedule_skew.Max() / 1000) << " usec"
+            << std::endl;
+}
+
 }  // namespace
 
 cb::Error
@@ -479,7 +527,8 @@ InferenceProfiler::Create(
     const bool should_collect_metrics, const double overhead_pct_threshold,
     const bool async_mode,
     const std::shared_ptr<ProfileDataCollector> collector,
-    const bool should_collect_profile_data)
+    const bool should_collect_profile_data,
+    const uint32_t latency_histogram_precision)
 {
   std::unique_ptr<InferenceProfiler> local_profiler(new InferenceProfiler(
       verbose, stability_threshold, measurement_window_ms, max_trials,
@@ -487,7 +536,7 @@ InferenceProfiler::Create(
       profile_backend, std::move(manager), measurement_request_count,
       measurement_mode, mpi_driver, metrics_interval_ms, should_collect_metrics,
       overhead_pct_threshold, async_mode, collector,
-      should_collect_profile_data));
+      should_collect_profile_data, latency_histogram_precision));
 
   *profiler = std::move(local_profiler);
   return cb::Error::Success;
@@ -505,7 +554,8 @@ InferenceProfiler::InferenceProfiler(
     const uint64_t metrics_interval_ms, const bool should_collect_metrics,
     const double overhead_pct_threshold, const bool async_mode,
     const std::shared_ptr<ProfileDataCollector> collector,
-    const bool should_collect_profile_data)
+    const bool should_collect_profile_data,
+    const uint32_t latency_histogram_precision)
     : verbose_(verbose), measurement_window_ms_(measurement_window_ms),
       max_trials_(max_trials), extra_percentile_(extra_percentile),
       percentile_(percentile), latency_threshold_ms_(latency_threshold_ms_),
@@ -516,7 +566,8 @@ InferenceProfiler::InferenceProfiler(
       should_collect_metrics_(should_collect_metrics),
       overhead_pct_threshold_(overhead_pct_threshold), async_mode_(async_mode),
       collector_(collector),
-      should_collect_profile_data_(should_collect_profile_data)
+      should_collect_profile_data_(should_collect_profile_data),
+      latency_histogram_precision_(latency_histogram_precision)
 {
   load_parameters_.stability_threshold = stability_threshold;
   load_parameters_.stability_window = 3;
@@ -652,6 +703,9 @@ InferenceProfiler::Profile(
         std::cerr << err;
         meets_threshold = false;
       }
+      if (custom_manager) {
+        ReportReplayLateness(perf_status.schedule_skew);
+      }
     }
   } else {
     return err;
@@ -709,6 +763,126 @@ InferenceProfiler::Profile(
   return cb::Error::Success;
 }
 
+cb::Error
+InferenceProfiler::Probe(
+    const size_t concurrent_request_count, const bool change_load,
+    const bool full_window, PerfStatus& status_summary)
+{
+  status_summary.concurrency = concurrent_request_count;
+  if (change_load) {
+    std::cout << "Probing concurrency: " << concurrent_request_count
+              << std::endl;
+    RETURN_IF_ERROR(
+        dynamic_cast<ConcurrencyManager*>(manager_.get())
+            ->ChangeConcurrencyLevel(concurrent_request_count));
+  }
+  return ProbeWindow(change_load, full_window, status_summary);
+}
+
+cb::Error
+InferenceProfiler::Probe(
+    const double request_rate, const bool change_load, const bool full_window,
+    PerfStatus& status_summary)
+{
+  status_summary.request_rate = request_rate;
+  if (change_load) {
+    std::cout << "Probing request rate: " << request_rate
+              << " inference requests per second" << std::endl;
+    RETURN_IF_ERROR(dynamic_cast<RequestRateManager*>(manager_.get())
+                        ->ChangeRequestRate(request_rate));
+  }
+  return ProbeWindow(change_load, full_window, status_summary);
+}
+
+cb::Error
+InferenceProfiler::ProbeWindow(
+    const bool change_load, const bool full_window, PerfStatus& status_summary)
+{
+  if (change_load) {
+    all_request_records_.clear();
+    RequestRecordStore empty_request_records;
+    RETURN_IF_ERROR(manager_->SwapRequestRecords(empty_request_records));
+  }
+  // Every window is measured from its own start, since the search does not
+  // keep the windows of a load back to back
+  previous_window_end_ns_ = 0;
+
+  RETURN_IF_ERROR(manager_->CheckHealth());
+
+  MeasureConfig measure_config;
+  if (measurement_mode_ == MeasurementMode::TIME_WINDOWS) {
+    measure_config.measurement_window = measurement_window_ms_;
+    measure_config.is_count_based = false;
+  } else {
+    measure_config.measurement_window = measurement_request_count_;
+    measure_config.is_count_based = true;
+  }
+  if (!full_window) {
+    measure_config.measurement_window =
+        std::max<uint64_t>(measure_config.measurement_window / 4, 1);
+  }
+  measure_config.clamp_window = false;
+  measure_config.collect_data = false;
+
+  const cb::Error err{Measure(status_summary, measure_config)};
+  if (should_collect_metrics_) {
+    metrics_manager_->StopQueryingMetrics();
+  }
+  RETURN_IF_ERROR(err);
+
+  if (verbose_) {
+    std::cout << "  Probe throughput: "
+              << status_summary.client_stats.infer_per_sec << " infer/sec. p"
+              << goodput_slo_.percentile << " latency: "
+              << (status_summary.client_stats.latency_histogram
+                      .ValueAtPercentile(goodput_slo_.percentile) /
+                  1000)
+              << " usec" << std::endl;
+  }
+  return cb::Error::Success;
+}
+
+void
+InferenceProfiler::ReportGoodput(
+    const GoodputSearchResult& result, const bool is_concurrency) const
+{
+  const std::string load_name{is_concurrency ? "concurrency" : "request rate"};
+  if (!result.found) {
+    std::cerr << "No " << load_name << " in the search range meets the SLO of p"
+              << goodput_slo_.percentile << " latency below "
+              << (goodput_slo_.latency_limit_ns / NANOS_PER_MILLIS)
+              << " msec after " << result.num_windows << " probe windows."
+              << std::endl;
+    return;
+  }
+
+  std::cout << "Max " << load_name << " meeting the SLO: " << result.max_load;
+  if (result.next_load > result.max_load) {
+    std::cout << " (violated at " << result.next_load << ")";
+  } else {
+    std::cout << " (end of the search range)";
+  }
+  std::cout << " after " << result.num_windows << " probe windows"
+            << std::endl;
+
+  std::cout << "  p" << goodput_slo_.percentile
+            << " latency: " << (result.latency_ns / 1000)
+            << " usec (95% confidence interval "
+            << (result.bounds.latency_low_ns / 1000) << " - ";
+  if (result.bounds.latency_high_ns == std::numeric_limits<uint64_t>::max()) {
+    std::cout << "unbounded";
+  } else {
+    std::cout << (result.bounds.latency_high_ns / 1000);
+  }
+  std::cout << " usec)" << std::endl;
+  if (goodput_slo_.max_error_rate < 1) {
+    std::cout << "  Error rate: 95% confidence interval "
+              << result.bounds.error_rate_low << " - "
+              << result.bounds.error_rate_high << std::endl;
+  }
+  std::cout << "  Goodput: " << result.goodput << " infer/sec" << std::endl;
+}
+
 cb::Error
 InferenceProfiler::ProfileHelper(
     PerfStatus& experiment_perf_status, size_t request_count, bool* is_stable)
@@ -723,7 +897,7 @@ InferenceProfiler::ProfileHelper(
 
   // Start with a fresh empty request records vector in the manager
   //
-  std::vector<RequestRecord> empty_request_records;
+  RequestRecordStore empty_request_records;
   RETURN_IF_ERROR(manager_->SwapRequestRecords(empty_request_records));
 
   do {
@@ -1057,7 +1231,10 @@ InferenceProfiler::MergePerfStatusReports(
   experiment_perf_status.client_stats.duration_ns = 0;
   experiment_perf_status.client_stats.avg_latency_ns = 0;
   experiment_perf_status.client_stats.percentile_latency_ns.clear();
-  experiment_perf_status.client_stats.latencies.clear();
+  experiment_perf_status.client_stats.latency_histogram =
+      LatencyHistogram(latency_histogram_precision_);
+  experiment_perf_status.client_stats.corrected_latency_histogram =
+      LatencyHistogram(latency_histogram_precision_);
   experiment_perf_status.client_stats.std_us = 0;
   experiment_perf_status.client_stats.avg_request_time_ns = 0;
   experiment_perf_status.client_stats.avg_send_time_ns = 0;
@@ -1065,9 +1242,14 @@ InferenceProfiler::MergePerfStatusReports(
   experiment_perf_status.client_stats.infer_per_sec = 0;
   experiment_perf_status.client_stats.sequence_per_sec = 0;
   experiment_perf_status.client_stats.completed_count = 0;
+  experiment_perf_status.client_stats.new_connection_count = 0;
+  experiment_perf_status.client_stats.reused_connection_count = 0;
+  experiment_perf_status.client_stats.avg_connect_time_ns = 0;
   experiment_perf_status.stabilizing_latency_ns = 0;
   experiment_perf_status.overhead_pct = 0;
   experiment_perf_status.send_request_rate = 0.0;
+  experiment_perf_status.schedule_skew.Clear();
+  experiment_perf_status.record_handoff_wait_ns = 0;
 
   std::vector<ServerSideStats> server_side_stats;
   for (auto& perf_status : perf_status_reports) {
@@ -1085,14 +1267,17 @@ InferenceProfiler::MergePerfStatusReports(
 
     server_side_stats.push_back(perf_status.server_stats);
 
-    experiment_perf_status.client_stats.latencies.insert(
-        experiment_perf_status.client_stats.latencies.end(),
-        perf_status.client_stats.latencies.begin(),
-        perf_status.client_stats.latencies.end());
+    experiment_perf_status.client_stats.latency_histogram.Merge(
+        perf_status.client_stats.latency_histogram);
+    experiment_perf_status.client_stats.corrected_latency_histogram.Merge(
+        perf_status.client_stats.corrected_latency_histogram);
     // Accumulate the overhead percentage and send rate here to remove extra
     // traversals over the perf_status_reports
     experiment_perf_status.overhead_pct += perf_status.overhead_pct;
     experiment_perf_status.send_request_rate += perf_status.send_request_rate;
+    experiment_perf_status.schedule_skew.Merge(perf_status.schedule_skew);
+    experiment_perf_status.record_handoff_wait_ns +=
+        perf_status.record_handoff_wait_ns;
   }
 
   // Calculate the average overhead_pct for the experiment.
@@ -1115,6 +1300,20 @@ InferenceProfiler::MergePerfStatusReports(
       experiment_perf_status.client_stats.avg_receive_time_ns +=
           perf_status.client_stats.avg_receive_time_ns *
           perf_status.client_stats.completed_count;
+
+      experiment_perf_status.client_stats.new_connection_count +=
+          perf_status.client_stats.new_connection_count;
+      experiment_perf_status.client_stats.reused_connection_count +=
+          perf_status.client_stats.reused_connection_count;
+      experiment_perf_status.client_stats.avg_connect_time_ns +=
+          perf_status.client_stats.avg_connect_time_ns *
+          perf_status.client_stats.new_connection_count;
+    }
+
+    if (experiment_perf_status.client_stats.new_connection_count != 0) {
+      experiment_perf_status.client_stats.avg_connect_time_ns =
+          experiment_perf_status.client_stats.avg_connect_time_ns /
+          experiment_perf_status.client_stats.new_connection_count;
     }
 
     if (experiment_perf_status.client_stats.completed_count != 0) {
@@ -1135,10 +1334,6 @@ InferenceProfiler::MergePerfStatusReports(
   RETURN_IF_ERROR(MergeServerSideStats(
       server_side_stats, experiment_perf_status.server_stats));
 
-  std::sort(
-      experiment_perf_status.client_stats.latencies.begin(),
-      experiment_perf_status.client_stats.latencies.end());
-
   float client_duration_sec =
       (float)experiment_perf_status.client_stats.duration_ns / NANOS_PER_SECOND;
   experiment_perf_status.client_stats.sequence_per_sec =
@@ -1150,7 +1345,11 @@ InferenceProfiler::MergePerfStatusReports(
   experiment_perf_status.client_stats.responses_per_sec =
       experiment_perf_status.client_stats.response_count / client_duration_sec;
   RETURN_IF_ERROR(SummarizeLatency(
-      experiment_perf_status.client_stats.latencies, experiment_perf_status));
+      experiment_perf_status.client_stats.latency_histogram,
+      experiment_perf_status));
+  SummarizeCorrectedLatency(
+      experiment_perf_status.client_stats.corrected_latency_histogram,
+      experiment_perf_status);
 
   if (should_collect_metrics_) {
     // Put all Metric objects in a flat vector so they're easier to merge
@@ -1258,15 +1457,14 @@ InferenceProfiler::Measure(PerfStatus& perf_status, MeasureConfig config)
   RETURN_IF_ERROR(manager_->GetAccumulatedClientStat(&end_stat));
   prev_client_side_stats_ = end_stat;
 
-  std::vector<RequestRecord> current_request_records;
+  RequestRecordStore current_request_records;
   RETURN_IF_ERROR(manager_->SwapRequestRecords(current_request_records));
-  all_request_records_.insert(
-      all_request_records_.end(), current_request_records.begin(),
-      current_request_records.end());
+  all_request_records_.Merge(std::move(current_request_records));
 
   RETURN_IF_ERROR(Summarize(
       start_status, end_status, start_stat, end_stat, perf_status,
-      window_start_ns, window_end_ns, config.clamp_window));
+      window_start_ns, window_end_ns, config.clamp_window,
+      config.collect_data));
 
   return cb::Error::Success;
 }
@@ -1277,7 +1475,7 @@ InferenceProfiler::Summarize(
     const std::map<cb::ModelIdentifier, cb::ModelStatistics>& end_status,
     const cb::InferStat& start_stat, const cb::InferStat& end_stat,
     PerfStatus& summary, uint64_t window_start_ns, uint64_t window_end_ns,
-    bool clamp_window)
+    bool clamp_window, bool collect_data)
 {
   size_t valid_sequence_count = 0;
   size_t delayed_request_count = 0;
@@ -1285,12 +1483,14 @@ InferenceProfiler::Summarize(
 
   // Get measurement from requests that fall within the time interval
   std::pair<uint64_t, uint64_t> valid_range{window_start_ns, window_end_ns};
-  std::vector<uint64_t> latencies;
-  std::vector<RequestRecord> valid_requests{};
+  LatencyHistogram latency_histogram{latency_histogram_precision_};
+  RequestRecordStore valid_requests{};
   ValidLatencyMeasurement(
-      valid_range, valid_sequence_count, delayed_request_count, &latencies,
-      response_count, valid_requests);
+      valid_range, valid_sequence_count, delayed_request_count,
+      &latency_histogram, response_count, valid_requests);
 
+  LatencyHistogram corrected_latency_histogram{latency_histogram_precision_};
+  CorrectedLatencyMeasurement(valid_requests, &corrected_latency_histogram);
 
   if (clamp_window) {
     auto [start, end] = ClampWindow(valid_requests);
@@ -1298,16 +1498,20 @@ InferenceProfiler::Summarize(
 
   uint64_t window_duration_ns = window_end_ns - window_start_ns;
 
-  if (should_collect_profile_data_) {
+  if (should_collect_profile_data_ && collect_data) {
     CollectData(
-        summary, window_start_ns, window_end_ns, std::move(valid_requests));
+        summary, window_start_ns, window_end_ns, std::move(valid_requests),
+        latency_histogram, corrected_latency_histogram);
   }
 
-  RETURN_IF_ERROR(SummarizeLatency(latencies, summary));
+  RETURN_IF_ERROR(SummarizeLatency(latency_histogram, summary));
+  SummarizeCorrectedLatency(corrected_latency_histogram, summary);
   RETURN_IF_ERROR(SummarizeClientStat(
-      start_stat, end_stat, window_duration_ns, latencies.size(),
+      start_stat, end_stat, window_duration_ns, latency_histogram.Count(),
       valid_sequence_count, delayed_request_count, response_count, summary));
-  summary.client_stats.latencies = std::move(latencies);
+  summary.client_stats.latency_histogram = std::move(latency_histogram);
+  summary.client_stats.corrected_latency_histogram =
+      std::move(corrected_latency_histogram);
 
   SummarizeOverhead(window_duration_ns, manager_->GetIdleTime(), summary);
 
@@ -1317,6 +1521,9 @@ InferenceProfiler::Summarize(
   SummarizeSendRequestRate(
       window_duration_s, manager_->GetAndResetNumSentRequests(), summary);
 
+  summary.schedule_skew = manager_->GetAndResetScheduleSkew();
+  summary.record_handoff_wait_ns = manager_->GetAndResetRecordHandoffWaitTime();
+
   if (include_server_stats_) {
     RETURN_IF_ERROR(SummarizeServerStats(
         start_status, end_status, &(summary.server_stats)));
@@ -1329,89 +1536,73 @@ void
 InferenceProfiler::ValidLatencyMeasurement(
     const std::pair<uint64_t, uint64_t>& valid_range,
     size_t& valid_sequence_count, size_t& delayed_request_count,
-    std::vector<uint64_t>* valid_latencies, size_t& response_count,
-    std::vector<RequestRecord>& valid_requests)
+    LatencyHistogram* latency_histogram, size_t& response_count,
+    RequestRecordStore& valid_requests)
 {
-  valid_latencies->clear();
+  latency_histogram->Clear();
   valid_sequence_count = 0;
   response_count = 0;
-  std::vector<size_t> erase_indices{};
-  for (size_t i = 0; i < all_request_records_.size(); i++) {
-    const auto& request_record = all_request_records_[i];
-    uint64_t request_start_ns = CHRONO_TO_NANOS(request_record.start_time_);
-    uint64_t request_end_ns;
-
-    if (request_record.has_null_last_response_ == false) {
-      request_end_ns =
-          CHRONO_TO_NANOS(request_record.response_timestamps_.back());
-    } else if (request_record.response_timestamps_.size() > 1) {
-      size_t last_response_idx{request_record.response_timestamps_.size() - 2};
-      request_end_ns = CHRONO_TO_NANOS(
-          request_record.response_timestamps_[last_response_idx]);
-    } else {
-      erase_indices.push_back(i);
-      continue;
-    }
 
-    if (request_start_ns <= request_end_ns) {
-      // Only counting requests that end within the time interval
-      if ((request_end_ns >= valid_range.first) &&
-          (request_end_ns <= valid_range.second)) {
-        valid_latencies->push_back(request_end_ns - request_start_ns);
-        response_count += request_record.response_timestamps_.size();
-        if (request_record.has_null_last_response_) {
-          response_count--;
-        }
-        erase_indices.push_back(i);
-        if (request_record.sequence_end_) {
-          valid_sequence_count++;
-        }
-        if (request_record.delayed_) {
-          delayed_request_count++;
-        }
-      }
+  const auto& records{all_request_records_};
+  const auto is_valid{[&](size_t i) {
+    const uint64_t request_start_ns{records.StartNs(i)};
+    const uint64_t request_end_ns{records.EndNs(i)};
+
+    // Requests without a non-null response can never become valid
+    if (request_end_ns == 0) {
+      return true;
     }
-  }
 
-  std::for_each(
-      erase_indices.begin(), erase_indices.end(),
-      [this, &valid_requests](size_t i) {
-        valid_requests.push_back(std::move(this->all_request_records_[i]));
-      });
+    // Only counting requests that end within the time interval
+    if ((request_start_ns > request_end_ns) ||
+        (request_end_ns < valid_range.first) ||
+        (request_end_ns > valid_range.second)) {
+      return false;
+    }
 
-  // Iterate through erase indices backwards so that erases from
-  // `all_request_records_` happen from the back to the front to avoid using
-  // wrong indices after subsequent erases
-  std::for_each(erase_indices.rbegin(), erase_indices.rend(), [this](size_t i) {
-    this->all_request_records_.erase(this->all_request_records_.begin() + i);
-  });
+    latency_histogram->Record(request_end_ns - request_start_ns);
+    response_count += records.ResponseNs(i).size();
+    if (records.HasNullLastResponse(i)) {
+      response_count--;
+    }
+    if (records.SequenceEnd(i)) {
+      valid_sequence_count++;
+    }
+    if (records.Delayed(i)) {
+      delayed_request_count++;
+    }
+    return true;
+  }};
 
-  // Always sort measured latencies as percentile will be reported as default
-  std::sort(valid_latencies->begin(), valid_latencies->end());
+  // Move the valid requests out of `all_request_records_` in a single pass,
+  // keeping the rest for later measurement windows
+  all_request_records_.MoveIf(is_valid, valid_requests);
 }
 
 std::pair<uint64_t, uint64_t>
-InferenceProfiler::ClampWindow(std::vector<RequestRecord>& requests)
+InferenceProfiler::ClampWindow(const RequestRecordStore& requests)
 {
-  auto earliest_start =
-      std::chrono::time_point<std::chrono::system_clock>::max();
-  auto latest_end = std::chrono::time_point<std::chrono::system_clock>::min();
-
-  for (auto x : requests) {
-    earliest_start = std::min(earliest_start, x.start_time_);
-    latest_end = std::max(latest_end, x.response_timestamps_.back());
+  uint64_t earliest_start{std::numeric_limits<uint64_t>::max()};
+  uint64_t latest_end{0};
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    earliest_start = std::min(earliest_start, requests.StartNs(i));
+    const auto response_ns{requests.ResponseNs(i)};
+    if (!response_ns.empty()) {
+      latest_end = std::max(latest_end, response_ns.back());
+    }
   }
 
-  return std::make_pair(
-      earliest_start.time_since_epoch().count(),
-      latest_end.time_since_epoch().count());
+  return std::make_pair(earliest_start, latest_end);
 }
 
 
 void
 InferenceProfiler::CollectData(
     PerfStatus& summary, uint64_t window_start_ns, uint64_t window_end_ns,
-    std::vector<RequestRecord>&& request_records)
+    RequestRecordStore&& request_records,
+    const LatencyHistogram& latency_histogram,
+    const LatencyHistogram& corrected_latency_histogram)
 {
   ProfileDataCollector::InferenceLoadMode id{};
   if (dynamic_cast<CustomRequestScheduleManager*>(manager_.get())) {
@@ -1420,14 +1611,90 @@ InferenceProfiler::CollectData(
     id = {summary.concurrency, summary.request_rate};
   }
   collector_->AddWindow(id, window_start_ns, window_end_ns);
+  auto* request_rate_manager{
+      dynamic_cast<RequestRateManager*>(manager_.get())};
+  if (request_rate_manager && request_rate_manager->GetLoadCurve()) {
+    collector_->AddTimeline(
+        id, SummarizeTimeline(
+                request_records, *request_rate_manager->GetLoadCurve(),
+                request_rate_manager->GetScheduleStartNs()));
+  }
   collector_->AddData(id, std::move(request_records));
+  collector_->AddLatencyHistogram(
+      id, latency_histogram, corrected_latency_histogram);
+}
+
+std::vector<ProfileDataCollector::TimelineSecond>
+InferenceProfiler::SummarizeTimeline(
+    const RequestRecordStore& requests, const LoadCurve& load_curve,
+    const uint64_t curve_start_ns) const
+{
+  std::vector<ProfileDataCollector::TimelineSecond> timeline(
+      static_cast<size_t>(std::ceil(load_curve.Duration())));
+  // Returns the second of the timeline that the timestamp falls in, growing
+  // the timeline if the run went on past the end of the curve
+  const auto second_of{[&](const uint64_t timestamp_ns)
+                           -> ProfileDataCollector::TimelineSecond* {
+    if (timestamp_ns < curve_start_ns) {
+      return nullptr;
+    }
+    const size_t second{(timestamp_ns - curve_start_ns) / NANOS_PER_SECOND};
+    if (second >= timeline.size()) {
+      timeline.resize(second + 1);
+    }
+    return &timeline[second];
+  }};
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    if (auto* sent{second_of(requests.StartNs(i))}) {
+      sent->sent_count++;
+    }
+    const uint64_t end_ns{requests.EndNs(i)};
+    if (end_ns == 0 || end_ns < requests.StartNs(i)) {
+      continue;
+    }
+    if (auto* completed{second_of(end_ns)}) {
+      if (completed->latency_histogram.Empty()) {
+        completed->latency_histogram =
+            LatencyHistogram{latency_histogram_precision_};
+      }
+      completed->completed_count++;
+      completed->latency_histogram.Record(end_ns - requests.StartNs(i));
+    }
+  }
+
+  for (size_t i = 0; i < timeline.size(); i++) {
+    timeline[i].target_request_count =
+        load_curve.RequestsUntil(i + 1) - load_curve.RequestsUntil(i);
+  }
+  return timeline;
+}
+
+void
+InferenceProfiler::CorrectedLatencyMeasurement(
+    const RequestRecordStore& requests,
+    LatencyHistogram* corrected_latency_histogram)
+{
+  corrected_latency_histogram->Clear();
+  for (size_t i = 0; i < requests.size(); i++) {
+    const uint64_t scheduled_ns{requests.ScheduledNs(i)};
+    const uint64_t end_ns{requests.EndNs(i)};
+    if (scheduled_ns == 0 || end_ns == 0) {
+      continue;
+    }
+    const uint64_t corrected_start_ns{
+        std::min(scheduled_ns, requests.StartNs(i))};
+    if (corrected_start_ns <= end_ns) {
+      corrected_latency_histogram->Record(end_ns - corrected_start_ns);
+    }
+  }
 }
 
 cb::Error
 InferenceProfiler::SummarizeLatency(
-    const std::vector<uint64_t>& latencies, PerfStatus& summary)
+    const LatencyHistogram& latency_histogram, PerfStatus& summary)
 {
-  if (latencies.size() == 0) {
+  if (latency_histogram.Empty()) {
     return cb::Error(
         "No valid requests recorded within time interval."
         " Please use a larger time window.",
@@ -1435,19 +1702,13 @@ InferenceProfiler::SummarizeLatency(
   }
 
   std::tie(summary.client_stats.avg_latency_ns, summary.client_stats.std_us) =
-      GetMeanAndStdDev(latencies);
+      GetMeanAndStdDev(latency_histogram);
 
   // retrieve other interesting percentile
   summary.client_stats.percentile_latency_ns.clear();
-  std::set<size_t> percentiles{50, 90, 95, 99};
-  if (extra_percentile_) {
-    percentiles.emplace(percentile_);
-  }
-
-  for (const auto percentile : percentiles) {
-    size_t index = (percentile / 100.0) * (latencies.size() - 1) + 0.5;
+  for (const auto percentile : ReportedPercentiles()) {
     summary.client_stats.percentile_latency_ns.emplace(
-        percentile, latencies[index]);
+        percentile, latency_histogram.ValueAtPercentile(percentile));
   }
 
   if (extra_percentile_) {
@@ -1460,28 +1721,44 @@ InferenceProfiler::SummarizeLatency(
   return cb::Error::Success;
 }
 
+void
+InferenceProfiler::SummarizeCorrectedLatency(
+    const LatencyHistogram& corrected_latency_histogram, PerfStatus& summary)
+{
+  summary.client_stats.percentile_corrected_latency_ns.clear();
+  summary.client_stats.avg_corrected_latency_ns = 0;
+  if (corrected_latency_histogram.Empty()) {
+    return;
+  }
+
+  summary.client_stats.avg_corrected_latency_ns =
+      corrected_latency_histogram.Mean();
+  for (const auto percentile : ReportedPercentiles()) {
+    summary.client_stats.percentile_corrected_latency_ns.emplace(
+        percentile, corrected_latency_histogram.ValueAtPercentile(percentile));
+  }
+}
+
+std::set<size_t>
+InferenceProfiler::ReportedPercentiles() const
+{
+  std::set<size_t> percentiles{50, 90, 95, 99};
+  if (extra_percentile_) {
+    percentiles.emplace(percentile_);
+  }
+  return percentiles;
+}
+
 std::tuple<uint64_t, uint64_t>
-InferenceProfiler::GetMeanAndStdDev(const std::vector<uint64_t>& latencies)
+InferenceProfiler::GetMeanAndStdDev(const LatencyHistogram& latency_histogram)
 {
-  uint64_t avg_latency_ns{0};
+  uint64_t avg_latency_ns{latency_histogram.Mean()};
   uint64_t std_dev_latency_us{0};
 
-  // calculate mean of latencies
-  uint64_t tol_latency_ns{
-      std::accumulate(latencies.begin(), latencies.end(), 0ULL)};
-  avg_latency_ns = tol_latency_ns / latencies.size();
-
-  // calculate sample standard deviation of latencies
-  uint64_t sq_sum_latency_avg_diff_ns{0};
-  std::for_each(
-      latencies.begin(), latencies.end(),
-      [avg_latency_ns, &sq_sum_latency_avg_diff_ns](uint64_t l) {
-        sq_sum_latency_avg_diff_ns += static_cast<int64_t>(l - avg_latency_ns) *
-                                      static_cast<int64_t>(l - avg_latency_ns);
-      });
-  if (latencies.size() > 1) {
-    std_dev_latency_us =
-        std::sqrt(sq_sum_latency_avg_diff_ns / (latencies.size() - 1)) / 1000;
+  // The histogram keeps the exact mean and sum of squared differences, so the
+  // sample standard deviation does not depend on the histogram precision
+  if (latency_histogram.Count() > 1) {
+    std_dev_latency_us = latency_histogram.StdDev() / 1000;
   } else {
     std_dev_latency_us = UINT64_MAX;
     std::cerr << "WARNING: Pass contained only one request, so sample latency "
@@ -1489,7 +1766,6 @@ InferenceProfiler::GetMeanAndStdDev(const std::vector<uint64_t>& latencies)
               << std::endl;
   }
 
-
   return std::make_tuple(avg_latency_ns, std_dev_latency_us);
 }
 
@@ -1534,6 +1810,17 @@ InferenceProfiler::SummarizeClientStat(
       summary.client_stats.avg_receive_time_ns =
           receive_time_ns / completed_count;
     }
+
+    summary.client_stats.new_connection_count =
+        end_stat.new_connection_count - start_stat.new_connection_count;
+    summary.client_stats.reused_connection_count =
+        end_stat.reused_connection_count - start_stat.reused_connection_count;
+    if (summary.client_stats.new_connection_count != 0) {
+      summary.client_stats.avg_connect_time_ns =
+          (end_stat.cumulative_connect_time_ns -
+           start_stat.cumulative_connect_time_ns) /
+          summary.client_stats.new_connection_count;
+    }
   }
 
   return cb::Error::Success;
@@ -31,22 +31,28 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <thread>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include "concurrency_manager.h"
 #include "constants.h"
 #include "custom_load_manager.h"
 #include "custom_request_schedule_manager.h"
+#include "goodput_search.h"
 #include "metrics.h"
 #include "metrics_manager.h"
 #include "model_parser.h"
 #include "mpi_utils.h"
 #include "periodic_concurrency_manager.h"
+#include "latency_histogram.h"
 #include "profile_data_collector.h"
 #include "request_rate_manager.h"
+#include "request_record_store.h"
 #include "session_concurrency/session_concurrency_manager.h"
 
 namespace triton::perfanalyzer {
@@ -84,6 +90,9 @@ struct MeasureConfig {
   uint64_t measurement_window{0};
   bool is_count_based{false};
   bool clamp_window{false};
+  // Whether the requests of the window go to the profile export. Probe
+  // windows of a search don't, only the measurements of the loads profiled.
+  bool collect_data{true};
 };
 
 // Holds the total of the timiming components of composing models of an
@@ -167,8 +176,16 @@ struct ClientSideStats {
   uint64_t avg_latency_ns;
   // a ordered map of percentiles to be reported (<percentile, value> pair)
   std::map<size_t, uint64_t> percentile_latency_ns;
-  // List of all the valid latencies.
-  std::vector<uint64_t> latencies;
+  // Histogram of all the valid latencies, from which the percentiles above
+  // are taken.
+  LatencyHistogram latency_histogram;
+  // Latencies measured from when the requests were scheduled to be sent rather
+  // than from when they were sent, so that the time requests spent waiting
+  // for the client to catch up with the schedule is not omitted. Only
+  // recorded for requests sent on a schedule.
+  LatencyHistogram corrected_latency_histogram;
+  uint64_t avg_corrected_latency_ns{0};
+  std::map<size_t, uint64_t> percentile_corrected_latency_ns;
   // Using usec to avoid square of large number (large in nsec)
   uint64_t std_us;
   uint64_t avg_request_time_ns;
@@ -181,6 +198,12 @@ struct ClientSideStats {
 
   // Completed request count reported by the client library
   uint64_t completed_count;
+  // The completed requests that opened a new connection or reused an open one,
+  // and the average time to open a new connection. Zero when the client
+  // library does not report them.
+  uint64_t new_connection_count{0};
+  uint64_t reused_connection_count{0};
+  uint64_t avg_connect_time_ns{0};
 };
 
 /// The entire statistics record.
@@ -198,6 +221,12 @@ struct PerfStatus {
   uint64_t stabilizing_latency_ns;
   // Metric for requests sent per second
   double send_request_rate{0.0};
+  // How late the requests were sent relative to their schedule, in
+  // nanoseconds. Only recorded in request rate mode
+  LatencyHistogram schedule_skew{};
+  // Time the profiler spent waiting on workers while taking their request
+  // records
+  uint64_t record_handoff_wait_ns{0};
 };
 
 cb::Error ReportPrometheusMetrics(const Metrics& metrics);
@@ -257,6 +286,8 @@ class InferenceProfiler {
   /// overhead is too significant to provide usable results.
   /// \param collector Collector for the profile data from experiments
   /// \param should_collect_profile_data Whether to collect profile data.
+  /// \param latency_histogram_precision The number of significant digits the
+  /// latency histograms resolve latencies to.
   /// \return cb::Error object indicating success or failure.
   static cb::Error Create(
       const bool verbose, const double stability_threshold,
@@ -271,7 +302,8 @@ class InferenceProfiler {
       const bool should_collect_metrics, const double overhead_pct_threshold,
       const bool async_mode,
       const std::shared_ptr<ProfileDataCollector> collector,
-      const bool should_collect_profile_data);
+      const bool should_collect_profile_data,
+      const uint32_t latency_histogram_precision);
 
   /// Performs the profiling on the given range with the given search algorithm.
   /// For profiling using request rate invoke template with double, otherwise
@@ -321,6 +353,9 @@ class InferenceProfiler {
         return cb::Error(
             "Failed to obtain stable measurement.", pa::STABILITY_ERROR);
       }
+    } else if (search_mode == SearchMode::GOODPUT) {
+      return ProfileGoodput(
+          start, end, step, warmup_request_count, perf_statuses);
     } else {
       err = Profile(
           start, warmup_request_count, request_count, perf_statuses,
@@ -358,7 +393,7 @@ class InferenceProfiler {
   cb::Error BenchmarkPeriodicConcurrencyMode()
   {
     auto& manager{dynamic_cast<PeriodicConcurrencyManager&>(*manager_)};
-    std::vector<RequestRecord> request_records{manager.RunExperiment()};
+    RequestRecordStore request_records{manager.RunExperiment()};
     // FIXME - Refactor collector class to not need ID or window in the case of
     // periodic concurrency mode
     ProfileDataCollector::InferenceLoadMode id{1, 0.0};
@@ -370,7 +405,7 @@ class InferenceProfiler {
   cb::Error BenchmarkSessionConcurrencyMode()
   {
     auto& manager{dynamic_cast<SessionConcurrencyManager&>(*manager_)};
-    std::vector<RequestRecord> request_records{manager.Start()};
+    RequestRecordStore request_records{manager.Start()};
     ProfileDataCollector::InferenceLoadMode id{0, 0.0};
     collector_->AddWindow(id, 0, std::numeric_limits<uint64_t>::max());
     collector_->AddData(id, std::move(request_records));
@@ -379,6 +414,13 @@ class InferenceProfiler {
 
   bool IncludeServerStats() { return include_server_stats_; }
 
+  /// Sets the SLO that the goodput search mode finds the highest load for
+  /// \param goodput_slo The SLO.
+  void SetGoodputSlo(const GoodputSlo& goodput_slo)
+  {
+    goodput_slo_ = goodput_slo;
+  }
+
  private:
   InferenceProfiler(
       const bool verbose, const double stability_threshold,
@@ -392,7 +434,8 @@ class InferenceProfiler {
       const uint64_t metrics_interval_ms, const bool should_collect_metrics,
       const double overhead_pct_threshold, const bool async_mode,
       const std::shared_ptr<ProfileDataCollector> collector,
-      const bool should_collect_profile_data);
+      const bool should_collect_profile_data,
+      const uint32_t latency_histogram_precision);
 
   /// Actively measure throughput in every 'measurement_window' msec until the
   /// throughput is stable. Once the throughput is stable, it adds the
@@ -456,6 +499,98 @@ class InferenceProfiler {
       bool& is_stable);
 
 
+  /// Searches for the highest load of the range that meets the goodput SLO
+  /// with short probe windows that skip the stability convergence, and then
+  /// profiles that load as usual.
+  /// \param start The starting point of the search range.
+  /// \param end The ending point of the search range, or 0 for no limit.
+  /// \param step The precision of the search.
+  /// \param warmup_request_count The number of warmup requests to send before
+  /// benchmarking the load found.
+  /// \param perf_statuses Appends the measurements summary of the load found.
+  /// \return cb::Error object indicating success or failure.
+  template <typename T>
+  cb::Error ProfileGoodput(
+      const T start, const T end, const T step, size_t warmup_request_count,
+      std::vector<PerfStatus>& perf_statuses)
+  {
+    GoodputSearch search{
+        goodput_slo_,
+        static_cast<double>(start),
+        static_cast<double>(end),
+        static_cast<double>(step),
+        std::is_integral_v<T>,
+        max_trials_};
+    std::optional<double> previous_load{};
+    while (const auto load = search.NextLoad()) {
+      // Windows of the same load continue to measure it, so that their
+      // histograms add up
+      const bool change_load{load != previous_load};
+      previous_load = load;
+
+      PerfStatus probe_status{};
+      const size_t in_flight_start{manager_->GetNumInFlightRequests()};
+      RETURN_IF_ERROR(Probe(
+          static_cast<T>(*load), change_load, search.IsRefining(),
+          probe_status));
+      const size_t in_flight_end{manager_->GetNumInFlightRequests()};
+      const double duration_s{
+          probe_status.client_stats.duration_ns /
+          static_cast<double>(NANOS_PER_SECOND)};
+      search.AddWindow(
+          probe_status.client_stats.latency_histogram,
+          static_cast<uint64_t>(probe_status.send_request_rate * duration_s),
+          in_flight_start, in_flight_end, duration_s);
+      if (early_exit) {
+        return cb::Error("Received exit signal.", pa::GENERIC_ERROR);
+      }
+    }
+
+    const GoodputSearchResult result{search.Result()};
+    ReportGoodput(result, std::is_integral_v<T>);
+    if (!result.found) {
+      return cb::Error::Success;
+    }
+
+    bool meets_threshold, is_stable;
+    return Profile(
+        static_cast<T>(result.max_load), warmup_request_count, 0,
+        perf_statuses, meets_threshold, is_stable);
+  }
+
+  /// Sets the load and measures one window of it without waiting for the
+  /// measurements to stabilize.
+  /// \param concurrent_request_count The concurrency level to measure.
+  /// \param change_load Whether the load changes from the previous probe.
+  /// \param full_window Whether to measure a full measurement window or a
+  /// quarter of one.
+  /// \param status_summary Returns the summary of the window.
+  /// \return cb::Error object indicating success or failure.
+  cb::Error Probe(
+      const size_t concurrent_request_count, const bool change_load,
+      const bool full_window, PerfStatus& status_summary);
+
+  /// Similar to above function, but sets the specified request rate.
+  cb::Error Probe(
+      const double request_rate, const bool change_load,
+      const bool full_window, PerfStatus& status_summary);
+
+  /// Measures one probe window of the current load.
+  /// \param change_load Whether the load changed from the previous probe.
+  /// \param full_window Whether to measure a full measurement window or a
+  /// quarter of one.
+  /// \param status_summary Returns the summary of the window.
+  /// \return cb::Error object indicating success or failure.
+  cb::Error ProbeWindow(
+      const bool change_load, const bool full_window,
+      PerfStatus& status_summary);
+
+  /// Prints the result of a goodput search.
+  /// \param result The result of the search.
+  /// \param is_concurrency Whether the load is a concurrency or request rate.
+  void ReportGoodput(
+      const GoodputSearchResult& result, const bool is_concurrency) const;
+
   /// A helper function for profiling functions.
   /// \param status_summary Returns the summary of the measurement.
   /// \param request_count The number of requests to generate when profiling. If
@@ -532,34 +667,35 @@ class InferenceProfiler {
   /// \param window_end_ns The window end timestamp in nanoseconds.
   /// \param clamp_window If true, the actual window range is reduced to the
   /// start of the first request to the final response.
+  /// \param collect_data Whether to add the requests of the window to the
+  /// profile export.
   /// \return cb::Error object indicating success or failure.
   cb::Error Summarize(
       const std::map<cb::ModelIdentifier, cb::ModelStatistics>& start_status,
       const std::map<cb::ModelIdentifier, cb::ModelStatistics>& end_status,
       const cb::InferStat& start_stat, const cb::InferStat& end_stat,
       PerfStatus& summary, uint64_t window_start_ns, uint64_t window_end_ns,
-      bool clamp_window);
+      bool clamp_window, bool collect_data);
 
   /// \param valid_range The start and end timestamp of the measurement window.
   /// \param valid_sequence_count Returns the number of completed sequences
   /// during the measurement. A sequence is a set of correlated requests sent to
   /// sequence model.
-  /// \param latencies Returns the vector of request latencies where the
-  /// requests are completed within the measurement window.
+  /// \param latency_histogram Returns the histogram of request latencies where
+  /// the requests are completed within the measurement window.
   /// \param response_count Returns the number of responses
-  /// \param valid_requests Returns a vector of valid request records
+  /// \param valid_requests Returns the valid request records
   virtual void ValidLatencyMeasurement(
       const std::pair<uint64_t, uint64_t>& valid_range,
       size_t& valid_sequence_count, size_t& delayed_request_count,
-      std::vector<uint64_t>* latencies, size_t& response_count,
-      std::vector<RequestRecord>& valid_requests);
+      LatencyHistogram* latency_histogram, size_t& response_count,
+      RequestRecordStore& valid_requests);
 
   /// Clamp a window around a set of requests, from the earliest start time to
   /// the latest response
-  /// \param requests A vector of requests to clamp the window around.
+  /// \param requests The requests to clamp the window around.
   /// \return std::pair object containing <start, end> of the window.
-  std::pair<uint64_t, uint64_t> ClampWindow(
-      std::vector<RequestRecord>& requests);
+  std::pair<uint64_t, uint64_t> ClampWindow(const RequestRecordStore& requests);
 
   /// Add the data from the request records to the Raw Data Collector
   /// \param perf_status PerfStatus of the current measurement
@@ -568,21 +704,57 @@ class InferenceProfiler {
   /// \param request_records The request records to collect.
   void CollectData(
       PerfStatus& perf_status, uint64_t window_start_ns, uint64_t window_end_ns,
-      std::vector<RequestRecord>&& request_records);
-
-  /// \param latencies The vector of request latencies collected.
+      RequestRecordStore&& request_records,
+      const LatencyHistogram& latency_histogram,
+      const LatencyHistogram& corrected_latency_histogram);
+
+  /// Summarizes the requests of a measurement window per second of the load
+  /// curve that the request rate followed. A request counts as sent in the
+  /// second it was sent, and as completed, along with its latency, in the
+  /// second it completed.
+  /// \param requests The valid requests of the measurement window.
+  /// \param load_curve The load curve of the run.
+  /// \param curve_start_ns When the load curve started, in nanoseconds since
+  /// the epoch.
+  /// \return The summary of each second since the start of the load curve.
+  std::vector<ProfileDataCollector::TimelineSecond> SummarizeTimeline(
+      const RequestRecordStore& requests, const LoadCurve& load_curve,
+      const uint64_t curve_start_ns) const;
+
+  /// Records the latencies of the scheduled requests measured from when they
+  /// were scheduled to be sent. A request that was sent ahead of its schedule
+  /// is measured from when it was sent.
+  /// \param requests The valid requests of the measurement window.
+  /// \param corrected_latency_histogram Returns the histogram of the
+  /// schedule-corrected latencies.
+  void CorrectedLatencyMeasurement(
+      const RequestRecordStore& requests,
+      LatencyHistogram* corrected_latency_histogram);
+
+  /// \param latency_histogram The histogram of request latencies collected.
   /// \param summary Returns the summary that the latency related fields are
   /// set.
   /// \return cb::Error object indicating success or failure.
   virtual cb::Error SummarizeLatency(
-      const std::vector<uint64_t>& latencies, PerfStatus& summary);
+      const LatencyHistogram& latency_histogram, PerfStatus& summary);
+
+  /// \param corrected_latency_histogram The histogram of schedule-corrected
+  /// request latencies collected.
+  /// \param summary Returns the summary that the corrected latency related
+  /// fields are set. They are left empty if no request was scheduled.
+  void SummarizeCorrectedLatency(
+      const LatencyHistogram& corrected_latency_histogram,
+      PerfStatus& summary);
+
+  /// \return The latency percentiles to be reported.
+  std::set<size_t> ReportedPercentiles() const;
 
-  /// \param latencies The vector of request latencies collected.
+  /// \param latency_histogram The histogram of request latencies collected.
   /// \return std::tuple object containing:
   ///   * mean of latencies in nanoseconds
   ///   * sample standard deviation of latencies in microseconds
   std::tuple<uint64_t, uint64_t> GetMeanAndStdDev(
-      const std::vector<uint64_t>& latencies);
+      const LatencyHistogram& latency_histogram);
 
   /// \param start_stat The accumulated client statistics at the start.
   /// \param end_stat The accumulated client statistics at the end.
@@ -789,6 +961,7 @@ class InferenceProfiler {
   bool extra_percentile_;
   size_t percentile_;
   uint64_t latency_threshold_ms_;
+  GoodputSlo goodput_slo_{};
 
   cb::ProtocolType protocol_;
   std::string model_name_;
@@ -805,7 +978,7 @@ class InferenceProfiler {
   std::shared_ptr<MPIDriver> mpi_driver_;
 
   /// The request records of the requests completed during all measurements
-  std::vector<RequestRecord> all_request_records_;
+  RequestRecordStore all_request_records_;
 
   /// The end time of the previous measurement window
   uint64_t previous_window_end_ns_;
@@ -829,6 +1002,10 @@ class InferenceProfiler {
   // Whether to collect profile data.
   bool should_collect_profile_data_{false};
 
+  // The number of significant digits of the latency histograms.
+  uint32_t latency_histogram_precision_{
+      LatencyHistogram::DEFAULT_SIGNIFICANT_DIGITS};
+
   // Whether the client is operating in async mode.
   const bool async_mode_{false};
 
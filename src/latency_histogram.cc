@@ -0,0 +1,220 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <string>
+
+#include "constants.h"
+#include "perf_analyzer_exception.h"
+
+namespace triton { namespace perfanalyzer {
+
+LatencyHistogram::LatencyHistogram(const uint32_t significant_digits)
+    : significant_digits_(significant_digits)
+{
+  if (significant_digits < 1 || significant_digits > MAX_SIGNIFICANT_DIGITS) {
+    throw PerfAnalyzerException(
+        "latency histogram precision must be between 1 and " +
+            std::to_string(MAX_SIGNIFICANT_DIGITS) + " significant digits",
+        GENERIC_ERROR);
+  }
+
+  // Values below this are counted exactly; above it, every bucket of a power
+  // of two range is split into the same number of sub-buckets
+  uint64_t largest_value_with_single_unit_resolution{2};
+  for (uint32_t i = 0; i < significant_digits; i++) {
+    largest_value_with_single_unit_resolution *= 10;
+  }
+  const uint32_t sub_bucket_count_magnitude{static_cast<uint32_t>(
+      std::bit_width(largest_value_with_single_unit_resolution - 1))};
+  sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude - 1;
+  sub_bucket_half_count_ = uint64_t{1} << sub_bucket_half_count_magnitude_;
+  sub_bucket_mask_ = (uint64_t{1} << sub_bucket_count_magnitude) - 1;
+}
+
+uint32_t
+LatencyHistogram::BucketIndexOf(const uint64_t value) const
+{
+  return std::bit_width(value | sub_bucket_mask_) -
+         (sub_bucket_half_count_magnitude_ + 1);
+}
+
+size_t
+LatencyHistogram::IndexOf(const uint64_t value) const
+{
+  const uint32_t bucket_index{BucketIndexOf(value)};
+  const uint64_t sub_bucket_index{value >> bucket_index};
+  return ((static_cast<size_t>(bucket_index) + 1)
+          << sub_bucket_half_count_magnitude_) +
+         sub_bucket_index - sub_bucket_half_count_;
+}
+
+uint64_t
+LatencyHistogram::LowestEquivalentValue(const size_t index) const
+{
+  int64_t bucket_index{
+      static_cast<int64_t>(index >> sub_bucket_half_count_magnitude_) - 1};
+  uint64_t sub_bucket_index{
+      (index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_};
+  if (bucket_index < 0) {
+    sub_bucket_index -= sub_bucket_half_count_;
+    bucket_index = 0;
+  }
+  return sub_bucket_index << bucket_index;
+}
+
+uint64_t
+LatencyHistogram::HighestEquivalentValue(const size_t index) const
+{
+  const uint64_t lowest{LowestEquivalentValue(index)};
+  const uint64_t range{uint64_t{1} << BucketIndexOf(lowest)};
+  return lowest + (range - 1);
+}
+
+void
+LatencyHistogram::AddToBucket(const uint64_t value, const uint64_t count)
+{
+  const size_t index{IndexOf(value)};
+  if (index >= counts_.size()) {
+    counts_.resize(index + 1, 0);
+  }
+  counts_[index] += count;
+}
+
+void
+LatencyHistogram::RecordValues(const uint64_t value, const uint64_t count)
+{
+  if (count == 0) {
+    return;
+  }
+
+  AddToBucket(value, count);
+
+  // Combine the running statistics with those of `count` copies of the value
+  const double new_count{static_cast<double>(count_ + count)};
+  const double delta{static_cast<double>(value) - mean_};
+  mean_ += delta * count / new_count;
+  m2_ += delta * delta * count_ * count / new_count;
+
+  count_ += count;
+  sum_ += value * count;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+}
+
+void
+LatencyHistogram::Merge(const LatencyHistogram& other)
+{
+  if (other.count_ == 0) {
+    return;
+  }
+
+  if (other.significant_digits_ == significant_digits_) {
+    if (other.counts_.size() > counts_.size()) {
+      counts_.resize(other.counts_.size(), 0);
+    }
+    for (size_t i = 0; i < other.counts_.size(); i++) {
+      counts_[i] += other.counts_[i];
+    }
+  } else {
+    for (size_t i = 0; i < other.counts_.size(); i++) {
+      if (other.counts_[i] != 0) {
+        AddToBucket(other.LowestEquivalentValue(i), other.counts_[i]);
+      }
+    }
+  }
+
+  const double new_count{static_cast<double>(count_ + other.count_)};
+  const double delta{other.mean_ - mean_};
+  mean_ += delta * other.count_ / new_count;
+  m2_ += other.m2_ + delta * delta * count_ * other.count_ / new_count;
+
+  count_ += other.count_;
+  sum_ += other.sum_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+}
+
+void
+LatencyHistogram::Clear()
+{
+  counts_.clear();
+  count_ = 0;
+  min_ = std::numeric_limits<uint64_t>::max();
+  max_ = 0;
+  sum_ = 0;
+  mean_ = 0;
+  m2_ = 0;
+}
+
+double
+LatencyHistogram::StdDev() const
+{
+  if (count_ < 2) {
+    return 0;
+  }
+  return std::sqrt(m2_ / (count_ - 1));
+}
+
+uint64_t
+LatencyHistogram::ValueAtPercentile(const double percentile) const
+{
+  if (count_ == 0) {
+    return 0;
+  }
+
+  const double clamped{std::clamp(percentile, 0.0, 100.0)};
+  const uint64_t rank{
+      static_cast<uint64_t>((clamped / 100.0) * (count_ - 1) + 0.5)};
+
+  uint64_t cumulative_count{0};
+  for (size_t i = 0; i < counts_.size(); i++) {
+    cumulative_count += counts_[i];
+    if (cumulative_count > rank) {
+      return std::clamp(HighestEquivalentValue(i), min_, max_);
+    }
+  }
+  return max_;
+}
+
+std::vector<LatencyHistogram::Bucket>
+LatencyHistogram::Buckets() const
+{
+  std::vector<Bucket> buckets{};
+  for (size_t i = 0; i < counts_.size(); i++) {
+    if (counts_[i] != 0) {
+      buckets.push_back(
+          {LowestEquivalentValue(i), HighestEquivalentValue(i), counts_[i]});
+    }
+  }
+  return buckets;
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,118 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace triton { namespace perfanalyzer {
+
+/// Log-bucketed histogram of latencies in the style of HdrHistogram.
+///
+/// Values are counted in buckets whose width grows with the magnitude of the
+/// value, so that every recorded value is resolved to the given number of
+/// significant decimal digits. Recording a value and looking up a percentile
+/// do not depend on the number of recorded values, and two histograms are
+/// merged in O(buckets). The mean and standard deviation are tracked exactly
+/// alongside the buckets.
+class LatencyHistogram {
+ public:
+  /// A range of values that are counted together.
+  struct Bucket {
+    uint64_t lowest;
+    uint64_t highest;
+    uint64_t count;
+  };
+
+  static constexpr uint32_t DEFAULT_SIGNIFICANT_DIGITS{3};
+  static constexpr uint32_t MAX_SIGNIFICANT_DIGITS{5};
+
+  /// \param significant_digits The number of significant decimal digits that
+  /// recorded values are resolved to, from 1 to MAX_SIGNIFICANT_DIGITS.
+  explicit LatencyHistogram(
+      const uint32_t significant_digits = DEFAULT_SIGNIFICANT_DIGITS);
+
+  void Record(const uint64_t value) { RecordValues(value, 1); }
+
+  /// Records the given value `count` times.
+  void RecordValues(const uint64_t value, const uint64_t count);
+
+  /// Adds all values recorded in the other histogram to this one. If the
+  /// histograms have a different precision, the values of the other histogram
+  /// are resolved to the precision of this one.
+  void Merge(const LatencyHistogram& other);
+
+  void Clear();
+
+  uint32_t SignificantDigits() const { return significant_digits_; }
+  uint64_t Count() const { return count_; }
+  bool Empty() const { return count_ == 0; }
+  uint64_t Min() const { return count_ == 0 ? 0 : min_; }
+  uint64_t Max() const { return max_; }
+
+  /// The mean of the recorded values, rounded down.
+  uint64_t Mean() const { return count_ == 0 ? 0 : sum_ / count_; }
+
+  /// The sample standard deviation of the recorded values. Returns 0 if fewer
+  /// than two values were recorded.
+  double StdDev() const;
+
+  /// Returns the recorded value at the given percentile, which is the value
+  /// with rank `percentile / 100 * (count - 1)` rounded to the nearest rank.
+  /// The value is exact up to the precision of the histogram.
+  /// \param percentile The percentile between 0 and 100.
+  uint64_t ValueAtPercentile(const double percentile) const;
+
+  /// Returns the buckets holding at least one value, in increasing order.
+  std::vector<Bucket> Buckets() const;
+
+ private:
+  size_t IndexOf(const uint64_t value) const;
+  uint32_t BucketIndexOf(const uint64_t value) const;
+  uint64_t LowestEquivalentValue(const size_t index) const;
+  uint64_t HighestEquivalentValue(const size_t index) const;
+  void AddToBucket(const uint64_t value, const uint64_t count);
+
+  uint32_t significant_digits_;
+  uint32_t sub_bucket_half_count_magnitude_;
+  uint64_t sub_bucket_half_count_;
+  uint64_t sub_bucket_mask_;
+
+  // Grown on demand up to the index of the largest recorded value
+  std::vector<uint64_t> counts_;
+
+  uint64_t count_{0};
+  uint64_t min_{std::numeric_limits<uint64_t>::max()};
+  uint64_t max_{0};
+  uint64_t sum_{0};
+  // Running mean and sum of squared differences from the mean
+  double mean_{0};
+  double m2_{0};
+};
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,250 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "load_curve.h"
+
+#include <cmath>
+#include <map>
+#include <numbers>
+#include <stdexcept>
+
+#include "perf_utils.h"
+
+namespace triton { namespace perfanalyzer {
+
+LoadCurve
+LoadCurve::Parse(const std::string& spec)
+{
+  const size_t colon_pos{spec.find(':')};
+  if (colon_pos == std::string::npos) {
+    throw std::invalid_argument(
+        "The value does not match <linear|sine>:<key=value>,...");
+  }
+  const std::string shape{spec.substr(0, colon_pos)};
+  const std::vector<std::string> args{
+      SplitString(spec.substr(colon_pos + 1), ",")};
+
+  if (shape == "linear") {
+    std::vector<std::pair<double, double>> points;
+    for (const auto& arg : args) {
+      const auto [time_s, rate]{SplitKeyValue(arg)};
+      points.emplace_back(ParseNumber(time_s), ParseNumber(rate));
+    }
+    return Linear(std::move(points));
+  } else if (shape == "sine") {
+    std::map<std::string, double> params{};
+    for (const auto& arg : args) {
+      const auto [key, value]{SplitKeyValue(arg)};
+      params[key] = ParseNumber(value);
+    }
+    for (const auto& key : {"base", "amplitude", "period", "duration"}) {
+      if (params.count(key) == 0) {
+        throw std::invalid_argument(
+            "The sine curve requires '" + std::string(key) + "'.");
+      }
+    }
+    if (params.size() != 4) {
+      throw std::invalid_argument(
+          "The sine curve only takes 'base', 'amplitude', 'period' and "
+          "'duration'.");
+    }
+    return Sine(
+        params["base"], params["amplitude"], params["period"],
+        params["duration"]);
+  }
+  throw std::invalid_argument(
+      "Unsupported curve shape provided: '" + shape +
+      "'. Choices are 'linear' or 'sine'.");
+}
+
+LoadCurve
+LoadCurve::Linear(std::vector<std::pair<double, double>> points)
+{
+  if (points.size() < 2) {
+    throw std::invalid_argument("The linear curve requires at least 2 points.");
+  }
+  if (points.front().first != 0) {
+    throw std::invalid_argument("The first point must be at 0 seconds.");
+  }
+  for (size_t i = 0; i < points.size(); i++) {
+    if (points[i].second <= 0) {
+      throw std::invalid_argument("The rates must be > 0.");
+    }
+    if (i > 0 && points[i].first < points[i - 1].first) {
+      throw std::invalid_argument("The times of the points must not decrease.");
+    }
+  }
+  if (points.back().first <= 0) {
+    throw std::invalid_argument("The duration must be > 0.");
+  }
+
+  LoadCurve curve{};
+  curve.shape_ = Shape::Linear;
+  curve.duration_s_ = points.back().first;
+  curve.points_ = std::move(points);
+  return curve;
+}
+
+LoadCurve
+LoadCurve::Sine(
+    const double base, const double amplitude, const double period_s,
+    const double duration_s)
+{
+  if (amplitude < 0 || amplitude >= base) {
+    throw std::invalid_argument(
+        "The amplitude must be >= 0 and smaller than the base.");
+  }
+  if (period_s <= 0) {
+    throw std::invalid_argument("The period must be > 0.");
+  }
+  if (duration_s <= 0) {
+    throw std::invalid_argument("The duration must be > 0.");
+  }
+
+  LoadCurve curve{};
+  curve.shape_ = Shape::Sine;
+  curve.duration_s_ = duration_s;
+  curve.base_ = base;
+  curve.amplitude_ = amplitude;
+  curve.period_s_ = period_s;
+  return curve;
+}
+
+double
+LoadCurve::RateAt(const double t_s) const
+{
+  if (shape_ == Shape::Sine) {
+    const double t{std::min(std::max(t_s, 0.0), duration_s_)};
+    return base_ + amplitude_ * std::sin(2 * std::numbers::pi * t / period_s_);
+  }
+
+  if (t_s <= 0) {
+    return points_.front().second;
+  }
+  for (size_t i = 1; i < points_.size(); i++) {
+    const auto& [t0, r0]{points_[i - 1]};
+    const auto& [t1, r1]{points_[i]};
+    if (t_s < t1) {
+      return r0 + (r1 - r0) * (t_s - t0) / (t1 - t0);
+    }
+  }
+  return points_.back().second;
+}
+
+double
+LoadCurve::RequestsUntil(const double t_s) const
+{
+  if (t_s <= 0) {
+    return 0;
+  }
+
+  if (shape_ == Shape::Sine) {
+    const double t{std::min(t_s, duration_s_)};
+    const double omega{2 * std::numbers::pi / period_s_};
+    const double requests{
+        base_ * t + amplitude_ / omega * (1 - std::cos(omega * t))};
+    return requests + (t_s - t) * RateAt(duration_s_);
+  }
+
+  double requests{0};
+  for (size_t i = 1; i < points_.size(); i++) {
+    const auto& [t0, r0]{points_[i - 1]};
+    const auto& [t1, r1]{points_[i]};
+    if (t_s <= t0) {
+      return requests;
+    }
+    // Trapezoid up to the end of the segment or the given time
+    const double t{std::min(t_s, t1)};
+    if (t > t0) {
+      const double rate_at_t{r0 + (r1 - r0) * (t - t0) / (t1 - t0)};
+      requests += (r0 + rate_at_t) / 2 * (t - t0);
+    }
+  }
+  if (t_s > duration_s_) {
+    requests += (t_s - duration_s_) * points_.back().second;
+  }
+  return requests;
+}
+
+double
+LoadCurve::TimeOfRequests(const double requests) const
+{
+  if (requests <= 0) {
+    return 0;
+  }
+
+  // The number of requests only grows with time, so the time can be found by
+  // bisection once it is bracketed
+  double low{0};
+  double high{duration_s_};
+  while (RequestsUntil(high) < requests) {
+    low = high;
+    high *= 2;
+  }
+  // Stop when the bracket is narrower than a nanosecond, or stops narrowing
+  // because of the precision of the time
+  for (size_t i = 0; i < 128 && high - low > 1e-9; i++) {
+    const double mid{low + (high - low) / 2};
+    if (RequestsUntil(mid) < requests) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return high;
+}
+
+size_t
+LoadCurve::ExpectedRequestCount() const
+{
+  return static_cast<size_t>(std::llround(RequestsUntil(duration_s_)));
+}
+
+std::function<std::chrono::nanoseconds(std::mt19937&)>
+LoadCurve::ScheduleDistribution(
+    std::function<std::chrono::nanoseconds(std::mt19937&)> unit_distribution)
+    const
+{
+  const auto to_nanos{[](const double seconds) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(seconds));
+  }};
+
+  // The gaps are taken between the rounded timestamps, so that they add up to
+  // the timestamps without accumulating rounding errors
+  return [curve = *this, unit_distribution = std::move(unit_distribution),
+          to_nanos, requests = 0.0,
+          last = std::chrono::nanoseconds(0)](std::mt19937& gen) mutable {
+    requests +=
+        std::chrono::duration<double>(unit_distribution(gen)).count();
+    const auto next{to_nanos(curve.TimeOfRequests(requests))};
+    const auto gap{next - last};
+    last = next;
+    return gap;
+  };
+}
+
+}}  // namespace triton::perfanalyzer
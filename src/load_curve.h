@@ -0,0 +1,120 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace triton { namespace perfanalyzer {
+
+/// A target request rate that changes over the course of a single run, in
+/// requests per second as a function of the seconds since the run started.
+/// The rate must stay above zero. After the end of the curve, it holds the
+/// rate it ends with.
+///
+/// A curve is either piecewise-linear through a list of points, where two
+/// points at the same time make a step, or sinusoidal around a base rate.
+///
+class LoadCurve {
+ public:
+  enum class Shape { Linear, Sine };
+
+  /// Parses a load curve specification, which is one of
+  ///   linear:<seconds>=<rate>,<seconds>=<rate>,...
+  ///   sine:base=<rate>,amplitude=<rate>,period=<seconds>,duration=<seconds>
+  /// \param spec The load curve specification.
+  /// \return The load curve.
+  /// \throws std::invalid_argument If the specification is not valid.
+  static LoadCurve Parse(const std::string& spec);
+
+  /// Creates a piecewise-linear curve through the given (seconds, rate)
+  /// points. The first point must be at 0 seconds, the times must not
+  /// decrease, and every rate must be above zero.
+  /// \throws std::invalid_argument If the points are not valid.
+  static LoadCurve Linear(std::vector<std::pair<double, double>> points);
+
+  /// Creates a curve of base + amplitude * sin(2 * pi * t / period) requests
+  /// per second that lasts for the given duration. The amplitude must be
+  /// smaller than the base.
+  /// \throws std::invalid_argument If the parameters are not valid.
+  static LoadCurve Sine(
+      const double base, const double amplitude, const double period_s,
+      const double duration_s);
+
+  Shape GetShape() const { return shape_; }
+
+  /// The duration of the curve in seconds
+  double Duration() const { return duration_s_; }
+
+  /// Returns the target request rate at the given time
+  double RateAt(const double t_s) const;
+
+  /// Returns the number of requests the curve sends from its start until the
+  /// given time, the integral of the rate
+  double RequestsUntil(const double t_s) const;
+
+  /// Returns the time at which the curve has sent the given number of
+  /// requests, the inverse of RequestsUntil
+  double TimeOfRequests(const double requests) const;
+
+  /// The average request rate over the duration of the curve
+  double MeanRate() const { return RequestsUntil(duration_s_) / duration_s_; }
+
+  /// The number of requests the curve sends over its duration, rounded to the
+  /// nearest integer
+  size_t ExpectedRequestCount() const;
+
+  /// Returns a distribution of the gaps between requests that follows the
+  /// curve. The given distribution with a mean gap of one second sets the
+  /// shape of the arrivals: its gaps are taken as numbers of requests along
+  /// the curve and converted to time, so that a Poisson process stays Poisson
+  /// at every point of the curve. The returned distribution starts at the
+  /// beginning of the curve and must be called in sequence.
+  /// \param unit_distribution The gap distribution at one request per second.
+  std::function<std::chrono::nanoseconds(std::mt19937&)> ScheduleDistribution(
+      std::function<std::chrono::nanoseconds(std::mt19937&)>
+          unit_distribution) const;
+
+ private:
+  LoadCurve() = default;
+
+  Shape shape_{Shape::Linear};
+  double duration_s_{0};
+
+  // Linear
+  std::vector<std::pair<double, double>> points_{};
+
+  // Sine
+  double base_{0};
+  double amplitude_{0};
+  double period_s_{0};
+};
+
+}}  // namespace triton::perfanalyzer
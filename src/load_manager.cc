@@ -27,7 +27,9 @@
 #include "load_manager.h"
 
 #include <algorithm>
+#include <system_error>
 
+#include "binary_trace.h"
 #include "client_backend/client_backend.h"
 #include "infer_data_manager_factory.h"
 
@@ -59,19 +61,17 @@ LoadManager::CheckHealth()
 }
 
 cb::Error
-LoadManager::SwapRequestRecords(std::vector<RequestRecord>& new_request_records)
+LoadManager::SwapRequestRecords(RequestRecordStore& new_request_records)
 {
-  std::vector<RequestRecord> total_request_records;
-  // Gather request records with proper locking from all the worker threads
+  RequestRecordStore total_request_records;
+  // Take the request records from all the worker threads. This never blocks
+  // the workers, it only waits for an append that is already in progress.
   for (auto& thread_stat : threads_stat_) {
-    std::lock_guard<std::mutex> lock(thread_stat->mu_);
-    total_request_records.insert(
-        total_request_records.end(), thread_stat->request_records_.begin(),
-        thread_stat->request_records_.end());
-    thread_stat->request_records_.clear();
+    record_handoff_wait_ns_ +=
+        thread_stat->request_records_.TakeAll(total_request_records);
   }
   // Swap the results
-  total_request_records.swap(new_request_records);
+  std::swap(total_request_records, new_request_records);
   return cb::Error::Success;
 }
 
@@ -80,7 +80,6 @@ LoadManager::CountCollectedRequests()
 {
   uint64_t num_of_requests = 0;
   for (auto& thread_stat : threads_stat_) {
-    std::lock_guard<std::mutex> lock(thread_stat->mu_);
     num_of_requests += thread_stat->request_records_.size();
   }
   return num_of_requests;
@@ -93,6 +92,9 @@ LoadManager::GetAccumulatedClientStat(cb::InferStat* contexts_stat)
   contexts_stat->cumulative_receive_time_ns = 0;
   contexts_stat->cumulative_send_time_ns = 0;
   contexts_stat->cumulative_total_request_time_ns = 0;
+  contexts_stat->new_connection_count = 0;
+  contexts_stat->reused_connection_count = 0;
+  contexts_stat->cumulative_connect_time_ns = 0;
 
   for (auto& thread_stat : threads_stat_) {
     std::lock_guard<std::mutex> lock(thread_stat->mu_);
@@ -105,6 +107,11 @@ LoadManager::GetAccumulatedClientStat(cb::InferStat* contexts_stat)
           context_stat.cumulative_send_time_ns;
       contexts_stat->cumulative_receive_time_ns +=
           context_stat.cumulative_receive_time_ns;
+      contexts_stat->new_connection_count += context_stat.new_connection_count;
+      contexts_stat->reused_connection_count +=
+          context_stat.reused_connection_count;
+      contexts_stat->cumulative_connect_time_ns +=
+          context_stat.cumulative_connect_time_ns;
     }
   }
   return cb::Error::Success;
@@ -156,6 +163,40 @@ LoadManager::GetAndResetNumSentRequests()
   return num_sent_requests;
 }
 
+size_t
+LoadManager::GetNumInFlightRequests() const
+{
+  size_t num_in_flight_requests{0};
+
+  for (const auto& thread_stat : threads_stat_) {
+    num_in_flight_requests += thread_stat->num_in_flight_requests_;
+  }
+
+  return num_in_flight_requests;
+}
+
+LatencyHistogram
+LoadManager::GetAndResetScheduleSkew()
+{
+  LatencyHistogram schedule_skew{};
+
+  for (auto& thread_stat : threads_stat_) {
+    std::lock_guard<std::mutex> lock(thread_stat->mu_);
+    schedule_skew.Merge(thread_stat->schedule_skew_);
+    thread_stat->schedule_skew_.Clear();
+  }
+
+  return schedule_skew;
+}
+
+uint64_t
+LoadManager::GetAndResetRecordHandoffWaitTime()
+{
+  const uint64_t wait_ns{record_handoff_wait_ns_};
+  record_handoff_wait_ns_ = 0;
+  return wait_ns;
+}
+
 LoadManager::LoadManager(
     const bool async, const bool streaming, const int32_t batch_size,
     const size_t max_threads, const SharedMemoryType shared_memory_type,
@@ -223,8 +264,13 @@ LoadManager::InitManagerInputs(
     } else {
       using_json_data_ = true;
       for (const auto& json_file : user_data) {
-        RETURN_IF_ERROR(data_loader_->ReadDataFromJSON(
-            parser_->Inputs(), parser_->Outputs(), json_file));
+        if (BinaryTrace::IsBinaryTrace(json_file)) {
+          RETURN_IF_ERROR(data_loader_->ReadDataFromBinaryTrace(
+              parser_->Inputs(), json_file));
+        } else {
+          RETURN_IF_ERROR(data_loader_->ReadDataFromJSON(
+              parser_->Inputs(), parser_->Outputs(), json_file));
+        }
       }
       std::cout << " Successfully read data for "
                 << data_loader_->GetDataStreamsCount() << " stream/streams";
@@ -270,6 +316,26 @@ LoadManager::StopWorkerThreads()
   threads_.clear();
 }
 
+void
+LoadManager::LaunchWorkerThread(const std::shared_ptr<IWorker>& worker)
+{
+  threads_.emplace_back([this, worker]() {
+    PinWorkerThread();
+    worker->Infer();
+  });
+}
+
+void
+LoadManager::PinWorkerThread() const
+{
+  try {
+    worker_cpus_.PinCurrentThread();
+  }
+  catch (const std::system_error& e) {
+    std::cerr << "WARNING: " << e.what() << std::endl;
+  }
+}
+
 void
 LoadManager::WaitForWarmupAndCleanup()
 {
@@ -34,8 +34,12 @@
 #include "client_backend/client_backend.h"
 #include "data_loader.h"
 #include "iinfer_data_manager.h"
+#include "latency_histogram.h"
 #include "load_worker.h"
+#include "output_capture.h"
 #include "perf_utils.h"
+#include "request_pacer.h"
+#include "request_record_store.h"
 #include "sequence_manager.h"
 
 namespace triton { namespace perfanalyzer {
@@ -76,11 +80,12 @@ class LoadManager {
   /// \return cb::Error object indicating success or failure.
   cb::Error CheckHealth();
 
-  /// Swap the content of the request records vector recorded by the load
-  /// manager with a new request records vector
-  /// \param new_request_records The request records vector to be swapped.
+  /// Swap the content of the request records recorded by the load manager
+  /// with a new request record store. The records are handed off without
+  /// blocking the worker threads.
+  /// \param new_request_records The request record store to be swapped.
   /// \return cb::Error object indicating success or failure.
-  cb::Error SwapRequestRecords(std::vector<RequestRecord>& new_request_records);
+  cb::Error SwapRequestRecords(RequestRecordStore& new_request_records);
 
   /// Get the sum of all contexts' stat
   /// \param contexts_stat Returned the accumulated stat from all contexts
@@ -101,6 +106,58 @@ class LoadManager {
   /// \return The total number of sent requests across all threads.
   const size_t GetAndResetNumSentRequests();
 
+  /// \return The number of requests sent and not completed across all
+  /// threads.
+  size_t GetNumInFlightRequests() const;
+
+  /// Returns the total time SwapRequestRecords spent waiting for worker
+  /// threads to finish appending a record since the last call, and resets it.
+  /// \return The wait time in nanoseconds.
+  uint64_t GetAndResetRecordHandoffWaitTime();
+
+  /// Set how the response outputs of the requests are recorded. Must be
+  /// called before the worker threads are created.
+  /// \param output_capture The output capture configuration.
+  void SetOutputCapture(const OutputCapture& output_capture)
+  {
+    output_capture_ = output_capture;
+  }
+
+  /// Set how request-rate workers wait for the scheduled time of each
+  /// request. Must be called before the worker threads are created.
+  /// \param request_pacing The pacing configuration.
+  void SetRequestPacing(const RequestPacing& request_pacing)
+  {
+    request_pacing_ = request_pacing;
+  }
+
+  /// Set how concurrency workers keep their requests in flight. Must be
+  /// called before the worker threads are created.
+  /// \param concurrency_engine The engine of the concurrency workers.
+  void SetConcurrencyEngine(const ConcurrencyEngine concurrency_engine)
+  {
+    concurrency_engine_ = concurrency_engine;
+  }
+
+  /// Set the CPUs that the worker threads are pinned to. Must be called
+  /// before the worker threads are created.
+  /// \param worker_cpus The CPUs of the workers. Empty to leave them unpinned.
+  void SetWorkerCpus(const cb::CpuAffinity& worker_cpus)
+  {
+    worker_cpus_ = worker_cpus;
+  }
+
+  /// Merges how late the requests were sent relative to their schedule
+  /// across all threads since the last call, and resets it.
+  /// \return The histogram of the schedule skew in nanoseconds.
+  LatencyHistogram GetAndResetScheduleSkew();
+
+  /// \return the manager of the input data that the requests are sent with
+  const std::shared_ptr<IInferDataManager>& GetInferDataManager() const
+  {
+    return infer_data_manager_;
+  }
+
   /// \return the batch size used for the inference requests
   virtual size_t BatchSize() const { return batch_size_; }
 
@@ -134,6 +191,15 @@ class LoadManager {
   /// Stops all the worker threads generating the request load.
   void StopWorkerThreads();
 
+  /// Starts a worker thread that pins itself to the worker CPUs before it
+  /// runs the worker, so that the contexts and buffers the worker allocates
+  /// are placed on the memory of those CPUs.
+  /// \param worker The worker to run on the new thread.
+  void LaunchWorkerThread(const std::shared_ptr<IWorker>& worker);
+
+  /// Pins the calling thread to the worker CPUs, if any were set.
+  void PinWorkerThread() const;
+
   /// Waits for worker threads to complete then reset data members after warmup
   virtual void WaitForWarmupAndCleanup();
 
@@ -152,6 +218,11 @@ class LoadManager {
   std::shared_ptr<DataLoader> data_loader_;
   std::shared_ptr<IInferDataManager> infer_data_manager_;
 
+  OutputCapture output_capture_{};
+  RequestPacing request_pacing_{};
+  ConcurrencyEngine concurrency_engine_{ConcurrencyEngine::Threaded};
+  cb::CpuAffinity worker_cpus_{};
+
   // Track the workers so they all go out of scope at the
   // same time
   std::vector<std::shared_ptr<IWorker>> workers_;
@@ -160,6 +231,8 @@ class LoadManager {
   std::vector<std::thread> threads_;
   // Contains the statistics on the current working threads
   std::vector<std::shared_ptr<ThreadStat>> threads_stat_;
+  // Time SwapRequestRecords spent waiting on in-progress record appends
+  uint64_t record_handoff_wait_ns_{0};
   // Contains the configs for the current working threads
   std::vector<std::shared_ptr<ThreadConfig>> threads_config_;
 
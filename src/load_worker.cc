@@ -92,6 +92,7 @@ void
 LoadWorker::CreateContext()
 {
   auto ctx = CreateInferContext();
+  ctx->SetOutputCapture(thread_config_->output_capture_);
   ctx->Init();
   CreateContextFinalize(ctx);
   ctxs_.push_back(ctx);
@@ -74,7 +74,8 @@ class LoadWorker : public IWorker {
   // finished
   uint GetNumOngoingRequests();
 
-  void SendInferRequest(uint32_t ctx_id, bool delayed = false)
+  void SendInferRequest(
+      uint32_t ctx_id, bool delayed = false, uint64_t scheduled_ns = 0)
   {
     if (ShouldExit()) {
       return;
@@ -82,9 +83,10 @@ class LoadWorker : public IWorker {
 
     if (on_sequence_model_) {
       uint32_t seq_stat_index = GetSeqStatIndex(ctx_id);
-      ctxs_[ctx_id]->SendSequenceInferRequest(seq_stat_index, delayed);
+      ctxs_[ctx_id]->SendSequenceInferRequest(
+          seq_stat_index, delayed, scheduled_ns);
     } else {
-      ctxs_[ctx_id]->SendInferRequest(delayed);
+      ctxs_[ctx_id]->SendInferRequest(delayed, scheduled_ns);
     }
   }
 
@@ -28,6 +28,7 @@
 #include "client_backend/triton_c_api/triton_loader.h"
 #endif  // TRITON_ENABLE_PERF_ANALYZER_C_API
 
+#include "data_loader.h"
 #include "perf_analyzer.h"
 #include "perf_analyzer_exception.h"
 
@@ -41,8 +42,17 @@ main(int argc, char* argv[])
     triton::perfanalyzer::CLParser clp;
     pa::PAParamsPtr params = clp.Parse(argc, argv);
 
-    PerfAnalyzer analyzer(params);
-    analyzer.Run();
+    if (!params->convert_input_data.empty()) {
+      FAIL_IF_ERR(
+          pa::DataLoader::ConvertToBinaryTrace(
+              params->user_data[0], params->convert_input_data),
+          "failed to convert the input data");
+      std::cout << "Wrote the binary trace of '" << params->user_data[0]
+                << "' to '" << params->convert_input_data << "'." << std::endl;
+    } else {
+      PerfAnalyzer analyzer(params);
+      analyzer.Run();
+    }
   }
   catch (pa::PerfAnalyzerException& e) {
     std::cerr << e.what() << std::endl;
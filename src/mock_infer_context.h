@@ -35,16 +35,15 @@ class NaggyMockInferContext : public InferContext {
   NaggyMockInferContext()
   {
     ON_CALL(*this, SendRequest(testing::_, testing::_, testing::_))
-        .WillByDefault(
-            [this](
-                const uint64_t request_id, const bool delayed,
-                const uint64_t sequence_id) -> void {
-              this->InferContext::SendRequest(request_id, delayed, sequence_id);
-            });
+        .WillByDefault([this](
+                           const bool delayed, const uint64_t sequence_id,
+                           const uint64_t scheduled_ns) -> void {
+          this->InferContext::SendRequest(delayed, sequence_id, scheduled_ns);
+        });
   }
 
   MOCK_METHOD(
-      void, SendRequest, (const uint64_t, const bool, const uint64_t),
+      void, SendRequest, (const bool, const uint64_t, const uint64_t),
       (override));
 
   std::shared_ptr<SequenceManager>& sequence_manager_{
@@ -42,19 +42,19 @@ class NaggyMockInferenceProfiler : public InferenceProfiler {
             [this](
                 const std::pair<uint64_t, uint64_t>& valid_range,
                 size_t& valid_sequence_count, size_t& delayed_request_count,
-                std::vector<uint64_t>* latencies, size_t& response_count,
-                std::vector<RequestRecord>& valid_requests) -> void {
+                LatencyHistogram* latency_histogram, size_t& response_count,
+                RequestRecordStore& valid_requests) -> void {
               this->InferenceProfiler::ValidLatencyMeasurement(
                   valid_range, valid_sequence_count, delayed_request_count,
-                  latencies, response_count, valid_requests);
+                  latency_histogram, response_count, valid_requests);
             });
     ON_CALL(*this, SummarizeLatency(testing::_, testing::_))
         .WillByDefault(
             [this](
-                const std::vector<uint64_t>& latencies,
+                const LatencyHistogram& latency_histogram,
                 PerfStatus& summary) -> cb::Error {
               return this->InferenceProfiler::SummarizeLatency(
-                  latencies, summary);
+                  latency_histogram, summary);
             });
     ON_CALL(*this, MergePerfStatusReports(testing::_, testing::_))
         .WillByDefault(
@@ -94,10 +94,10 @@ class NaggyMockInferenceProfiler : public InferenceProfiler {
   MOCK_METHOD(
       void, ValidLatencyMeasurement,
       ((const std::pair<uint64_t, uint64_t>&), size_t&, size_t&,
-       std::vector<uint64_t>*, size_t&, std::vector<RequestRecord>&),
+       LatencyHistogram*, size_t&, RequestRecordStore&),
       (override));
   MOCK_METHOD(
-      cb::Error, SummarizeLatency, (const std::vector<uint64_t>&, PerfStatus&),
+      cb::Error, SummarizeLatency, (const LatencyHistogram&, PerfStatus&),
       (override));
   MOCK_METHOD(
       cb::Error, MergePerfStatusReports, (std::deque<PerfStatus>&, PerfStatus&),
@@ -114,7 +114,7 @@ class NaggyMockInferenceProfiler : public InferenceProfiler {
   std::shared_ptr<ModelParser>& parser_{InferenceProfiler::parser_};
   std::unique_ptr<LoadManager>& manager_{InferenceProfiler::manager_};
   bool& include_lib_stats_{InferenceProfiler::include_lib_stats_};
-  std::vector<RequestRecord>& all_request_records_{
+  RequestRecordStore& all_request_records_{
       InferenceProfiler::all_request_records_};
 };
 
@@ -79,6 +79,15 @@ class NaggyMockProfileDataExporter : public ProfileDataExporter {
           this->ProfileDataExporter::AddEndpoint(endpoint);
         });
 
+    ON_CALL(*this, AddTimeline(testing::_, testing::_))
+        .WillByDefault(
+            [this](
+                rapidjson::Value& entry,
+                const std::vector<ProfileDataCollector::TimelineSecond>&
+                    timeline) -> void {
+              this->ProfileDataExporter::AddTimeline(entry, timeline);
+            });
+
     ON_CALL(*this, ClearDocument()).WillByDefault([this]() -> void {
       this->ProfileDataExporter::ClearDocument();
     });
@@ -100,6 +109,10 @@ class NaggyMockProfileDataExporter : public ProfileDataExporter {
   MOCK_METHOD(void, OutputToFile, (std::string&), (override));
   MOCK_METHOD(void, AddServiceKind, (cb::BackendKind&));
   MOCK_METHOD(void, AddEndpoint, (std::string&));
+  MOCK_METHOD(
+      void, AddTimeline,
+      (rapidjson::Value&,
+       const std::vector<ProfileDataCollector::TimelineSecond>&));
   MOCK_METHOD(void, ClearDocument, ());
 
   rapidjson::Document& document_{ProfileDataExporter::document_};
@@ -0,0 +1,97 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "output_capture.h"
+
+#include <cstring>
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+// Finalizer of the SplitMix64 generator
+uint64_t
+Mix(uint64_t x)
+{
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+}  // namespace
+
+OutputCapturePolicy
+OutputCaptureSampler::Next()
+{
+  if (capture_.policy != OutputCapturePolicy::Sampled) {
+    return capture_.policy;
+  }
+  if (capture_.sample_rate <= 1) {
+    return OutputCapturePolicy::Full;
+  }
+  const uint64_t x{Mix(
+      state_.fetch_add(0x9e3779b97f4a7c15ULL, std::memory_order_relaxed))};
+  return (x % capture_.sample_rate == 0) ? OutputCapturePolicy::Full
+                                         : OutputCapturePolicy::None;
+}
+
+// MurmurHash64A
+uint64_t
+HashOutputData(const uint8_t* data, const size_t size)
+{
+  constexpr uint64_t m{0xc6a4a7935bd1e995ULL};
+  constexpr int r{47};
+
+  uint64_t h{0x8445d61a4e774912ULL ^ (size * m)};
+
+  const uint8_t* end{data + (size / 8) * 8};
+  for (const uint8_t* p = data; p != end; p += 8) {
+    uint64_t k;
+    std::memcpy(&k, p, sizeof(k));
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+    h ^= k;
+    h *= m;
+  }
+
+  const size_t remaining{size & 7};
+  if (remaining != 0) {
+    uint64_t k{0};
+    for (size_t i = 0; i < remaining; i++) {
+      k |= static_cast<uint64_t>(end[i]) << (8 * i);
+    }
+    h ^= k;
+    h *= m;
+  }
+
+  h ^= h >> r;
+  h *= m;
+  h ^= h >> r;
+  return h;
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,86 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace triton { namespace perfanalyzer {
+
+/// How the response outputs of a request are recorded for the profile export
+enum class OutputCapturePolicy {
+  // Outputs are not recorded
+  None,
+  // A 64-bit hash of the content and the size of each output are recorded
+  Hash,
+  // The outputs of a random one in every N requests are recorded in full
+  Sampled,
+  // Every output is recorded in full
+  Full
+};
+
+struct OutputCapture {
+  OutputCapturePolicy policy{OutputCapturePolicy::Full};
+  // With the Sampled policy, the number of requests per captured request
+  uint64_t sample_rate{1};
+};
+
+/// Decides how the outputs of each request are captured according to an
+/// OutputCapture configuration. Safe to share between threads.
+class OutputCaptureSampler {
+ public:
+  explicit OutputCaptureSampler(
+      const OutputCapture& capture = OutputCapture{}, const uint64_t seed = 0)
+      : capture_(capture), state_(seed)
+  {
+  }
+
+  OutputCaptureSampler(const OutputCaptureSampler& other)
+      : capture_(other.capture_), state_(other.state_.load())
+  {
+  }
+
+  OutputCaptureSampler& operator=(const OutputCaptureSampler& other)
+  {
+    capture_ = other.capture_;
+    state_ = other.state_.load();
+    return *this;
+  }
+
+  /// Returns how the outputs of the next request should be captured. The
+  /// Sampled policy resolves to either Full or None.
+  OutputCapturePolicy Next();
+
+ private:
+  OutputCapture capture_;
+  std::atomic<uint64_t> state_;
+};
+
+/// Returns a 64-bit hash of the given output data
+uint64_t HashOutputData(const uint8_t* data, const size_t size);
+
+}}  // namespace triton::perfanalyzer
@@ -26,6 +26,8 @@
 
 #include "perf_analyzer.h"
 
+#include <system_error>
+
 #include "custom_request_schedule_manager.h"
 #include "inference_load_mode.h"
 #include "perf_analyzer_exception.h"
@@ -86,7 +88,8 @@ PerfAnalyzer::CreateAnalyzerObjects()
           params_->triton_server_path, params_->model_repository_path,
           params_->extra_verbose, params_->metrics_url,
           params_->input_tensor_format, params_->output_tensor_format,
-          params_->grpc_method, &factory),
+          params_->grpc_method, params_->completion_cpus,
+          params_->transfer_shards, params_->max_connections, &factory),
       "failed to create client factory");
 
   FAIL_IF_ERR(
@@ -251,12 +254,12 @@ PerfAnalyzer::CreateAnalyzerObjects()
       FAIL_IF_ERR(
           pa::RequestRateManager::Create(
               params_->async, params_->streaming,
-              params_->measurement_window_ms, params_->max_trials,
               params_->request_distribution, params_->batch_size,
               params_->max_threads, params_->num_of_sequences,
               params_->shared_memory_type, params_->output_shm_size,
               params_->serial_sequences, parser_, factory, &manager,
-              params_->request_parameters),
+              params_->request_parameters,
+              params_->request_distribution_params),
           "failed to create request rate manager");
     }
   } else if (
@@ -271,8 +274,7 @@ PerfAnalyzer::CreateAnalyzerObjects()
     }
     FAIL_IF_ERR(
         pa::CustomLoadManager::Create(
-            params_->async, params_->streaming, params_->measurement_window_ms,
-            params_->max_trials, params_->request_intervals_file,
+            params_->async, params_->streaming, params_->request_intervals_file,
             params_->batch_size, params_->max_threads,
             params_->num_of_sequences, params_->shared_memory_type,
             params_->output_shm_size, params_->serial_sequences, parser_,
@@ -303,6 +305,14 @@ PerfAnalyzer::CreateAnalyzerObjects()
       params_->sequence_id_range, params_->sequence_length,
       params_->sequence_length_specified, params_->sequence_length_variation);
 
+  // A fixed schedule sends the requests of its trace inside the window
+  auto* custom_manager{
+      dynamic_cast<pa::CustomRequestScheduleManager*>(manager.get())};
+  if (custom_manager) {
+    params_->request_count = custom_manager->ScheduleSize();
+    params_->measurement_request_count = params_->request_count;
+  }
+
   FAIL_IF_ERR(
       pa::ProfileDataCollector::Create(&collector_),
       "failed to create profile data collector");
@@ -312,6 +322,31 @@ PerfAnalyzer::CreateAnalyzerObjects()
       "failed to create profile data exporter");
   if (params_->simple)
     exporter_->set_simple();
+  exporter_->SetInferDataManager(manager->GetInferDataManager());
+
+  // Response outputs are only read by the full profile export
+  pa::OutputCapture output_capture{params_->output_capture};
+  if (params_->profile_export_file.empty() || params_->simple) {
+    output_capture.policy = pa::OutputCapturePolicy::None;
+  }
+  manager->SetOutputCapture(output_capture);
+  manager->SetRequestPacing(params_->request_pacing);
+  manager->SetConcurrencyEngine(params_->concurrency_engine);
+  // Threads start on the CPUs of the thread that creates them, so keep the
+  // workers off the profiler CPUs even when they are not pinned themselves
+  cb::CpuAffinity worker_cpus{params_->worker_cpus};
+  if (worker_cpus.Empty() && !params_->profiler_cpus.Empty()) {
+    worker_cpus = cb::CpuAffinity::Current();
+  }
+  manager->SetWorkerCpus(worker_cpus);
+  if (!params_->request_rate_curve.empty()) {
+    auto* request_rate_manager{
+        dynamic_cast<pa::RequestRateManager*>(manager.get())};
+    if (request_rate_manager) {
+      request_rate_manager->SetLoadCurve(std::make_shared<const pa::LoadCurve>(
+          pa::LoadCurve::Parse(params_->request_rate_curve)));
+    }
+  }
   FAIL_IF_ERR(
       pa::InferenceProfiler::Create(
           params_->verbose, params_->stability_threshold,
@@ -321,8 +356,10 @@ PerfAnalyzer::CreateAnalyzerObjects()
           params_->measurement_request_count, params_->measurement_mode,
           params_->mpi_driver, params_->metrics_interval_ms,
           params_->should_collect_metrics, params_->overhead_pct_threshold,
-          params_->async, collector_, !params_->profile_export_file.empty()),
+          params_->async, collector_, !params_->profile_export_file.empty(),
+          params_->latency_histogram_precision),
       "failed to create profiler");
+  profiler_->SetGoodputSlo(params_->goodput_slo);
 }
 
 void
@@ -399,20 +436,61 @@ PerfAnalyzer::PrerunReport()
                 << " requests per seconds" << std::endl;
     }
   }
+  if (!params_->request_rate_curve.empty()) {
+    std::cout << "  Request rate following the load curve '"
+              << params_->request_rate_curve << "'" << std::endl;
+  }
   if (params_->inference_load_mode == pa::InferenceLoadMode::RequestRate) {
+    const auto& distribution_params{params_->request_distribution_params};
     if (params_->request_distribution == pa::Distribution::POISSON) {
       std::cout << "  Using poisson distribution on request generation"
                 << std::endl;
+    } else if (params_->request_distribution == pa::Distribution::GAMMA) {
+      std::cout << "  Using gamma distribution (cv " << distribution_params.cv
+                << ") on request generation" << std::endl;
+    } else if (params_->request_distribution == pa::Distribution::LOGNORMAL) {
+      std::cout << "  Using lognormal distribution (cv "
+                << distribution_params.cv << ") on request generation"
+                << std::endl;
+    } else if (params_->request_distribution == pa::Distribution::PARETO) {
+      std::cout << "  Using pareto distribution (alpha "
+                << distribution_params.pareto_alpha
+                << ") on request generation" << std::endl;
+    } else if (params_->request_distribution == pa::Distribution::MMPP) {
+      std::cout << "  Using MMPP distribution (burst ratio "
+                << distribution_params.burst_ratio << ", burst fraction "
+                << distribution_params.burst_fraction << ", mean burst "
+                << distribution_params.burst_ms
+                << " ms) on request generation" << std::endl;
     } else {
       std::cout << "  Using uniform distribution on request generation"
                 << std::endl;
     }
+    if (params_->request_pacing.dispatch == pa::RequestDispatch::TimingWheel) {
+      std::cout << "  Dispatching requests to the workers from a timing wheel"
+                << std::endl;
+    }
   }
   if (params_->search_mode == pa::SearchMode::BINARY) {
     std::cout << "  Using Binary Search algorithm" << std::endl;
+  } else if (params_->search_mode == pa::SearchMode::GOODPUT) {
+    std::cout << "  Searching for the highest load with p"
+              << params_->goodput_slo.percentile << " latency below "
+              << (params_->goodput_slo.latency_limit_ns / pa::NANOS_PER_MILLIS)
+              << " msec";
+    if (params_->goodput_slo.max_error_rate < 1) {
+      std::cout << " and error rate up to "
+                << params_->goodput_slo.max_error_rate;
+    }
+    std::cout << std::endl;
   }
   if (params_->async) {
     std::cout << "  Using asynchronous calls for inference" << std::endl;
+    if (params_->inference_load_mode == pa::InferenceLoadMode::Concurrency &&
+        params_->concurrency_engine == pa::ConcurrencyEngine::EventLoop) {
+      std::cout << "  Sending requests from the completion callbacks"
+                << std::endl;
+    }
   } else {
     std::cout << "  Using synchronous calls for inference" << std::endl;
   }
@@ -421,6 +499,25 @@ PerfAnalyzer::PrerunReport()
                  "measuring latency"
               << std::endl;
   }
+  const auto report_cpus{[](const std::string& threads,
+                            const cb::CpuAffinity& cpus) {
+    if (cpus.Empty()) {
+      return;
+    }
+    std::cout << "  Pinning the " << threads << " to CPUs " << cpus.ToString();
+    const std::vector<int> nodes{cpus.NumaNodes()};
+    for (size_t i = 0; i < nodes.size(); i++) {
+      std::cout << (i == 0 ? " on NUMA node " : ",") << nodes[i];
+    }
+    std::cout << std::endl;
+  }};
+  report_cpus("worker threads", params_->worker_cpus);
+  report_cpus("completion threads", params_->completion_cpus);
+  report_cpus("profiler thread", params_->profiler_cpus);
+  if (params_->transfer_shards > 1) {
+    std::cout << "  Transferring the requests of each client on "
+              << params_->transfer_shards << " threads" << std::endl;
+  }
 
   std::cout << std::endl;
 }
@@ -430,6 +527,13 @@ PerfAnalyzer::Profile()
 {
   params_->mpi_driver->MPIBarrierWorld();
 
+  try {
+    params_->profiler_cpus.PinCurrentThread();
+  }
+  catch (const std::system_error& e) {
+    std::cerr << "WARNING: " << e.what() << std::endl;
+  }
+
   cb::Error err;
   if (params_->inference_load_mode == pa::InferenceLoadMode::Concurrency) {
     err = profiler_->Profile<size_t>(
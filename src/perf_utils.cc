@@ -33,8 +33,11 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cmath>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 #include "client_backend/client_backend.h"
@@ -396,6 +399,113 @@ ScheduleDistribution<Distribution::CONSTANT>(const double request_rate)
   return [period](std::mt19937& /*gen*/) { return period; };
 }
 
+namespace {
+
+std::chrono::nanoseconds
+SecondsToNanos(const double seconds)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double>(seconds));
+}
+
+}  // namespace
+
+template <>
+std::function<std::chrono::nanoseconds(std::mt19937&)>
+ScheduleDistribution<Distribution::GAMMA>(
+    const double request_rate, const DistributionParams& params)
+{
+  // A gamma distribution with shape k has a coefficient of variation of
+  // 1/sqrt(k), and the scale sets its mean to 1/request_rate
+  const double shape{1.0 / (params.cv * params.cv)};
+  std::gamma_distribution<> dist(shape, 1.0 / (request_rate * shape));
+  return [dist](std::mt19937& gen) mutable {
+    return SecondsToNanos(dist(gen));
+  };
+}
+
+template <>
+std::function<std::chrono::nanoseconds(std::mt19937&)>
+ScheduleDistribution<Distribution::LOGNORMAL>(
+    const double request_rate, const DistributionParams& params)
+{
+  const double sigma_squared{std::log1p(params.cv * params.cv)};
+  const double mu{-std::log(request_rate) - sigma_squared / 2};
+  std::lognormal_distribution<> dist(mu, std::sqrt(sigma_squared));
+  return [dist](std::mt19937& gen) mutable {
+    return SecondsToNanos(dist(gen));
+  };
+}
+
+template <>
+std::function<std::chrono::nanoseconds(std::mt19937&)>
+ScheduleDistribution<Distribution::PARETO>(
+    const double request_rate, const DistributionParams& params)
+{
+  // The minimum gap that gives a mean of 1/request_rate
+  const double alpha{params.pareto_alpha};
+  const double scale{(alpha - 1) / (alpha * request_rate)};
+  std::uniform_real_distribution<> uniform(0.0, 1.0);
+  return [uniform, scale, alpha](std::mt19937& gen) mutable {
+    // Inverse transform sampling, with 1 - u in (0, 1] to avoid dividing by 0
+    return SecondsToNanos(scale / std::pow(1.0 - uniform(gen), 1.0 / alpha));
+  };
+}
+
+template <>
+std::function<std::chrono::nanoseconds(std::mt19937&)>
+ScheduleDistribution<Distribution::MMPP>(
+    const double request_rate, const DistributionParams& params)
+{
+  // Solve for the rates of the two states so that the long run request rate
+  // is request_rate
+  const double idle_rate{
+      request_rate / (params.burst_fraction * params.burst_ratio + 1 -
+                      params.burst_fraction)};
+  const double burst_rate{idle_rate * params.burst_ratio};
+  const double burst_duration_s{params.burst_ms / 1000};
+  const double idle_duration_s{
+      burst_duration_s * (1 - params.burst_fraction) / params.burst_fraction};
+
+  struct State {
+    std::exponential_distribution<> request_gap;
+    std::exponential_distribution<> duration;
+  };
+  std::array<State, 2> states{
+      State{
+          std::exponential_distribution<>(idle_rate),
+          std::exponential_distribution<>(1 / idle_duration_s)},
+      State{
+          std::exponential_distribution<>(burst_rate),
+          std::exponential_distribution<>(1 / burst_duration_s)}};
+
+  // The time left in the current state. Both the request gaps and the state
+  // durations are memoryless, so a gap that crosses into the next state is
+  // redrawn from the time of the switch.
+  std::bernoulli_distribution starts_in_burst(params.burst_fraction);
+  size_t current{0};
+  double remaining_s{-1};
+  return [states, starts_in_burst, current,
+          remaining_s](std::mt19937& gen) mutable {
+    if (remaining_s < 0) {
+      // Start in a state drawn from the long run fraction of time in each
+      current = starts_in_burst(gen) ? 1 : 0;
+      remaining_s = states[current].duration(gen);
+    }
+    double gap_s{0};
+    while (true) {
+      const double request_gap_s{states[current].request_gap(gen)};
+      if (request_gap_s < remaining_s) {
+        remaining_s -= request_gap_s;
+        return SecondsToNanos(gap_s + request_gap_s);
+      }
+      gap_s += remaining_s;
+      current = 1 - current;
+      remaining_s = states[current].duration(gen);
+    }
+  };
+}
+
 cb::TensorFormat
 ParseTensorFormat(const std::string& content_type_str)
 {
@@ -413,6 +523,51 @@ ParseTensorFormat(const std::string& content_type_str)
   }
 }
 
+std::vector<std::string>
+SplitString(const std::string& str, const std::string& delimiter)
+{
+  std::vector<std::string> substrs;
+  size_t pos = 0;
+  while (pos != std::string::npos) {
+    size_t colon_pos = str.find(delimiter, pos);
+    substrs.push_back(str.substr(pos, colon_pos - pos));
+    if (colon_pos == std::string::npos) {
+      pos = colon_pos;
+    } else {
+      pos = colon_pos + 1;
+    }
+  }
+  return substrs;
+}
+
+std::pair<std::string, std::string>
+SplitKeyValue(const std::string& key_value)
+{
+  const size_t equal_pos{key_value.find('=')};
+  if (equal_pos == std::string::npos) {
+    throw std::invalid_argument(
+        "'" + key_value + "' does not match <key=value>.");
+  }
+  return {key_value.substr(0, equal_pos), key_value.substr(equal_pos + 1)};
+}
+
+double
+ParseNumber(const std::string& str)
+{
+  size_t parsed{0};
+  double number{0};
+  try {
+    number = std::stod(str, &parsed);
+  }
+  catch (const std::exception&) {
+    parsed = 0;
+  }
+  if (parsed == 0 || parsed != str.size()) {
+    throw std::invalid_argument("'" + str + "' is not a number.");
+  }
+  return number;
+}
+
 std::optional<size_t>
 GetDataTypeSize(const std::string& data_type)
 {
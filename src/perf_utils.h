@@ -38,6 +38,9 @@
 #include <memory>
 #include <optional>
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "client_backend/client_backend.h"
 
@@ -62,8 +65,47 @@ std::string const character_set =
 // A boolean flag to mark an interrupt and commencement of early exit
 extern volatile bool early_exit;
 
-enum Distribution { POISSON = 0, CONSTANT = 1, CUSTOM = 2 };
-enum SearchMode { LINEAR = 0, BINARY = 1, NONE = 2 };
+enum Distribution {
+  POISSON = 0,
+  CONSTANT = 1,
+  CUSTOM = 2,
+  GAMMA = 3,
+  MMPP = 4,
+  LOGNORMAL = 5,
+  PARETO = 6
+};
+
+// Shape parameters of the request schedule distributions that take more than
+// the request rate. The mean of every distribution is set by the request rate.
+struct DistributionParams {
+  // Coefficient of variation of the gaps between requests for the GAMMA and
+  // LOGNORMAL distributions
+  double cv{1.0};
+  // Tail index of the PARETO distribution of the gaps between requests. The
+  // variance of the gaps is infinite unless it is greater than 2.
+  double pareto_alpha{2.5};
+  // The MMPP distribution alternates between a burst and an idle state,
+  // each sending requests as a Poisson process. burst_ratio is the request
+  // rate in the burst state relative to the idle state, burst_fraction is the
+  // fraction of time spent in the burst state, and burst_ms is the mean
+  // duration of a burst.
+  double burst_ratio{10.0};
+  double burst_fraction{0.1};
+  double burst_ms{50.0};
+};
+
+enum SearchMode { LINEAR = 0, BINARY = 1, NONE = 2, GOODPUT = 3 };
+
+/// How the workers of concurrency mode keep their requests in flight
+enum class ConcurrencyEngine {
+  // The worker thread is woken up by every completed request to send the next
+  // one, so each thread only keeps a handful of requests in flight
+  Threaded,
+  // The next request is sent right away from the completion callback, and the
+  // worker thread only handles pauses, exits and concurrency changes
+  EventLoop
+};
+
 enum SharedMemoryType {
   SYSTEM_SHARED_MEMORY = 0,
   CUDA_SHARED_MEMORY = 1,
@@ -135,9 +177,29 @@ template <Distribution distribution>
 std::function<std::chrono::nanoseconds(std::mt19937&)> ScheduleDistribution(
     const double request_rate);
 
+// Returns the request schedule distribution generator with the specified
+// request rate and shape parameters.
+template <Distribution distribution>
+std::function<std::chrono::nanoseconds(std::mt19937&)> ScheduleDistribution(
+    const double request_rate, const DistributionParams& params);
+
 // Parse the HTTP tensor format
 cb::TensorFormat ParseTensorFormat(const std::string& tensor_format_str);
 
+// Splits the string at every occurrence of the single character delimiter
+std::vector<std::string> SplitString(
+    const std::string& str, const std::string& delimiter = ":");
+
+// Splits "<key>=<value>" at its first '='
+// \throws std::invalid_argument if there is no '='.
+std::pair<std::string, std::string> SplitKeyValue(const std::string& key_value);
+
+// Parse a number that makes up the whole string
+// \param str The string to parse.
+// \return The number.
+// \throws std::invalid_argument if the string is not a number.
+double ParseNumber(const std::string& str);
+
 // Returns the size of a given data type in bytes.
 std::optional<size_t> GetDataTypeSize(const std::string& data_type);
 
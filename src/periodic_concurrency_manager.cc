@@ -28,7 +28,7 @@
 
 namespace triton { namespace perfanalyzer {
 
-std::vector<RequestRecord>
+RequestRecordStore
 PeriodicConcurrencyManager::RunExperiment()
 {
   AddConcurrentRequests(concurrency_range_.start);
@@ -68,10 +68,11 @@ PeriodicConcurrencyManager::AddConcurrentRequest(size_t seq_stat_index_offset)
   threads_config_.emplace_back(
       std::make_shared<ThreadConfig>(threads_config_.size()));
   threads_config_.back()->concurrency_ = 1;
+  threads_config_.back()->output_capture_ = output_capture_;
   threads_config_.back()->seq_stat_index_offset_ = seq_stat_index_offset;
   workers_.emplace_back(
       MakeWorker(threads_stat_.back(), threads_config_.back()));
-  threads_.emplace_back(&IWorker::Infer, workers_.back());
+  LaunchWorkerThread(workers_.back());
   active_threads_++;
 }
 
@@ -107,14 +108,12 @@ PeriodicConcurrencyManager::WaitForRequestsToFinish()
   all_requests_completed_future.get();
 }
 
-std::vector<RequestRecord>
+RequestRecordStore
 PeriodicConcurrencyManager::GetRequestRecords()
 {
-  std::vector<RequestRecord> request_records{};
+  RequestRecordStore request_records{};
   for (const auto& thread_stat : threads_stat_) {
-    request_records.insert(
-        request_records.end(), thread_stat->request_records_.cbegin(),
-        thread_stat->request_records_.cend());
+    thread_stat->request_records_.TakeAll(request_records);
   }
   return request_records;
 }
@@ -29,6 +29,7 @@
 
 #include "concurrency_manager.h"
 #include "periodic_concurrency_worker.h"
+#include "request_record_store.h"
 
 namespace triton { namespace perfanalyzer {
 
@@ -56,7 +57,7 @@ class PeriodicConcurrencyManager : public ConcurrencyManager {
   {
   }
 
-  std::vector<RequestRecord> RunExperiment();
+  RequestRecordStore RunExperiment();
 
  private:
   std::shared_ptr<IWorker> MakeWorker(
@@ -73,7 +74,7 @@ class PeriodicConcurrencyManager : public ConcurrencyManager {
 
   void WaitForRequestsToFinish();
 
-  std::vector<RequestRecord> GetRequestRecords();
+  RequestRecordStore GetRequestRecords();
 
   Range<uint64_t> concurrency_range_{1, 1, 1};
   uint64_t request_period_{0};
@@ -66,7 +66,7 @@ ProfileDataCollector::AddWindow(
 
 void
 ProfileDataCollector::AddData(
-    InferenceLoadMode& id, std::vector<RequestRecord>&& request_records)
+    InferenceLoadMode& id, RequestRecordStore&& request_records)
 {
   auto it = FindExperiment(id);
 
@@ -74,11 +74,69 @@ ProfileDataCollector::AddData(
     Experiment new_experiment{};
     new_experiment.mode = id;
     new_experiment.requests = std::move(request_records);
-    experiments_.push_back(new_experiment);
+    experiments_.push_back(std::move(new_experiment));
+  } else {
+    it->requests.Merge(std::move(request_records));
+  }
+}
+
+void
+ProfileDataCollector::AddLatencyHistogram(
+    InferenceLoadMode& id, const LatencyHistogram& latency_histogram,
+    const LatencyHistogram& corrected_latency_histogram)
+{
+  const auto merge{[](LatencyHistogram& dst, const LatencyHistogram& src) {
+    if (dst.Empty()) {
+      // Take over the precision of the windows instead of the default one
+      dst = src;
+    } else {
+      dst.Merge(src);
+    }
+  }};
+
+  auto it = FindExperiment(id);
+
+  if (it == experiments_.end()) {
+    Experiment new_experiment{};
+    new_experiment.mode = id;
+    new_experiment.latency_histogram = latency_histogram;
+    new_experiment.corrected_latency_histogram = corrected_latency_histogram;
+    experiments_.push_back(std::move(new_experiment));
   } else {
-    it->requests.insert(
-        it->requests.end(), std::make_move_iterator(request_records.begin()),
-        std::make_move_iterator(request_records.end()));
+    merge(it->latency_histogram, latency_histogram);
+    merge(it->corrected_latency_histogram, corrected_latency_histogram);
+  }
+}
+
+void
+ProfileDataCollector::AddTimeline(
+    InferenceLoadMode& id, std::vector<TimelineSecond>&& timeline)
+{
+  auto it = FindExperiment(id);
+
+  if (it == experiments_.end()) {
+    Experiment new_experiment{};
+    new_experiment.mode = id;
+    new_experiment.timeline = std::move(timeline);
+    experiments_.push_back(std::move(new_experiment));
+    return;
+  }
+
+  auto& experiment_timeline{it->timeline};
+  if (experiment_timeline.size() < timeline.size()) {
+    experiment_timeline.resize(timeline.size());
+  }
+  for (size_t i = 0; i < timeline.size(); i++) {
+    auto& second{experiment_timeline[i]};
+    // The target is the same for every window of the experiment
+    second.target_request_count = timeline[i].target_request_count;
+    second.sent_count += timeline[i].sent_count;
+    second.completed_count += timeline[i].completed_count;
+    if (second.latency_histogram.Empty()) {
+      second.latency_histogram = std::move(timeline[i].latency_histogram);
+    } else {
+      second.latency_histogram.Merge(timeline[i].latency_histogram);
+    }
   }
 }
 
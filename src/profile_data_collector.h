@@ -32,8 +32,9 @@
 
 #include "client_backend/client_backend.h"
 #include "constants.h"
+#include "latency_histogram.h"
 #include "perf_utils.h"
-#include "request_record.h"
+#include "request_record_store.h"
 
 namespace triton { namespace perfanalyzer {
 
@@ -70,12 +71,30 @@ class ProfileDataCollector {
     }
   };
 
+  /// Data structure to hold the load and the performance during one second
+  /// of an experiment whose request rate follows a load curve
+  struct TimelineSecond {
+    // The number of requests the load curve targets during the second
+    double target_request_count{0};
+    // The number of requests sent during the second
+    uint64_t sent_count{0};
+    // The number of requests that completed during the second, and their
+    // latencies
+    uint64_t completed_count{0};
+    LatencyHistogram latency_histogram{};
+  };
+
   /// Data structure to hold profile export data for an experiment (e.g.
   /// concurrency 4 or request rate 50)
   struct Experiment {
     InferenceLoadMode mode;
-    std::vector<RequestRecord> requests;
+    RequestRecordStore requests;
     std::vector<uint64_t> window_boundaries;
+    LatencyHistogram latency_histogram;
+    LatencyHistogram corrected_latency_histogram;
+    // Per second from the start of the load curve, if the request rate
+    // followed one
+    std::vector<TimelineSecond> timeline;
   };
 
   static cb::Error Create(std::shared_ptr<ProfileDataCollector>* collector);
@@ -92,8 +111,24 @@ class ProfileDataCollector {
   /// Add request records to an experiment
   /// @param id Identifier for the experiment
   /// @param request_records The request information for the current experiment.
-  void AddData(
-      InferenceLoadMode& id, std::vector<RequestRecord>&& request_records);
+  void AddData(InferenceLoadMode& id, RequestRecordStore&& request_records);
+
+  /// Merge the latency histograms of a measurement window into an experiment
+  /// @param id Identifier for the experiment
+  /// @param latency_histogram The latencies of the window's valid requests.
+  /// @param corrected_latency_histogram The latencies of the window's
+  /// scheduled requests, measured from when they were scheduled to be sent.
+  void AddLatencyHistogram(
+      InferenceLoadMode& id, const LatencyHistogram& latency_histogram,
+      const LatencyHistogram& corrected_latency_histogram =
+          LatencyHistogram{});
+
+  /// Merge the per-second timeline of a measurement window into an experiment
+  /// @param id Identifier for the experiment
+  /// @param timeline The load and performance per second since the start of
+  /// the load curve.
+  void AddTimeline(
+      InferenceLoadMode& id, std::vector<TimelineSecond>&& timeline);
 
   /// Get the experiment data for the profile
   /// @return Experiment data
@@ -32,6 +32,9 @@
 #include <rapidjson/writer.h>
 #include <sys/types.h>
 
+#include <iomanip>
+#include <sstream>
+
 #include "client_backend/client_backend.h"
 #include "profile_data_collector.h"
 
@@ -78,6 +81,12 @@ ProfileDataExporter::ConvertToJson(
     AddExperiment(entry, experiment, raw_experiment);
     AddRequests(entry, requests, raw_experiment);
     AddWindowBoundaries(entry, window_boundaries, raw_experiment);
+    AddLatencyHistogram(
+        entry, "latency_histogram", raw_experiment.latency_histogram);
+    AddLatencyHistogram(
+        entry, "corrected_latency_histogram",
+        raw_experiment.corrected_latency_histogram);
+    AddTimeline(entry, raw_experiment.timeline);
 
     experiments.PushBack(entry, document_.GetAllocator());
   }
@@ -94,6 +103,7 @@ ProfileDataExporter::ClearDocument()
   rapidjson::Document d{};
   document_.Swap(d);
   document_.SetObject();
+  resolved_inputs_.clear();
 }
 
 void
@@ -120,35 +130,48 @@ ProfileDataExporter::AddRequests(
     rapidjson::Value& entry, rapidjson::Value& requests,
     const ProfileDataCollector::Experiment& raw_experiment)
 {
-  for (auto& raw_request : raw_experiment.requests) {
+  const auto& raw_requests{raw_experiment.requests};
+  for (size_t i = 0; i < raw_requests.size(); i++) {
     rapidjson::Value request(rapidjson::kObjectType);
     rapidjson::Value timestamp;
 
-    timestamp.SetUint64(
-        raw_request.start_time_.time_since_epoch().count() - start_time);
+    timestamp.SetUint64(raw_requests.StartNs(i) - start_time);
     request.AddMember("timestamp", timestamp, document_.GetAllocator());
 
-    if (raw_request.sequence_id_ != 0) {
+    if (raw_requests.ScheduledNs(i) != 0) {
+      // Requests may have been scheduled before the experiment started
+      rapidjson::Value scheduled_timestamp;
+      scheduled_timestamp.SetInt64(
+          static_cast<int64_t>(raw_requests.ScheduledNs(i) - start_time));
+      request.AddMember(
+          "scheduled_timestamp", scheduled_timestamp,
+          document_.GetAllocator());
+    }
+
+    if (raw_requests.SequenceId(i) != 0) {
       rapidjson::Value sequence_id;
-      sequence_id.SetUint64(raw_request.sequence_id_);
+      sequence_id.SetUint64(raw_requests.SequenceId(i));
       request.AddMember("sequence_id", sequence_id, document_.GetAllocator());
     }
 
     if (!simple) {
       rapidjson::Value request_inputs(rapidjson::kObjectType);
-      AddRequestInputs(request_inputs, raw_request.request_inputs_);
+      if (raw_requests.InputRef(i).IsValid()) {
+        AddRequestInputs(request_inputs, raw_requests.InputRef(i));
+      } else {
+        AddRequestInputs(request_inputs, raw_requests.Inputs(i));
+      }
       request.AddMember(
           "request_inputs", request_inputs, document_.GetAllocator());
     }
     rapidjson::Value response_timestamps(rapidjson::kArrayType);
-    AddResponseTimestamps(
-        response_timestamps, raw_request.response_timestamps_);
+    AddResponseTimestamps(response_timestamps, raw_requests.ResponseNs(i));
     request.AddMember(
         "response_timestamps", response_timestamps, document_.GetAllocator());
 
     if (!simple) {
       rapidjson::Value response_outputs(rapidjson::kArrayType);
-      AddResponseOutputs(response_outputs, raw_request.response_outputs_);
+      AddResponseOutputs(response_outputs, raw_requests, i);
       request.AddMember(
           "response_outputs", response_outputs, document_.GetAllocator());
     }
@@ -159,53 +182,51 @@ ProfileDataExporter::AddRequests(
 
 void
 ProfileDataExporter::AddResponseTimestamps(
-    rapidjson::Value& timestamps_json,
-    const std::vector<std::chrono::time_point<std::chrono::system_clock>>&
-        timestamps)
+    rapidjson::Value& timestamps_json, std::span<const uint64_t> timestamps)
 {
-  for (auto& timestamp : timestamps) {
+  for (const auto timestamp : timestamps) {
     rapidjson::Value timestamp_json;
-    timestamp_json.SetUint64(timestamp.time_since_epoch().count() - start_time);
+    timestamp_json.SetUint64(timestamp - start_time);
     timestamps_json.PushBack(timestamp_json, document_.GetAllocator());
   }
 }
 
 void
 ProfileDataExporter::SetValueToJSON(
-    rapidjson::Value& json, const size_t index, const std::vector<uint8_t>& buf,
-    const std::string& data_type)
+    rapidjson::Value& json, const size_t index, const uint8_t* buf,
+    const size_t byte_size, const std::string& data_type)
 {
   auto data_type_size_opt = GetDataTypeSize(data_type);
-  if (!data_type_size_opt || (index * *data_type_size_opt >= buf.size())) {
+  if (!data_type_size_opt || (index * *data_type_size_opt >= byte_size)) {
     std::cerr << "Index out of bounds." << std::endl;
     return;
   }
 
   if (data_type == "BOOL") {
-    json.SetBool(reinterpret_cast<const bool*>(buf.data())[index]);
+    json.SetBool(reinterpret_cast<const bool*>(buf)[index]);
   } else if (data_type == "UINT8") {
-    json.SetUint(reinterpret_cast<const uint8_t*>(buf.data())[index]);
+    json.SetUint(reinterpret_cast<const uint8_t*>(buf)[index]);
   } else if (data_type == "UINT16") {
-    json.SetUint(reinterpret_cast<const uint16_t*>(buf.data())[index]);
+    json.SetUint(reinterpret_cast<const uint16_t*>(buf)[index]);
   } else if (data_type == "UINT32") {
-    json.SetUint(reinterpret_cast<const uint32_t*>(buf.data())[index]);
+    json.SetUint(reinterpret_cast<const uint32_t*>(buf)[index]);
   } else if (data_type == "UINT64") {
-    json.SetUint64(reinterpret_cast<const uint64_t*>(buf.data())[index]);
+    json.SetUint64(reinterpret_cast<const uint64_t*>(buf)[index]);
   } else if (data_type == "INT8") {
-    json.SetInt(reinterpret_cast<const int8_t*>(buf.data())[index]);
+    json.SetInt(reinterpret_cast<const int8_t*>(buf)[index]);
   } else if (data_type == "INT16") {
-    json.SetInt(reinterpret_cast<const int16_t*>(buf.data())[index]);
+    json.SetInt(reinterpret_cast<const int16_t*>(buf)[index]);
   } else if (data_type == "INT32") {
-    json.SetInt(reinterpret_cast<const int32_t*>(buf.data())[index]);
+    json.SetInt(reinterpret_cast<const int32_t*>(buf)[index]);
   } else if (data_type == "INT64") {
-    json.SetInt64(reinterpret_cast<const int64_t*>(buf.data())[index]);
+    json.SetInt64(reinterpret_cast<const int64_t*>(buf)[index]);
   } else if (data_type == "FP32") {
-    json.SetFloat(reinterpret_cast<const float*>(buf.data())[index]);
+    json.SetFloat(reinterpret_cast<const float*>(buf)[index]);
   } else if (data_type == "FP64") {
-    json.SetDouble(reinterpret_cast<const double*>(buf.data())[index]);
+    json.SetDouble(reinterpret_cast<const double*>(buf)[index]);
   } else if (data_type == "BYTES" || data_type == "JSON") {
     json.SetString(
-        reinterpret_cast<const char*>(buf.data()), buf.size(),
+        reinterpret_cast<const char*>(buf), byte_size,
         document_.GetAllocator());
   } else {
     std::cerr << "WARNING: data type '" + data_type +
@@ -218,6 +239,14 @@ void
 ProfileDataExporter::AddDataToJSON(
     rapidjson::Value& json, const std::vector<uint8_t>& buf,
     const std::string& data_type)
+{
+  AddDataToJSON(json, buf.data(), buf.size(), data_type);
+}
+
+void
+ProfileDataExporter::AddDataToJSON(
+    rapidjson::Value& json, const uint8_t* buf, const size_t byte_size,
+    const std::string& data_type)
 {
   // TPA-268: support N-dimensional tensor
   size_t data_size;
@@ -230,62 +259,103 @@ ProfileDataExporter::AddDataToJSON(
     if (!data_type_size) {
       return;
     }
-    data_size = buf.size() / data_type_size.value();
+    data_size = byte_size / data_type_size.value();
     if (data_size > 1) {
       json.SetArray();
     }
   }
 
-  if (!buf.empty()) {
+  if (byte_size != 0) {
     if (json.IsArray()) {
       for (int i = 0; i < data_size; i++) {
         rapidjson::Value data_val;
-        SetValueToJSON(data_val, i, buf, data_type);
+        SetValueToJSON(data_val, i, buf, byte_size, data_type);
         json.PushBack(data_val, document_.GetAllocator());
       }
     } else {
-      SetValueToJSON(json, 0 /* index */, buf, data_type);
+      SetValueToJSON(json, 0 /* index */, buf, byte_size, data_type);
     }
   } else {
     json.SetString("", 0, document_.GetAllocator());
   }
 }
 
+void
+ProfileDataExporter::AddHashToJSON(
+    rapidjson::Value& json, const uint64_t hash, const size_t byte_size)
+{
+  std::ostringstream hash_str{};
+  hash_str << std::hex << std::setw(16) << std::setfill('0') << hash;
+
+  json.SetObject();
+  rapidjson::Value hash_json(hash_str.str().c_str(), document_.GetAllocator());
+  json.AddMember("hash", hash_json, document_.GetAllocator());
+  rapidjson::Value size_json;
+  size_json.SetUint64(byte_size);
+  json.AddMember("size", size_json, document_.GetAllocator());
+}
+
 void
 ProfileDataExporter::AddRequestInputs(
     rapidjson::Value& request_inputs_json,
-    const std::vector<RequestRecord::RequestInput>& request_inputs)
+    std::span<const RecordPayload> request_inputs)
 {
-  for (const auto& request_input : request_inputs) {
-    for (const auto& input : request_input) {
-      const auto& name{input.first};
-      const auto& buf{input.second.data_};
-      const auto& byte_size{input.second.size_};
-      const auto& data_type{input.second.data_type_};
-      rapidjson::Value name_json(name.c_str(), document_.GetAllocator());
-      rapidjson::Value input_json;
-      AddDataToJSON(input_json, buf, data_type);
-      request_inputs_json.AddMember(
-          name_json, input_json, document_.GetAllocator());
+  for (const auto& input : request_inputs) {
+    rapidjson::Value name_json(input.Name().c_str(), document_.GetAllocator());
+    rapidjson::Value input_json;
+    AddDataToJSON(input_json, input.data, input.size, input.DataType());
+    request_inputs_json.AddMember(
+        name_json, input_json, document_.GetAllocator());
+  }
+}
+
+void
+ProfileDataExporter::AddRequestInputs(
+    rapidjson::Value& request_inputs_json, const RecordInputRef& input_ref)
+{
+  const std::pair<int32_t, int32_t> key{input_ref.stream_id, input_ref.step_id};
+  auto it{resolved_inputs_.find(key)};
+  if (it == resolved_inputs_.end()) {
+    RequestRecord::RequestInput inputs{};
+    if (infer_data_manager_ == nullptr) {
+      std::cerr << "Unable to resolve request inputs." << std::endl;
+    } else {
+      const auto err{infer_data_manager_->GetRecordInputs(
+          input_ref.stream_id, input_ref.step_id, inputs)};
+      if (!err.IsOk()) {
+        std::cerr << "Unable to resolve request inputs: " << err.Message()
+                  << std::endl;
+      }
     }
+    it = resolved_inputs_.emplace(key, std::move(inputs)).first;
+  }
+
+  for (const auto& [name, input] : it->second) {
+    rapidjson::Value name_json(name.c_str(), document_.GetAllocator());
+    rapidjson::Value input_json;
+    AddDataToJSON(input_json, input.data_, input.data_type_);
+    request_inputs_json.AddMember(
+        name_json, input_json, document_.GetAllocator());
   }
 }
 
 void
 ProfileDataExporter::AddResponseOutputs(
-    rapidjson::Value& outputs_json,
-    const std::vector<RequestRecord::ResponseOutput>& response_outputs)
+    rapidjson::Value& outputs_json, const RequestRecordStore& requests,
+    const size_t index)
 {
-  for (const auto& response_output : response_outputs) {
+  for (size_t group = 0; group < requests.OutputGroupCount(index); group++) {
     rapidjson::Value response_output_json(rapidjson::kObjectType);
-    for (const auto& output : response_output) {
-      const auto& name{output.first};
-      const auto& buf{output.second.data_};
-      const auto& byte_size{output.second.size_};
-      const auto& data_type{output.second.data_type_};
-      rapidjson::Value name_json(name.c_str(), document_.GetAllocator());
+    for (const auto& output : requests.Outputs(index, group)) {
+      rapidjson::Value name_json(
+          output.Name().c_str(), document_.GetAllocator());
       rapidjson::Value output_json;
-      AddDataToJSON(output_json, buf, data_type);
+      if (output.is_hash) {
+        AddHashToJSON(output_json, output.hash, output.size);
+      } else {
+        AddDataToJSON(
+            output_json, output.data, output.size, output.DataType());
+      }
       response_output_json.AddMember(
           name_json, output_json, document_.GetAllocator());
     }
@@ -307,6 +377,81 @@ ProfileDataExporter::AddWindowBoundaries(
       "window_boundaries", window_boundaries, document_.GetAllocator());
 }
 
+void
+ProfileDataExporter::AddLatencyHistogram(
+    rapidjson::Value& entry, const char* name,
+    const LatencyHistogram& histogram)
+{
+  if (histogram.Empty()) {
+    return;
+  }
+
+  rapidjson::Value latency_histogram(rapidjson::kObjectType);
+  rapidjson::Value significant_digits;
+  significant_digits.SetUint(histogram.SignificantDigits());
+  latency_histogram.AddMember(
+      "significant_digits", significant_digits, document_.GetAllocator());
+
+  rapidjson::Value buckets(rapidjson::kArrayType);
+  for (const auto& bucket : histogram.Buckets()) {
+    rapidjson::Value bucket_json(rapidjson::kObjectType);
+    rapidjson::Value lowest_ns;
+    lowest_ns.SetUint64(bucket.lowest);
+    rapidjson::Value highest_ns;
+    highest_ns.SetUint64(bucket.highest);
+    rapidjson::Value count;
+    count.SetUint64(bucket.count);
+    bucket_json.AddMember("lowest_ns", lowest_ns, document_.GetAllocator());
+    bucket_json.AddMember("highest_ns", highest_ns, document_.GetAllocator());
+    bucket_json.AddMember("count", count, document_.GetAllocator());
+    buckets.PushBack(bucket_json, document_.GetAllocator());
+  }
+  latency_histogram.AddMember("buckets", buckets, document_.GetAllocator());
+  entry.AddMember(
+      rapidjson::StringRef(name), latency_histogram, document_.GetAllocator());
+}
+
+void
+ProfileDataExporter::AddTimeline(
+    rapidjson::Value& entry,
+    const std::vector<ProfileDataCollector::TimelineSecond>& timeline)
+{
+  if (timeline.empty()) {
+    return;
+  }
+
+  auto& allocator{document_.GetAllocator()};
+  rapidjson::Value timeline_json(rapidjson::kArrayType);
+  for (const auto& second : timeline) {
+    rapidjson::Value second_json(rapidjson::kObjectType);
+    rapidjson::Value target_request_rate;
+    target_request_rate.SetDouble(second.target_request_count);
+    second_json.AddMember(
+        "target_request_rate", target_request_rate, allocator);
+    rapidjson::Value send_request_rate;
+    send_request_rate.SetUint64(second.sent_count);
+    second_json.AddMember("send_request_rate", send_request_rate, allocator);
+    rapidjson::Value throughput;
+    throughput.SetUint64(second.completed_count);
+    second_json.AddMember("throughput", throughput, allocator);
+
+    const auto& histogram{second.latency_histogram};
+    if (!histogram.Empty()) {
+      rapidjson::Value avg_latency_ns;
+      avg_latency_ns.SetUint64(histogram.Mean());
+      second_json.AddMember("avg_latency_ns", avg_latency_ns, allocator);
+      rapidjson::Value p50_latency_ns;
+      p50_latency_ns.SetUint64(histogram.ValueAtPercentile(50));
+      second_json.AddMember("p50_latency_ns", p50_latency_ns, allocator);
+      rapidjson::Value p99_latency_ns;
+      p99_latency_ns.SetUint64(histogram.ValueAtPercentile(99));
+      second_json.AddMember("p99_latency_ns", p99_latency_ns, allocator);
+    }
+    timeline_json.PushBack(second_json, allocator);
+  }
+  entry.AddMember("timeline", timeline_json, allocator);
+}
+
 void
 ProfileDataExporter::AddVersion(std::string& raw_version)
 {
@@ -29,7 +29,12 @@
 #include <rapidjson/document.h>
 #include <sys/types.h>
 
+#include <map>
+#include <span>
+#include <utility>
+
 #include "client_backend/client_backend.h"
+#include "iinfer_data_manager.h"
 #include "profile_data_collector.h"
 
 namespace triton { namespace perfanalyzer {
@@ -58,6 +63,16 @@ class ProfileDataExporter {
       cb::BackendKind& service_kind, std::string& endpoint);
   void set_simple() { simple = true; }
 
+  /// Set the infer data manager that request inputs recorded by reference to
+  /// a dataset entry are resolved with
+  /// @param infer_data_manager The manager of the dataset the requests were
+  /// sent with.
+  void SetInferDataManager(
+      const std::shared_ptr<IInferDataManager>& infer_data_manager)
+  {
+    infer_data_manager_ = infer_data_manager;
+  }
+
  private:
   ProfileDataExporter() = default;
   /// Convert the raw data collected to json output
@@ -79,24 +94,34 @@ class ProfileDataExporter {
       rapidjson::Value& entry, rapidjson::Value& requests,
       const ProfileDataCollector::Experiment& raw_experiment);
   void SetValueToJSON(
-      rapidjson::Value& json, const size_t index,
-      const std::vector<uint8_t>& buf, const std::string& data_type);
+      rapidjson::Value& json, const size_t index, const uint8_t* buf,
+      const size_t byte_size, const std::string& data_type);
   void AddDataToJSON(
       rapidjson::Value& json, const std::vector<uint8_t>& buf,
       const std::string& data_type);
+  void AddDataToJSON(
+      rapidjson::Value& json, const uint8_t* buf, const size_t byte_size,
+      const std::string& data_type);
+  void AddHashToJSON(
+      rapidjson::Value& json, const uint64_t hash, const size_t byte_size);
+  void AddRequestInputs(
+      rapidjson::Value& inputs_json, std::span<const RecordPayload> inputs);
   void AddRequestInputs(
-      rapidjson::Value& inputs_json,
-      const std::vector<RequestRecord::RequestInput>& inputs);
+      rapidjson::Value& inputs_json, const RecordInputRef& input_ref);
   void AddResponseTimestamps(
-      rapidjson::Value& timestamps_json,
-      const std::vector<std::chrono::time_point<std::chrono::system_clock>>&
-          timestamps);
+      rapidjson::Value& timestamps_json, std::span<const uint64_t> timestamps);
   void AddResponseOutputs(
-      rapidjson::Value& outputs_json,
-      const std::vector<RequestRecord::ResponseOutput>& outputs);
+      rapidjson::Value& outputs_json, const RequestRecordStore& requests,
+      const size_t index);
   void AddWindowBoundaries(
       rapidjson::Value& entry, rapidjson::Value& window_boundaries,
       const ProfileDataCollector::Experiment& raw_experiment);
+  void AddLatencyHistogram(
+      rapidjson::Value& entry, const char* name,
+      const LatencyHistogram& histogram);
+  void AddTimeline(
+      rapidjson::Value& entry,
+      const std::vector<ProfileDataCollector::TimelineSecond>& timeline);
   void AddVersion(std::string& raw_version);
   void AddServiceKind(cb::BackendKind& service_kind);
   void AddEndpoint(std::string& endpoint);
@@ -108,6 +133,11 @@ class ProfileDataExporter {
   bool simple = false;
   u_int64_t start_time;
 
+  std::shared_ptr<IInferDataManager> infer_data_manager_{nullptr};
+  // Request inputs resolved so far, keyed by their dataset entry
+  std::map<std::pair<int32_t, int32_t>, RequestRecord::RequestInput>
+      resolved_inputs_;
+
 #ifndef DOCTEST_CONFIG_DISABLE
   friend NaggyMockProfileDataExporter;
 #endif
@@ -33,6 +33,22 @@
 
 namespace triton::perfanalyzer {
 
+/// Output stream of a rapidjson::Writer that appends to a string, so that JSON
+/// is written in place rather than through a StringBuffer.
+///
+class StringOutputStream {
+ public:
+  using Ch = char;
+
+  explicit StringOutputStream(std::string& str) : str_(str) {}
+
+  void Put(Ch c) { str_.push_back(c); }
+  void Flush() {}
+
+ private:
+  std::string& str_;
+};
+
 class RapidJsonUtils {
  public:
   static std::string Serialize(const rapidjson::Document& document)
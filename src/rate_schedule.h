@@ -27,25 +27,143 @@
 #pragma once
 
 #include <chrono>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <vector>
 
 namespace triton { namespace perfanalyzer {
 
 using NanoIntervals = std::vector<std::chrono::nanoseconds>;
 
+/// A single stream of timestamps generated on demand and dealt out to several
+/// consumers in a fixed order. Arrival processes other than Poisson do not
+/// keep their shape when split into independent streams, so they are drawn
+/// once for all the workers and shared instead. Traces are read the same way.
+///
+/// Consumers take their timestamps in blocks, so that the stream is locked
+/// once per block rather than once per request. The stream holds at most
+/// MAX_LAG timestamps for a consumer that has not asked for them; the ones
+/// dealt to it past that go to the consumer asking instead, so a stalled
+/// worker neither grows the stream without bound nor holds back its share of
+/// the load.
+///
+class SharedRateStream {
+ public:
+  static constexpr size_t BLOCK_SIZE{64};
+  static constexpr size_t MAX_LAG{4096};
+
+  /// \param gap_distribution The distribution of the gaps between timestamps.
+  /// \param seed The seed of the random number generator of the stream.
+  /// \param consumer_order The consumer that each successive timestamp is dealt
+  /// to, repeated for as long as the stream goes. Every consumer that asks for
+  /// timestamps must appear in it.
+  /// \param num_consumers The number of consumers of the stream.
+  SharedRateStream(
+      std::function<std::chrono::nanoseconds(std::mt19937&)> gap_distribution,
+      std::mt19937::result_type seed, std::vector<size_t> consumer_order,
+      size_t num_consumers)
+      : SharedRateStream(
+            [gap_distribution = std::move(gap_distribution),
+             rng = std::mt19937(seed),
+             last = std::chrono::nanoseconds(0)]() mutable {
+              last += gap_distribution(rng);
+              return last;
+            },
+            std::move(consumer_order), num_consumers)
+  {
+  }
+
+  /// \param source Returns the successive timestamps of the stream.
+  /// \param consumer_order The consumer that each successive timestamp is dealt
+  /// to, repeated for as long as the stream goes. Every consumer that asks for
+  /// timestamps must appear in it.
+  /// \param num_consumers The number of consumers of the stream.
+  SharedRateStream(
+      std::function<std::chrono::nanoseconds()> source,
+      std::vector<size_t> consumer_order, size_t num_consumers)
+      : source_(std::move(source)), consumer_order_(std::move(consumer_order)),
+        pending_(num_consumers)
+  {
+  }
+
+  /// Replaces the given block with the next BLOCK_SIZE timestamps dealt to
+  /// the given consumer, generating the stream up to them as needed
+  void NextBlock(size_t consumer, NanoIntervals& block)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& pending{pending_[consumer]};
+    while (pending.size() < BLOCK_SIZE) {
+      auto& dealt_to{pending_[consumer_order_[order_index_]]};
+      (dealt_to.size() < MAX_LAG ? dealt_to : pending).push_back(source_());
+      order_index_ = (order_index_ + 1) % consumer_order_.size();
+    }
+    block.assign(pending.begin(), pending.begin() + BLOCK_SIZE);
+    pending.erase(pending.begin(), pending.begin() + BLOCK_SIZE);
+  }
+
+ private:
+  std::function<std::chrono::nanoseconds()> source_;
+  const std::vector<size_t> consumer_order_;
+  size_t order_index_{0};
+  std::vector<std::deque<std::chrono::nanoseconds>> pending_;
+  std::mutex mutex_;
+};
+
 /// Defines a schedule, where the consumer should
 /// loop through the provided intervals, and then every time it loops back to
 /// the start add an additional amount equal to the duration
 ///
+/// A schedule can instead generate its timestamps on demand, drawing the gap
+/// before each one from a distribution with its own random number generator,
+/// or take them from a stream shared with the schedules of other workers.
+/// This keeps randomly distributed schedules of any length from having to be
+/// generated and stored up front.
+///
 struct RateSchedule {
+  using GapDistribution =
+      std::function<std::chrono::nanoseconds(std::mt19937&)>;
+
+  RateSchedule() = default;
+
+  /// Creates a schedule that generates its timestamps on demand
+  /// \param gap_distribution The distribution of the gaps between timestamps.
+  /// \param seed The seed of the random number generator of the schedule.
+  RateSchedule(
+      GapDistribution gap_distribution, std::mt19937::result_type seed)
+      : gap_distribution_(std::move(gap_distribution)), rng_(seed)
+  {
+  }
+
+  /// Creates a schedule that takes its timestamps from a shared stream
+  /// \param stream The stream shared with the schedules of other workers.
+  /// \param consumer The index of this schedule in the stream.
+  RateSchedule(std::shared_ptr<SharedRateStream> stream, size_t consumer)
+      : shared_stream_(std::move(stream)), consumer_(consumer)
+  {
+  }
+
   NanoIntervals intervals;
-  std::chrono::nanoseconds duration;
+  std::chrono::nanoseconds duration{0};
 
   /// Returns the next timestamp in the schedule
   ///
   std::chrono::nanoseconds Next()
   {
+    if (gap_distribution_) {
+      last_ += gap_distribution_(rng_);
+      return last_;
+    }
+    if (shared_stream_) {
+      if (block_index_ >= block_.size()) {
+        shared_stream_->NextBlock(consumer_, block_);
+        block_index_ = 0;
+      }
+      return block_[block_index_++];
+    }
+
     auto next = intervals[index_] + duration * rounds_;
 
     index_++;
@@ -56,9 +174,26 @@ struct RateSchedule {
     return next;
   }
 
+  /// Whether the timestamps are generated on demand instead of taken from
+  /// the intervals
+  bool IsGenerated() const
+  {
+    return static_cast<bool>(gap_distribution_) ||
+           static_cast<bool>(shared_stream_);
+  }
+
  private:
   size_t rounds_ = 0;
   size_t index_ = 0;
+
+  GapDistribution gap_distribution_{};
+  std::mt19937 rng_{};
+  std::chrono::nanoseconds last_{0};
+
+  std::shared_ptr<SharedRateStream> shared_stream_{};
+  size_t consumer_{0};
+  NanoIntervals block_{};
+  size_t block_index_{0};
 };
 
 using RateSchedulePtr_t = std::shared_ptr<RateSchedule>;
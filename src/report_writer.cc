@@ -97,6 +97,12 @@ ReportWriter::GenerateReport()
          summary_[0].client_stats.percentile_latency_ns) {
       ofs << ",p" << percentile.first << " latency";
     }
+    // Only requests sent on a schedule have schedule-corrected latencies
+    const auto corrected_percentiles{
+        summary_[0].client_stats.percentile_corrected_latency_ns};
+    for (const auto& percentile : corrected_percentiles) {
+      ofs << ",p" << percentile.first << " corrected latency";
+    }
     if (verbose_csv_) {
       if (percentile_ == -1) {
         ofs << ",Avg latency";
@@ -209,6 +215,12 @@ ReportWriter::GenerateReport()
       for (const auto& percentile : status.client_stats.percentile_latency_ns) {
         ofs << "," << (percentile.second / 1000);
       }
+      for (const auto& percentile : corrected_percentiles) {
+        const auto& corrected{
+            status.client_stats.percentile_corrected_latency_ns};
+        const auto it{corrected.find(percentile.first)};
+        ofs << "," << (it != corrected.end() ? (it->second / 1000) : 0);
+      }
       if (verbose_csv_) {
         const uint64_t avg_latency_us =
             status.client_stats.avg_latency_ns / 1000;
@@ -239,6 +251,24 @@ ReportWriter::GenerateReport()
     }
     ofs.close();
 
+    if (verbose_csv_) {
+      // Record the full latency distribution in a separate file so that
+      // percentiles other than the reported ones can be derived from it.
+      std::ofstream histogram_ofs(
+          "latency_histogram." + filename_, std::ofstream::out);
+      if (target_concurrency_) {
+        histogram_ofs << "Concurrency,";
+      } else {
+        histogram_ofs << "Request Rate,";
+      }
+      histogram_ofs << "Latency Lowest (ns),Latency Highest (ns),Count"
+                    << std::endl;
+      for (const pa::PerfStatus& status : summary_) {
+        WriteLatencyHistogram(histogram_ofs, status);
+      }
+      histogram_ofs.close();
+    }
+
     if (include_server_stats_) {
       // Record composing model stat in a separate file.
       if (!summary_.front().server_stats.composing_models_stat.empty()) {
@@ -388,4 +418,19 @@ ReportWriter::WriteGpuMetrics(std::ostream& ofs, const Metrics& metric)
   }
 }
 
+void
+ReportWriter::WriteLatencyHistogram(
+    std::ostream& ofs, const pa::PerfStatus& status)
+{
+  for (const auto& bucket : status.client_stats.latency_histogram.Buckets()) {
+    if (target_concurrency_) {
+      ofs << status.concurrency;
+    } else {
+      ofs << status.request_rate;
+    }
+    ofs << "," << bucket.lowest << "," << bucket.highest << "," << bucket.count
+        << std::endl;
+  }
+}
+
 }}  // namespace triton::perfanalyzer
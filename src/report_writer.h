@@ -79,6 +79,12 @@ class ReportWriter {
   /// rate
   void WriteGpuMetrics(std::ostream& ofs, const Metrics& metric);
 
+  /// Output the latency histogram buckets of a measurement to a stream, one
+  /// row per bucket holding at least one request
+  /// \param ofs A stream to output the csv data
+  /// \param status The summary of a particular concurrency or request rate
+  void WriteLatencyHistogram(std::ostream& ofs, const pa::PerfStatus& status);
+
  private:
   ReportWriter(
       const std::string& filename, const bool target_concurrency,
@@ -0,0 +1,138 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "request_dispatcher.h"
+
+#include <algorithm>
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+RequestPacing
+DispatcherPacing(RequestPacing pacing)
+{
+  // The ticks of the wheel already release the requests that are due close
+  // together at once
+  if (pacing.strategy == PacingStrategy::Batched) {
+    pacing.strategy = PacingStrategy::Deadline;
+  }
+  return pacing;
+}
+
+}  // namespace
+
+RequestDispatcher::RequestDispatcher(
+    std::shared_ptr<DispatchQueue> queue, const RequestPacing& pacing,
+    const std::chrono::nanoseconds tick, const size_t num_slots)
+    : queue_(std::move(queue)), pacer_(DispatcherPacing(pacing)), tick_(tick),
+      num_slots_(num_slots)
+{
+}
+
+RequestDispatcher::~RequestDispatcher()
+{
+  Stop();
+}
+
+void
+RequestDispatcher::SetSchedules(std::vector<RateSchedulePtr_t> schedules)
+{
+  schedules_ = std::move(schedules);
+}
+
+void
+RequestDispatcher::Start(const std::chrono::steady_clock::time_point start_time)
+{
+  Stop();
+
+  start_time_ = start_time;
+  wheel_ =
+      std::make_unique<TimingWheel<size_t>>(tick_, num_slots_, start_time);
+  pending_.assign(
+      schedules_.size(), std::chrono::steady_clock::time_point::max());
+  for (size_t i = 0; i < schedules_.size(); i++) {
+    // A schedule with no timestamps never releases a request
+    if (schedules_[i]->IsGenerated() || !schedules_[i]->intervals.empty()) {
+      pending_[i] = start_time_ + schedules_[i]->Next();
+    }
+  }
+
+  stop_ = false;
+  thread_ = std::thread(&RequestDispatcher::Dispatch, this);
+}
+
+void
+RequestDispatcher::Stop()
+{
+  stop_ = true;
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void
+RequestDispatcher::Dispatch()
+{
+  const size_t max_backlog{max_backlog_per_worker_ * queue_->NumOwners()};
+  std::vector<TimingWheel<size_t>::Entry> expired;
+
+  while (!stop_) {
+    FillWheel();
+
+    const auto now{std::chrono::steady_clock::now()};
+    auto wake_time{now + max_wait_};
+    if (queue_->Size() < max_backlog) {
+      expired.clear();
+      wheel_->Advance(now, expired);
+      for (const auto& entry : expired) {
+        queue_->Push(entry.item, entry.deadline);
+      }
+
+      const auto next_expiry{wheel_->NextExpiry()};
+      if (next_expiry && *next_expiry < wake_time) {
+        wake_time = *next_expiry;
+      }
+    } else {
+      // Give the workers a tick to catch up before releasing more
+      wake_time = now + tick_;
+    }
+
+    pacer_.WaitUntil(wake_time);
+  }
+}
+
+void
+RequestDispatcher::FillWheel()
+{
+  for (size_t i = 0; i < schedules_.size(); i++) {
+    while (wheel_->Insert(pending_[i], i)) {
+      pending_[i] = start_time_ + schedules_[i]->Next();
+    }
+  }
+}
+
+}}  // namespace triton::perfanalyzer
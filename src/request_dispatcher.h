@@ -0,0 +1,119 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "rate_schedule.h"
+#include "request_pacer.h"
+#include "timing_wheel.h"
+#include "work_stealing_queue.h"
+
+namespace triton { namespace perfanalyzer {
+
+/// The queue the dispatcher releases requests onto, holding the time each
+/// request was scheduled for in the lane of the worker it was scheduled on
+using DispatchQueue = WorkStealingQueue<std::chrono::steady_clock::time_point>;
+
+#ifndef DOCTEST_CONFIG_DISABLE
+class TestRequestDispatcher;
+#endif
+
+/// Releases the requests of the schedules of all the request-rate workers
+/// from one thread. The thread loads the upcoming timestamps of every schedule
+/// into a timing wheel, waits for the earliest one with a RequestPacer and
+/// pushes the requests that are due onto a DispatchQueue. Any worker with a
+/// free context can then send a request that is due, so the request rate is
+/// kept up to the combined capacity of the workers instead of falling behind
+/// whenever the one worker a request was scheduled on is busy.
+///
+class RequestDispatcher {
+ public:
+  /// \param queue The queue to release the requests onto. Has one lane per
+  /// worker schedule.
+  /// \param pacing How the dispatch thread waits for the next request.
+  /// \param tick The time resolution of the timing wheel.
+  /// \param num_slots The number of slots of the timing wheel.
+  RequestDispatcher(
+      std::shared_ptr<DispatchQueue> queue, const RequestPacing& pacing,
+      const std::chrono::nanoseconds tick = std::chrono::microseconds(50),
+      const size_t num_slots = 2048);
+
+  ~RequestDispatcher();
+
+  /// Provides the schedules of the workers. Must not be called while the
+  /// dispatch thread is running.
+  /// \param schedules The schedule of each worker, in worker order.
+  void SetSchedules(std::vector<RateSchedulePtr_t> schedules);
+
+  /// Starts the dispatch thread
+  /// \param start_time The time the schedules are relative to.
+  void Start(const std::chrono::steady_clock::time_point start_time);
+
+  /// Stops the dispatch thread. The requests already released stay in the
+  /// queue.
+  void Stop();
+
+ private:
+  void Dispatch();
+
+  // Loads the upcoming timestamps of every schedule into the wheel, up to the
+  // furthest time the wheel can hold
+  void FillWheel();
+
+  std::shared_ptr<DispatchQueue> queue_;
+  RequestPacer pacer_;
+  const std::chrono::nanoseconds tick_;
+  const size_t num_slots_;
+
+  std::vector<RateSchedulePtr_t> schedules_;
+  std::chrono::steady_clock::time_point start_time_{};
+  // The next timestamp of each schedule that has not been loaded into the
+  // wheel yet
+  std::vector<std::chrono::steady_clock::time_point> pending_;
+  std::unique_ptr<TimingWheel<size_t>> wheel_;
+
+  std::thread thread_;
+  std::atomic<bool> stop_{false};
+
+  // The longest the dispatch thread waits without checking whether it has
+  // been stopped
+  const std::chrono::milliseconds max_wait_{10};
+  // The most requests the queue may hold per worker before the dispatch
+  // thread stops releasing more, which bounds its size when the server can't
+  // keep up with the request rate
+  const size_t max_backlog_per_worker_{1024};
+
+#ifndef DOCTEST_CONFIG_DISABLE
+  friend TestRequestDispatcher;
+#endif
+};
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,93 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "request_pacer.h"
+
+#include <thread>
+
+#ifdef __linux__
+#include <errno.h>
+#include <time.h>
+#endif
+
+namespace triton { namespace perfanalyzer {
+
+void
+RequestPacer::WaitUntil(const std::chrono::steady_clock::time_point deadline)
+{
+  switch (pacing_.strategy) {
+    case PacingStrategy::Sleep:
+      std::this_thread::sleep_for(deadline - std::chrono::steady_clock::now());
+      break;
+    case PacingStrategy::Hybrid:
+      SleepUntil(deadline - pacing_.slack);
+      SpinUntil(deadline);
+      break;
+    case PacingStrategy::Deadline:
+      SleepUntil(deadline);
+      break;
+    case PacingStrategy::Batched:
+      if (deadline > release_until_) {
+        SleepUntil(deadline);
+        release_until_ = deadline + pacing_.slack;
+      }
+      break;
+  }
+}
+
+void
+RequestPacer::SleepUntil(const std::chrono::steady_clock::time_point deadline)
+{
+#ifdef __linux__
+  // steady_clock is CLOCK_MONOTONIC on Linux
+  const auto deadline_ns{std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             deadline.time_since_epoch())
+                             .count()};
+  if (deadline_ns <= 0) {
+    return;
+  }
+  timespec ts{};
+  ts.tv_sec = deadline_ns / 1000000000;
+  ts.tv_nsec = deadline_ns % 1000000000;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) ==
+         EINTR) {
+  }
+#else
+  std::this_thread::sleep_until(deadline);
+#endif
+}
+
+void
+RequestPacer::SpinUntil(const std::chrono::steady_clock::time_point deadline)
+{
+  while (std::chrono::steady_clock::now() < deadline) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+  }
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,92 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <chrono>
+
+namespace triton { namespace perfanalyzer {
+
+/// How a request-rate worker waits for the scheduled time of its next request
+enum class PacingStrategy {
+  // Sleep for the time remaining until the request is due
+  Sleep,
+  // Sleep until shortly before the request is due, then spin until it is
+  Hybrid,
+  // Sleep until the absolute time the request is due on the monotonic clock
+  Deadline,
+  // Wake up once for all the requests that are due within the slack of each
+  // other and send them back to back
+  Batched
+};
+
+/// What decides when each request of request-rate mode is sent
+enum class RequestDispatch {
+  // Every worker waits for the scheduled time of its own next request
+  PerWorker,
+  // One thread releases the requests of all the workers from a timing wheel
+  // onto a queue that any idle worker takes them from
+  TimingWheel
+};
+
+struct RequestPacing {
+  PacingStrategy strategy{PacingStrategy::Sleep};
+  // With the Hybrid strategy, how long before the deadline to stop sleeping
+  // and start spinning. With the Batched strategy, how long after a wake-up
+  // requests are released without waiting.
+  std::chrono::nanoseconds slack{std::chrono::microseconds(100)};
+  RequestDispatch dispatch{RequestDispatch::PerWorker};
+};
+
+/// Waits for the scheduled times of consecutive requests of one worker
+/// according to a RequestPacing configuration. Not thread-safe.
+class RequestPacer {
+ public:
+  explicit RequestPacer(const RequestPacing& pacing = RequestPacing{})
+      : pacing_(pacing)
+  {
+  }
+
+  /// Blocks until the given time has been reached. With the Batched strategy,
+  /// returns up to the slack early if a previous wait already woke up within
+  /// the slack of the deadline.
+  /// \param deadline The time the request is due.
+  void WaitUntil(const std::chrono::steady_clock::time_point deadline);
+
+ private:
+  /// Sleeps until the absolute deadline. Unlike a relative sleep, time spent
+  /// between computing the deadline and going to sleep does not delay the
+  /// wake-up.
+  static void SleepUntil(const std::chrono::steady_clock::time_point deadline);
+
+  static void SpinUntil(const std::chrono::steady_clock::time_point deadline);
+
+  RequestPacing pacing_;
+  // With the Batched strategy, requests due before this time are released
+  // without waiting
+  std::chrono::steady_clock::time_point release_until_{};
+};
+
+}}  // namespace triton::perfanalyzer
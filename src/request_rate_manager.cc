@@ -32,13 +32,15 @@ RequestRateManager::~RequestRateManager()
 {
   // The destruction of derived class should wait for all the request generator
   // threads to finish
+  if (dispatcher_) {
+    dispatcher_->Stop();
+  }
   StopWorkerThreads();
 }
 
 cb::Error
 RequestRateManager::Create(
     const bool async, const bool streaming,
-    const uint64_t measurement_window_ms, const size_t max_trials,
     Distribution request_distribution, const int32_t batch_size,
     const size_t max_threads, const uint32_t num_of_sequences,
     const SharedMemoryType shared_memory_type, const size_t output_shm_size,
@@ -46,12 +48,13 @@ RequestRateManager::Create(
     const std::shared_ptr<cb::ClientBackendFactory>& factory,
     std::unique_ptr<LoadManager>* manager,
     const std::unordered_map<std::string, cb::RequestParameter>&
-        request_parameters)
+        request_parameters,
+    const DistributionParams& distribution_params)
 {
   std::unique_ptr<RequestRateManager> local_manager(new RequestRateManager(
-      async, streaming, request_distribution, batch_size, measurement_window_ms,
-      max_trials, max_threads, num_of_sequences, shared_memory_type,
-      output_shm_size, serial_sequences, parser, factory, request_parameters));
+      async, streaming, request_distribution, batch_size, max_threads,
+      num_of_sequences, shared_memory_type, output_shm_size, serial_sequences,
+      parser, factory, request_parameters, distribution_params));
 
   *manager = std::move(local_manager);
 
@@ -60,23 +63,21 @@ RequestRateManager::Create(
 
 RequestRateManager::RequestRateManager(
     const bool async, const bool streaming, Distribution request_distribution,
-    int32_t batch_size, const uint64_t measurement_window_ms,
-    const size_t max_trials, const size_t max_threads,
+    int32_t batch_size, const size_t max_threads,
     const uint32_t num_of_sequences, const SharedMemoryType shared_memory_type,
     const size_t output_shm_size, const bool serial_sequences,
     const std::shared_ptr<ModelParser>& parser,
     const std::shared_ptr<cb::ClientBackendFactory>& factory,
     const std::unordered_map<std::string, cb::RequestParameter>&
-        request_parameters)
+        request_parameters,
+    const DistributionParams& distribution_params)
     : LoadManager(
           async, streaming, batch_size, max_threads, shared_memory_type,
           output_shm_size, parser, factory, request_parameters),
-      request_distribution_(request_distribution), execute_(false),
+      request_distribution_(request_distribution),
+      distribution_params_(distribution_params), execute_(false),
       num_of_sequences_(num_of_sequences), serial_sequences_(serial_sequences)
 {
-  gen_duration_.reset(new std::chrono::nanoseconds(
-      max_trials * measurement_window_ms * NANOS_PER_MILLIS));
-
   threads_config_.reserve(max_threads);
 }
 
@@ -115,28 +116,67 @@ RequestRateManager::ChangeRequestRate(
 void
 RequestRateManager::GenerateSchedule(const double request_rate)
 {
-  std::chrono::nanoseconds max_duration;
-  std::function<std::chrono::nanoseconds(std::mt19937&)> distribution;
-
-  if (request_distribution_ == Distribution::POISSON) {
-    distribution = ScheduleDistribution<Distribution::POISSON>(request_rate);
-    // Poisson distribution needs to generate a schedule for the maximum
-    // possible duration to make sure that it is as random and as close to the
-    // desired rate as possible
-    max_duration = *gen_duration_;
+  std::vector<RateSchedulePtr_t> worker_schedules;
+
+  if (load_curve_) {
+    // The curve stretches and compresses a one request per second schedule,
+    // which is generated as one stream since the rate of every worker changes
+    // together over time
+    auto unit_distribution{CreateDistribution(1.0)};
+    if (!unit_distribution) {
+      return;
+    }
+    worker_schedules = CreateSharedWorkerSchedules(
+        load_curve_->ScheduleDistribution(std::move(unit_distribution)));
+  } else if (request_distribution_ == Distribution::POISSON) {
+    // Poisson distribution is generated by the workers as they go, so that the
+    // schedule is as random as possible for any duration without having to be
+    // computed up front
+    worker_schedules = CreatePoissonWorkerSchedules(request_rate);
   } else if (request_distribution_ == Distribution::CONSTANT) {
-    distribution = ScheduleDistribution<Distribution::CONSTANT>(request_rate);
     // Constant distribution only needs one entry per worker -- that one value
     // can be repeated over and over to emulate a full schedule of any length
-    max_duration = std::chrono::nanoseconds(1);
+    worker_schedules = CreateWorkerSchedules(
+        std::chrono::nanoseconds(1), CreateDistribution(request_rate));
   } else {
-    return;
+    // The remaining distributions are bursty or heavy-tailed, which splitting
+    // them into independent per-worker processes would smooth out, so all the
+    // workers share one stream of them
+    auto distribution{CreateDistribution(request_rate)};
+    if (!distribution) {
+      return;
+    }
+    worker_schedules = CreateSharedWorkerSchedules(std::move(distribution));
   }
 
-  auto worker_schedules = CreateWorkerSchedules(max_duration, distribution);
   GiveSchedulesToWorkers(worker_schedules);
 }
 
+std::function<std::chrono::nanoseconds(std::mt19937&)>
+RequestRateManager::CreateDistribution(const double request_rate)
+{
+  switch (request_distribution_) {
+    case Distribution::POISSON:
+      return ScheduleDistribution<Distribution::POISSON>(request_rate);
+    case Distribution::CONSTANT:
+      return ScheduleDistribution<Distribution::CONSTANT>(request_rate);
+    case Distribution::GAMMA:
+      return ScheduleDistribution<Distribution::GAMMA>(
+          request_rate, distribution_params_);
+    case Distribution::MMPP:
+      return ScheduleDistribution<Distribution::MMPP>(
+          request_rate, distribution_params_);
+    case Distribution::LOGNORMAL:
+      return ScheduleDistribution<Distribution::LOGNORMAL>(
+          request_rate, distribution_params_);
+    case Distribution::PARETO:
+      return ScheduleDistribution<Distribution::PARETO>(
+          request_rate, distribution_params_);
+    default:
+      return {};
+  }
+}
+
 std::vector<RateSchedulePtr_t>
 RequestRateManager::CreateWorkerSchedules(
     std::chrono::nanoseconds max_duration,
@@ -168,6 +208,43 @@ RequestRateManager::CreateWorkerSchedules(
   return worker_schedules;
 }
 
+std::vector<RateSchedulePtr_t>
+RequestRateManager::CreatePoissonWorkerSchedules(const double request_rate)
+{
+  const std::vector<size_t> thread_ids{CalculateThreadIds()};
+  std::vector<size_t> worker_id_counts(workers_.size(), 0);
+  for (const auto thread_id : thread_ids) {
+    worker_id_counts[thread_id]++;
+  }
+
+  std::vector<RateSchedulePtr_t> worker_schedules;
+  for (size_t i = 0; i < workers_.size(); i++) {
+    const double worker_request_rate{
+        request_rate * worker_id_counts[i] / thread_ids.size()};
+    // Every worker draws from its own random number generator, seeded the same
+    // way for every request rate so that runs are reproducible
+    worker_schedules.push_back(std::make_shared<RateSchedule>(
+        ScheduleDistribution<Distribution::POISSON>(worker_request_rate),
+        std::mt19937::default_seed + i));
+  }
+  return worker_schedules;
+}
+
+std::vector<RateSchedulePtr_t>
+RequestRateManager::CreateSharedWorkerSchedules(
+    std::function<std::chrono::nanoseconds(std::mt19937&)> distribution)
+{
+  auto stream{std::make_shared<SharedRateStream>(
+      std::move(distribution), std::mt19937::default_seed,
+      CalculateThreadIds(), workers_.size())};
+
+  std::vector<RateSchedulePtr_t> worker_schedules;
+  for (size_t i = 0; i < workers_.size(); i++) {
+    worker_schedules.push_back(std::make_shared<RateSchedule>(stream, i));
+  }
+  return worker_schedules;
+}
+
 std::vector<RateSchedulePtr_t>
 RequestRateManager::CreateEmptyWorkerSchedules()
 {
@@ -223,11 +300,19 @@ RequestRateManager::GiveSchedulesToWorkers(
     auto w = std::dynamic_pointer_cast<IScheduler>(workers_[i]);
     w->SetSchedule(worker_schedules[i]);
   }
+  if (dispatcher_) {
+    dispatcher_->SetSchedules(worker_schedules);
+  }
 }
 
 void
 RequestRateManager::PauseWorkers()
 {
+  // Stop releasing requests before pausing the threads that send them
+  if (dispatcher_) {
+    dispatcher_->Stop();
+  }
+
   // Pause all the threads
   execute_ = false;
 
@@ -237,6 +322,11 @@ RequestRateManager::PauseWorkers()
       std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
   }
+
+  // The requests released for the previous schedule are not sent
+  if (dispatch_queue_) {
+    dispatch_queue_->Clear();
+  }
 }
 
 void
@@ -244,10 +334,19 @@ RequestRateManager::ConfigureThreads(const size_t request_count)
 {
   if (threads_.empty()) {
     size_t num_of_threads = DetermineNumThreads();
+    if (request_pacing_.dispatch == RequestDispatch::TimingWheel &&
+        !dispatcher_) {
+      dispatch_queue_ = std::make_shared<DispatchQueue>(num_of_threads);
+      dispatcher_ =
+          std::make_unique<RequestDispatcher>(dispatch_queue_, request_pacing_);
+    }
     while (workers_.size() < num_of_threads) {
       // Launch new thread for inferencing
       threads_stat_.emplace_back(new ThreadStat());
       threads_config_.emplace_back(new ThreadConfig(workers_.size()));
+      threads_config_.back()->output_capture_ = output_capture_;
+      threads_config_.back()->request_pacing_ = request_pacing_;
+      threads_config_.back()->dispatch_queue_ = dispatch_queue_;
 
       workers_.push_back(
           MakeWorker(threads_stat_.back(), threads_config_.back()));
@@ -271,7 +370,7 @@ RequestRateManager::ConfigureThreads(const size_t request_count)
       size_t thread_num_reqs = avg_req_count + (i < req_count_add_one ? 1 : 0);
       threads_config_[i]->num_requests_ = thread_num_reqs;
 
-      threads_.emplace_back(&IWorker::Infer, workers_[i]);
+      LaunchWorkerThread(workers_[i]);
     }
   }
 }
@@ -281,6 +380,14 @@ RequestRateManager::ResumeWorkers()
 {
   // Update the start_time_ to point to current time
   start_time_ = std::chrono::steady_clock::now();
+  schedule_start_ns_ =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count();
+
+  if (dispatcher_) {
+    dispatcher_->Start(start_time_);
+  }
 
   // Wake up all the threads to begin execution
   {
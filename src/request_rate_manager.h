@@ -27,7 +27,9 @@
 
 #include <condition_variable>
 
+#include "load_curve.h"
 #include "load_manager.h"
+#include "request_dispatcher.h"
 #include "request_rate_worker.h"
 
 namespace triton::perfanalyzer {
@@ -46,8 +48,8 @@ class TestRequestRateManager;
 /// requests per second values and to collect per-request statistic.
 ///
 /// Detail:
-/// Request Rate Manager will try to follow a pre-computed schedule while
-/// issuing requests to the server and maintain a constant request rate. The
+/// Request Rate Manager will try to follow a schedule while issuing requests
+/// to the server and maintain a constant request rate. The
 /// manager will spawn max_threads many worker thread to meet the timeline
 /// imposed by the schedule. The worker threads will record the start time and
 /// end time of each request into a shared vector which will be used to report
@@ -63,8 +65,6 @@ class RequestRateManager : public LoadManager {
   /// \param async Whether to use asynchronous or synchronous API for infer
   /// request.
   /// \param streaming Whether to use gRPC streaming API for infer request
-  /// \param measurement_window_ms The time window for measurements.
-  /// \param max_trials The maximum number of windows that will be measured
   /// \param request_distribution The kind of distribution to use for drawing
   /// out intervals between successive requests.
   /// \param batch_size The batch size used for each request.
@@ -85,10 +85,11 @@ class RequestRateManager : public LoadManager {
   /// client to the server.
   /// \param manager Returns a new ConcurrencyManager object.
   /// \param request_parameters Custom request parameters to send to the server
+  /// \param distribution_params The shape parameters of the request
+  /// distribution.
   /// \return cb::Error object indicating success or failure.
   static cb::Error Create(
       const bool async, const bool streaming,
-      const uint64_t measurement_window_ms, const size_t max_trials,
       Distribution request_distribution, const int32_t batch_size,
       const size_t max_threads, const uint32_t num_of_sequences,
       const SharedMemoryType shared_memory_type, const size_t output_shm_size,
@@ -96,7 +97,8 @@ class RequestRateManager : public LoadManager {
       const std::shared_ptr<cb::ClientBackendFactory>& factory,
       std::unique_ptr<LoadManager>* manager,
       const std::unordered_map<std::string, cb::RequestParameter>&
-          request_parameters);
+          request_parameters,
+      const DistributionParams& distribution_params = DistributionParams{});
 
   /// Performs warmup for benchmarking by sending a fixed number of requests
   /// according to the specified request rate
@@ -115,18 +117,37 @@ class RequestRateManager : public LoadManager {
   cb::Error ChangeRequestRate(
       const double target_request_rate, const size_t request_count = 0);
 
+  /// Makes the request rate of every run follow the given curve from the
+  /// start of the run, instead of staying at the rate the run is started
+  /// with. The request distribution still sets the shape of the arrivals.
+  /// \param load_curve The load curve, or nullptr for a fixed request rate.
+  void SetLoadCurve(std::shared_ptr<const LoadCurve> load_curve)
+  {
+    load_curve_ = std::move(load_curve);
+  }
+
+  /// \return The load curve the request rate follows, if any
+  const std::shared_ptr<const LoadCurve>& GetLoadCurve() const
+  {
+    return load_curve_;
+  }
+
+  /// \return The time the schedule of the current run started, in
+  /// nanoseconds since the epoch of the system clock
+  uint64_t GetScheduleStartNs() const { return schedule_start_ns_; }
+
 
  protected:
   RequestRateManager(
       const bool async, const bool streaming, Distribution request_distribution,
-      const int32_t batch_size, const uint64_t measurement_window_ms,
-      const size_t max_trials, const size_t max_threads,
+      const int32_t batch_size, const size_t max_threads,
       const uint32_t num_of_sequences,
       const SharedMemoryType shared_memory_type, const size_t output_shm_size,
       const bool serial_sequences, const std::shared_ptr<ModelParser>& parser,
       const std::shared_ptr<cb::ClientBackendFactory>& factory,
       const std::unordered_map<std::string, cb::RequestParameter>&
-          request_parameters);
+          request_parameters,
+      const DistributionParams& distribution_params = DistributionParams{});
 
   void InitManagerFinalize() override;
 
@@ -134,10 +155,30 @@ class RequestRateManager : public LoadManager {
   /// \param request_rate The request rate to use for new schedule.
   void GenerateSchedule(const double request_rate);
 
+  /// Returns the distribution of the gaps between requests of the request
+  /// distribution at the given rate, or an empty function if it has none
+  std::function<std::chrono::nanoseconds(std::mt19937&)> CreateDistribution(
+      const double request_rate);
+
   std::vector<RateSchedulePtr_t> CreateWorkerSchedules(
       std::chrono::nanoseconds duration,
       std::function<std::chrono::nanoseconds(std::mt19937&)> distribution);
 
+  /// Creates worker schedules that generate Poisson distributed timestamps on
+  /// demand. Each worker is given an independent Poisson process with a share
+  /// of the request rate proportional to its share of the thread ids, so that
+  /// together they form a Poisson process of the given request rate.
+  /// \param request_rate The request rate of all the workers combined.
+  std::vector<RateSchedulePtr_t> CreatePoissonWorkerSchedules(
+      const double request_rate);
+
+  /// Creates worker schedules that take their timestamps from one stream
+  /// generated on demand, dealt out to the workers in thread id order.
+  /// \param distribution The distribution of the gaps between all the
+  /// timestamps of the workers combined.
+  std::vector<RateSchedulePtr_t> CreateSharedWorkerSchedules(
+      std::function<std::chrono::nanoseconds(std::mt19937&)> distribution);
+
   std::vector<RateSchedulePtr_t> CreateEmptyWorkerSchedules();
 
   std::vector<size_t> CalculateThreadIds();
@@ -161,9 +202,15 @@ class RequestRateManager : public LoadManager {
 
   size_t DetermineNumThreads();
 
-  std::shared_ptr<std::chrono::nanoseconds> gen_duration_;
   Distribution request_distribution_;
+  const DistributionParams distribution_params_{};
   std::chrono::steady_clock::time_point start_time_;
+  uint64_t schedule_start_ns_{0};
+  std::shared_ptr<const LoadCurve> load_curve_{};
+  // Releases the requests of all the workers when they are dispatched from a
+  // timing wheel instead of each worker following its own schedule
+  std::shared_ptr<DispatchQueue> dispatch_queue_{};
+  std::unique_ptr<RequestDispatcher> dispatcher_{};
   bool execute_;
   const size_t num_of_sequences_{0};
   const bool serial_sequences_{false};
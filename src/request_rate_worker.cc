@@ -46,9 +46,19 @@ RequestRateWorker::Infer()
   do {
     HandleExecuteOff();
 
-    bool is_delayed = SleepIfNecessary();
+    bool is_delayed = false;
+    if (thread_config_->dispatch_queue_) {
+      if (!TakeDispatchedRequest(is_delayed)) {
+        if (HandleExitConditions()) {
+          return;
+        }
+        continue;
+      }
+    } else {
+      is_delayed = SleepIfNecessary();
+    }
     uint32_t ctx_id = GetCtxId();
-    SendInferRequest(ctx_id, is_delayed);
+    SendInferRequest(ctx_id, is_delayed, scheduled_ns_);
     RestoreFreeCtxId(ctx_id);
 
     if (HandleExitConditions()) {
@@ -133,8 +143,8 @@ RequestRateWorker::SleepIfNecessary()
 
   std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
   std::chrono::nanoseconds next_timestamp = GetNextTimestamp();
-  std::chrono::nanoseconds current_timestamp = now - start_time_;
-  std::chrono::nanoseconds wait_time = next_timestamp - current_timestamp;
+  std::chrono::steady_clock::time_point deadline = start_time_ + next_timestamp;
+  std::chrono::nanoseconds wait_time = deadline - now;
 
   bool delayed = false;
   if (wait_time < std::chrono::nanoseconds::zero() &&
@@ -142,12 +152,66 @@ RequestRateWorker::SleepIfNecessary()
     delayed = true;
   } else {
     thread_stat_->idle_timer.Start();
-    std::this_thread::sleep_for(wait_time);
+    pacer_.WaitUntil(deadline);
     thread_stat_->idle_timer.Stop();
   }
+
+  RecordDeadline(deadline);
   return delayed;
 }
 
+bool
+RequestRateWorker::TakeDispatchedRequest(bool& is_delayed)
+{
+  WaitForFreeCtx();
+
+  // The request is only taken once there is a context to send it with, so
+  // that a busy worker leaves it to the others
+  std::chrono::steady_clock::time_point deadline;
+  bool taken = false;
+  thread_stat_->idle_timer.Start();
+  while (!taken && execute_ && !early_exit) {
+    taken = thread_config_->dispatch_queue_->WaitPop(
+        id_, deadline, dispatch_poll_interval_);
+  }
+  thread_stat_->idle_timer.Stop();
+
+  if (taken) {
+    // The dispatcher releases requests once they are due, so the request is
+    // delayed if it waited in the queue for too long
+    is_delayed =
+        std::chrono::steady_clock::now() - deadline > delay_tolerance_;
+    RecordDeadline(deadline);
+  }
+  return taken;
+}
+
+void
+RequestRateWorker::RecordDeadline(
+    std::chrono::steady_clock::time_point deadline)
+{
+  // The schedule is kept on the steady clock while request records use the
+  // system clock
+  const std::chrono::nanoseconds skew{
+      std::chrono::steady_clock::now() - deadline};
+  scheduled_ns_ =
+      CHRONO_TO_NANOS(std::chrono::system_clock::now()) - skew.count();
+
+  RecordScheduleSkew(skew);
+}
+
+void
+RequestRateWorker::RecordScheduleSkew(std::chrono::nanoseconds skew)
+{
+  // Requests released ahead of their schedule count as on time
+  const uint64_t skew_ns{
+      skew > std::chrono::nanoseconds::zero()
+          ? static_cast<uint64_t>(skew.count())
+          : 0};
+  std::lock_guard<std::mutex> lock(thread_stat_->mu_);
+  thread_stat_->schedule_skew_.Record(skew_ns);
+}
+
 void
 RequestRateWorker::WaitForFreeCtx()
 {
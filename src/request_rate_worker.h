@@ -31,6 +31,7 @@
 #include "ischeduler.h"
 #include "load_worker.h"
 #include "model_parser.h"
+#include "request_pacer.h"
 #include "sequence_manager.h"
 #include "thread_config.h"
 
@@ -73,7 +74,8 @@ class RequestRateWorker : public LoadWorker, public IScheduler {
             wake_signal, wake_mutex, execute, infer_data_manager,
             sequence_manager),
         num_threads_(num_threads), start_time_(start_time),
-        serial_sequences_(serial_sequences)
+        serial_sequences_(serial_sequences),
+        pacer_(thread_config->request_pacing_)
   {
   }
 
@@ -89,6 +91,10 @@ class RequestRateWorker : public LoadWorker, public IScheduler {
   const size_t num_threads_;
   const bool serial_sequences_;
   std::chrono::steady_clock::time_point& start_time_;
+  RequestPacer pacer_;
+  // The wall clock time the next request is scheduled to be sent at, so that
+  // its latency can also be measured from when it should have been sent
+  uint64_t scheduled_ns_{0};
 
   void CreateCtxIdTracker();
 
@@ -101,10 +107,24 @@ class RequestRateWorker : public LoadWorker, public IScheduler {
   void HandleExecuteOff();
   void ResetFreeCtxIds();
 
-  // Sleep until it is time for the next part of the schedule
+  // Sleep until it is time for the next part of the schedule, and record how
+  // late the request is sent relative to it in scheduled_ns_ and the schedule
+  // skew
   // Returns true if the request was delayed
   bool SleepIfNecessary();
 
+  // Wait for the dispatcher to release a request and record how late it is
+  // sent relative to its schedule the same way SleepIfNecessary does
+  // Returns false if no request was released before the worker was paused or
+  // told to exit
+  bool TakeDispatchedRequest(bool& is_delayed);
+
+  // Record how late the request scheduled at the given time is sent in
+  // scheduled_ns_ and the schedule skew
+  void RecordDeadline(std::chrono::steady_clock::time_point deadline);
+
+  void RecordScheduleSkew(std::chrono::nanoseconds skew);
+
   void WaitForFreeCtx();
 
   void CreateContextFinalize(std::shared_ptr<InferContext> ctx) override
@@ -117,6 +137,9 @@ class RequestRateWorker : public LoadWorker, public IScheduler {
   }
 
   const std::chrono::milliseconds delay_tolerance_{1};
+  // The longest a worker waits for a dispatched request without checking
+  // whether it should pause or exit
+  const std::chrono::milliseconds dispatch_poll_interval_{10};
 
 #ifndef DOCTEST_CONFIG_DISABLE
   friend NaggyMockRequestRateWorker;
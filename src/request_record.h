@@ -27,6 +27,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -42,11 +43,19 @@ struct RecordData {
     data_type_ = data_type;
   }
 
+  /// Creates a record of data that was captured as a hash of its content
+  RecordData(uint64_t hash, size_t size, std::string data_type)
+      : size_(size), data_type_(data_type), is_hash_(true), hash_(hash)
+  {
+  }
+
   // Define equality comparison operator so it can be inserted into maps
   bool operator==(const RecordData& other) const
   {
-    if (size_ != other.size_)
+    if (size_ != other.size_ || is_hash_ != other.is_hash_)
       return false;
+    if (is_hash_)
+      return hash_ == other.hash_;
     // Compare the contents of the arrays
     return std::memcmp(data_.data(), other.data_.data(), size_) == 0;
   }
@@ -54,6 +63,10 @@ struct RecordData {
   std::vector<uint8_t> data_;
   size_t size_;
   std::string data_type_;
+  // Whether only the hash of the data was captured, in which case data_ is
+  // empty and size_ is the size of the original data
+  bool is_hash_{false};
+  uint64_t hash_{0};
 };
 
 
@@ -70,12 +83,15 @@ struct RequestRecord {
       std::vector<RequestInput> request_inputs = {},
       std::vector<ResponseOutput> response_outputs = {},
       bool sequence_end = true, bool delayed = false, uint64_t sequence_id = 0,
-      bool has_null_last_response = false)
+      bool has_null_last_response = false,
+      std::chrono::time_point<std::chrono::system_clock> scheduled_time =
+          std::chrono::time_point<std::chrono::system_clock>())
       : start_time_(start_time), response_timestamps_(response_timestamps),
         request_inputs_(request_inputs), response_outputs_(response_outputs),
         sequence_end_(sequence_end), delayed_(delayed),
         sequence_id_(sequence_id),
-        has_null_last_response_(has_null_last_response)
+        has_null_last_response_(has_null_last_response),
+        scheduled_time_(scheduled_time)
   {
   }
   // The timestamp of when the request was started.
@@ -94,6 +110,9 @@ struct RequestRecord {
   uint64_t sequence_id_;
   // Whether the last response is null
   bool has_null_last_response_;
+  // The timestamp of when the request was scheduled to be sent, or the epoch
+  // if the request was not sent on a schedule.
+  std::chrono::time_point<std::chrono::system_clock> scheduled_time_;
 };
 
 }}  // namespace triton::perfanalyzer
@@ -0,0 +1,57 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "request_record_handoff.h"
+
+#include <chrono>
+#include <thread>
+
+namespace triton { namespace perfanalyzer {
+
+uint64_t
+RequestRecordHandoff::TakeAll(RequestRecordStore& records)
+{
+  const uint32_t previous{active_.load()};
+  active_.store(previous ^ 1);
+
+  // Producers that loaded the previous buffer before the flip either see the
+  // flip and retry on the other buffer, or finish their append before we take
+  // the buffer below
+  const auto wait_start{std::chrono::steady_clock::now()};
+  while (writing_[previous].load(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+  const auto wait_end{std::chrono::steady_clock::now()};
+
+  count_.fetch_sub(buffers_[previous].size(), std::memory_order_relaxed);
+  records.Merge(std::move(buffers_[previous]));
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             wait_end - wait_start)
+      .count();
+}
+
+}}  // namespace triton::perfanalyzer
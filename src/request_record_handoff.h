@@ -0,0 +1,92 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "request_record.h"
+#include "request_record_store.h"
+
+namespace triton { namespace perfanalyzer {
+
+/// Double-buffered hand-off of completed request records from a worker to
+/// the profiler.
+///
+/// Producers append to the active buffer without taking any lock shared with
+/// the consumer. The consumer flips the active buffer and takes the inactive
+/// one by move, only waiting for an append that was already in progress on
+/// it. Appends must be serialized among producers; the consumer may run
+/// concurrently with them.
+class RequestRecordHandoff {
+ public:
+  /// Appends the record staged in the given builder.
+  void Append(const RequestRecordBuilder& record)
+  {
+    Write([&record](RequestRecordStore& buffer) { buffer.Append(record); });
+  }
+
+  /// Appends a copy of the given record.
+  void push_back(const RequestRecord& record)
+  {
+    Write([&record](RequestRecordStore& buffer) { buffer.push_back(record); });
+  }
+
+  /// Moves every record appended so far to the end of the given store.
+  /// \param records The store to move the records to.
+  /// \return The time in nanoseconds spent waiting for an in-progress append.
+  uint64_t TakeAll(RequestRecordStore& records);
+
+  /// The number of records appended and not taken yet.
+  size_t size() const { return count_.load(std::memory_order_relaxed); }
+
+ private:
+  template <typename Writer>
+  void Write(Writer writer)
+  {
+    while (true) {
+      const uint32_t active{active_.load()};
+      writing_[active].store(true);
+      // The consumer may have flipped the buffers since we loaded the active
+      // one. If so, it may already be draining this buffer, so retry.
+      if (active_.load() == active) {
+        writer(buffers_[active]);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        writing_[active].store(false, std::memory_order_release);
+        return;
+      }
+      writing_[active].store(false);
+    }
+  }
+
+  std::array<RequestRecordStore, 2> buffers_;
+  std::array<std::atomic<bool>, 2> writing_{false, false};
+  std::atomic<uint32_t> active_{0};
+  std::atomic<size_t> count_{0};
+};
+
+}}  // namespace triton::perfanalyzer
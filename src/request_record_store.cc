@@ -0,0 +1,553 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "request_record_store.h"
+
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+
+#include "perf_utils.h"
+
+namespace triton { namespace perfanalyzer {
+
+//==============================================================================
+// RecordStringTable
+//
+RecordStringTable&
+RecordStringTable::Instance()
+{
+  static RecordStringTable table{};
+  return table;
+}
+
+uint32_t
+RecordStringTable::Intern(const std::string& str)
+{
+  auto& table{Instance()};
+  {
+    std::shared_lock<std::shared_mutex> lock(table.mu_);
+    const auto it{table.ids_.find(str)};
+    if (it != table.ids_.end()) {
+      return it->second;
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(table.mu_);
+  const auto it{table.ids_.find(str)};
+  if (it != table.ids_.end()) {
+    return it->second;
+  }
+  const uint32_t id{static_cast<uint32_t>(table.strings_.size())};
+  const auto& stored{table.strings_.emplace_back(str)};
+  table.ids_.emplace(std::string_view(stored), id);
+  return id;
+}
+
+const std::string&
+RecordStringTable::Get(uint32_t id)
+{
+  auto& table{Instance()};
+  std::shared_lock<std::shared_mutex> lock(table.mu_);
+  return table.strings_.at(id);
+}
+
+//==============================================================================
+// RecordArena
+//
+RecordArena&
+RecordArena::operator=(const RecordArena& other)
+{
+  if (this != &other) {
+    blocks_ = other.blocks_;
+    current_ = nullptr;
+    cursor_ = nullptr;
+    remaining_ = 0;
+  }
+  return *this;
+}
+
+const uint8_t*
+RecordArena::Copy(const uint8_t* data, size_t size)
+{
+  if (size == 0) {
+    return nullptr;
+  }
+
+  // Large payloads get a block of their own so they don't waste the tail of
+  // the current block
+  if (size > BLOCK_SIZE / 4) {
+    std::shared_ptr<uint8_t[]> block(new uint8_t[size]);
+    std::memcpy(block.get(), data, size);
+    blocks_.push_back(std::move(block));
+    return blocks_.back().get();
+  }
+
+  if (size > remaining_) {
+    std::shared_ptr<uint8_t[]> block(new uint8_t[BLOCK_SIZE]);
+    cursor_ = block.get();
+    remaining_ = BLOCK_SIZE;
+    current_ = block;
+    blocks_.push_back(std::move(block));
+  }
+
+  uint8_t* dst{cursor_};
+  std::memcpy(dst, data, size);
+  cursor_ += size;
+  remaining_ -= size;
+  return dst;
+}
+
+void
+RecordArena::Adopt(RecordArena& other)
+{
+  blocks_.insert(
+      blocks_.end(), std::make_move_iterator(other.blocks_.begin()),
+      std::make_move_iterator(other.blocks_.end()));
+  other.blocks_.clear();
+  if (other.current_ != nullptr) {
+    other.blocks_.push_back(other.current_);
+  }
+}
+
+void
+RecordArena::Share(const RecordArena& other)
+{
+  blocks_.insert(blocks_.end(), other.blocks_.begin(), other.blocks_.end());
+}
+
+void
+RecordArena::Clear()
+{
+  blocks_.clear();
+  current_ = nullptr;
+  cursor_ = nullptr;
+  remaining_ = 0;
+}
+
+//==============================================================================
+// RequestRecordBuilder
+//
+void
+RequestRecordBuilder::Reset(
+    bool sequence_end, bool delayed, uint64_t sequence_id)
+{
+  start_ns_ = 0;
+  scheduled_ns_ = 0;
+  sequence_end_ = sequence_end;
+  delayed_ = delayed;
+  sequence_id_ = sequence_id;
+  has_null_last_response_ = false;
+  input_ref_ = {};
+  output_capture_ = OutputCapturePolicy::Full;
+  response_ns_.clear();
+  inputs_.clear();
+  outputs_.clear();
+  output_group_ends_.clear();
+  bytes_.clear();
+}
+
+void
+RequestRecordBuilder::Stage(
+    std::vector<StagedPayload>& payloads, uint32_t name_id,
+    uint32_t data_type_id, const uint8_t* data, size_t size)
+{
+  payloads.push_back({bytes_.size(), size, name_id, data_type_id});
+  bytes_.insert(bytes_.end(), data, data + size);
+}
+
+void
+RequestRecordBuilder::AddInput(
+    uint32_t name_id, uint32_t data_type_id, const uint8_t* data, size_t size)
+{
+  Stage(inputs_, name_id, data_type_id, data, size);
+}
+
+void
+RequestRecordBuilder::AddResponse(uint64_t timestamp_ns, bool is_null_response)
+{
+  response_ns_.push_back(timestamp_ns);
+  output_group_ends_.push_back(outputs_.size());
+  has_null_last_response_ = has_null_last_response_ || is_null_response;
+}
+
+void
+RequestRecordBuilder::AddOutput(
+    uint32_t name_id, uint32_t data_type_id, const uint8_t* data, size_t size)
+{
+  Stage(outputs_, name_id, data_type_id, data, size);
+  EndOutput();
+}
+
+void
+RequestRecordBuilder::AddOutputHash(
+    uint32_t name_id, uint32_t data_type_id, uint64_t hash, size_t size)
+{
+  outputs_.push_back({bytes_.size(), size, name_id, data_type_id, true, hash});
+  EndOutput();
+}
+
+void
+RequestRecordBuilder::EndOutput()
+{
+  if (!output_group_ends_.empty()) {
+    output_group_ends_.back() = outputs_.size();
+  }
+}
+
+//==============================================================================
+// RequestRecordStore
+//
+RequestRecordStore::RequestRecordStore(
+    const std::vector<RequestRecord>& records)
+{
+  for (const auto& record : records) {
+    push_back(record);
+  }
+}
+
+void
+RequestRecordStore::ClearColumns()
+{
+  start_ns_.clear();
+  scheduled_ns_.clear();
+  end_ns_.clear();
+  flags_.clear();
+  sequence_id_.clear();
+  input_ref_.clear();
+  response_begin_.clear();
+  response_count_.clear();
+  input_begin_.clear();
+  input_count_.clear();
+  output_group_begin_.clear();
+  output_group_count_.clear();
+  response_ns_.clear();
+  output_groups_.clear();
+  payloads_.clear();
+}
+
+void
+RequestRecordStore::ReserveRows(size_t count)
+{
+  const size_t rows{size() + count};
+  start_ns_.reserve(rows);
+  scheduled_ns_.reserve(rows);
+  end_ns_.reserve(rows);
+  flags_.reserve(rows);
+  sequence_id_.reserve(rows);
+  input_ref_.reserve(rows);
+  response_begin_.reserve(rows);
+  response_count_.reserve(rows);
+  input_begin_.reserve(rows);
+  input_count_.reserve(rows);
+  output_group_begin_.reserve(rows);
+  output_group_count_.reserve(rows);
+}
+
+void
+RequestRecordStore::clear()
+{
+  ClearColumns();
+  arena_.Clear();
+}
+
+uint64_t
+RequestRecordStore::ComputeEndNs(
+    std::span<const uint64_t> response_ns, bool has_null_last_response)
+{
+  if (!has_null_last_response) {
+    return response_ns.empty() ? 0 : response_ns.back();
+  }
+  // The null response only marks the end of the stream, so the request ends
+  // with the response before it
+  return response_ns.size() > 1 ? response_ns[response_ns.size() - 2] : 0;
+}
+
+void
+RequestRecordStore::AppendRow(
+    uint64_t start_ns, uint64_t scheduled_ns, uint64_t end_ns, uint8_t flags,
+    uint64_t sequence_id, const RecordInputRef& input_ref)
+{
+  start_ns_.push_back(start_ns);
+  scheduled_ns_.push_back(scheduled_ns);
+  end_ns_.push_back(end_ns);
+  flags_.push_back(flags);
+  sequence_id_.push_back(sequence_id);
+  input_ref_.push_back(input_ref);
+  response_begin_.push_back(response_ns_.size());
+  input_begin_.push_back(payloads_.size());
+  output_group_begin_.push_back(output_groups_.size());
+}
+
+void
+RequestRecordStore::push_back(const RequestRecord& record)
+{
+  std::vector<uint64_t> response_ns{};
+  response_ns.reserve(record.response_timestamps_.size());
+  for (const auto& timestamp : record.response_timestamps_) {
+    response_ns.push_back(CHRONO_TO_NANOS(timestamp));
+  }
+
+  uint8_t flags{0};
+  flags |= record.sequence_end_ ? SEQUENCE_END : 0;
+  flags |= record.delayed_ ? DELAYED : 0;
+  flags |= record.has_null_last_response_ ? NULL_LAST_RESPONSE : 0;
+  AppendRow(
+      CHRONO_TO_NANOS(record.start_time_),
+      CHRONO_TO_NANOS(record.scheduled_time_),
+      ComputeEndNs(response_ns, record.has_null_last_response_), flags,
+      record.sequence_id_, RecordInputRef{});
+
+  response_ns_.insert(
+      response_ns_.end(), response_ns.begin(), response_ns.end());
+  response_count_.push_back(response_ns.size());
+
+  const auto copy_payloads{[this](const auto& payload_map) -> uint32_t {
+    for (const auto& [name, record_data] : payload_map) {
+      const uint32_t name_id{RecordStringTable::Intern(name)};
+      const uint32_t data_type_id{
+          RecordStringTable::Intern(record_data.data_type_)};
+      if (record_data.is_hash_) {
+        payloads_.push_back(
+            {nullptr, record_data.size_, name_id, data_type_id, true,
+             record_data.hash_});
+        continue;
+      }
+      payloads_.push_back(
+          {arena_.Copy(record_data.data_.data(), record_data.data_.size()),
+           record_data.data_.size(), name_id, data_type_id});
+    }
+    return payload_map.size();
+  }};
+
+  uint32_t input_count{0};
+  for (const auto& request_input : record.request_inputs_) {
+    input_count += copy_payloads(request_input);
+  }
+  input_count_.push_back(input_count);
+
+  for (const auto& response_output : record.response_outputs_) {
+    const uint64_t begin{payloads_.size()};
+    const uint32_t count{copy_payloads(response_output)};
+    output_groups_.push_back({begin, count});
+  }
+  output_group_count_.push_back(record.response_outputs_.size());
+}
+
+void
+RequestRecordStore::Append(const RequestRecordBuilder& builder)
+{
+  uint8_t flags{0};
+  flags |= builder.sequence_end_ ? SEQUENCE_END : 0;
+  flags |= builder.delayed_ ? DELAYED : 0;
+  flags |= builder.has_null_last_response_ ? NULL_LAST_RESPONSE : 0;
+  AppendRow(
+      builder.start_ns_, builder.scheduled_ns_,
+      ComputeEndNs(builder.response_ns_, builder.has_null_last_response_),
+      flags, builder.sequence_id_, builder.input_ref_);
+
+  response_ns_.insert(
+      response_ns_.end(), builder.response_ns_.begin(),
+      builder.response_ns_.end());
+  response_count_.push_back(builder.response_ns_.size());
+
+  // All payloads of the record are copied into the arena with a single copy
+  const uint8_t* base{
+      arena_.Copy(builder.bytes_.data(), builder.bytes_.size())};
+  const auto add_payload{[this, base](const auto& staged) {
+    if (staged.is_hash) {
+      payloads_.push_back(
+          {nullptr, staged.size, staged.name_id, staged.data_type_id, true,
+           staged.hash});
+      return;
+    }
+    payloads_.push_back(
+        {base + staged.offset, staged.size, staged.name_id,
+         staged.data_type_id});
+  }};
+
+  for (const auto& staged : builder.inputs_) {
+    add_payload(staged);
+  }
+  input_count_.push_back(builder.inputs_.size());
+
+  uint64_t group_begin{0};
+  for (const auto group_end : builder.output_group_ends_) {
+    output_groups_.push_back(
+        {payloads_.size(), static_cast<uint32_t>(group_end - group_begin)});
+    for (uint64_t j = group_begin; j < group_end; j++) {
+      add_payload(builder.outputs_[j]);
+    }
+    group_begin = group_end;
+  }
+  output_group_count_.push_back(builder.output_group_ends_.size());
+}
+
+void
+RequestRecordStore::AppendFrom(
+    const RequestRecordStore& other, size_t i, const bool copy_payload)
+{
+  AppendRow(
+      other.start_ns_[i], other.scheduled_ns_[i], other.end_ns_[i],
+      other.flags_[i],
+      other.sequence_id_[i], other.input_ref_[i]);
+
+  const auto response_ns{other.ResponseNs(i)};
+  response_ns_.insert(
+      response_ns_.end(), response_ns.begin(), response_ns.end());
+  response_count_.push_back(response_ns.size());
+
+  const auto add_payload{[this, copy_payload](const RecordPayload& payload) {
+    RecordPayload copy{payload};
+    if (copy_payload && !payload.is_hash) {
+      copy.data = arena_.Copy(payload.data, payload.size);
+    }
+    payloads_.push_back(copy);
+  }};
+
+  for (const auto& payload : other.Inputs(i)) {
+    add_payload(payload);
+  }
+  input_count_.push_back(other.input_count_[i]);
+
+  for (size_t group = 0; group < other.OutputGroupCount(i); group++) {
+    const auto outputs{other.Outputs(i, group)};
+    output_groups_.push_back(
+        {payloads_.size(), static_cast<uint32_t>(outputs.size())});
+    for (const auto& payload : outputs) {
+      add_payload(payload);
+    }
+  }
+  output_group_count_.push_back(other.output_group_count_[i]);
+}
+
+void
+RequestRecordStore::Merge(RequestRecordStore&& other)
+{
+  if (empty()) {
+    std::swap(*this, other);
+    other.clear();
+    return;
+  }
+
+  const auto append_offset{[](std::vector<uint64_t>& dst,
+                              const std::vector<uint64_t>& src,
+                              const uint64_t offset) {
+    dst.reserve(dst.size() + src.size());
+    for (const auto value : src) {
+      dst.push_back(value + offset);
+    }
+  }};
+  const auto append{[](auto& dst, const auto& src) {
+    dst.insert(dst.end(), src.begin(), src.end());
+  }};
+
+  append_offset(response_begin_, other.response_begin_, response_ns_.size());
+  append_offset(input_begin_, other.input_begin_, payloads_.size());
+  append_offset(
+      output_group_begin_, other.output_group_begin_, output_groups_.size());
+
+  const uint64_t payload_offset{payloads_.size()};
+  output_groups_.reserve(output_groups_.size() + other.output_groups_.size());
+  for (const auto& group : other.output_groups_) {
+    output_groups_.push_back({group.begin + payload_offset, group.count});
+  }
+
+  append(start_ns_, other.start_ns_);
+  append(scheduled_ns_, other.scheduled_ns_);
+  append(end_ns_, other.end_ns_);
+  append(flags_, other.flags_);
+  append(sequence_id_, other.sequence_id_);
+  append(input_ref_, other.input_ref_);
+  append(response_count_, other.response_count_);
+  append(input_count_, other.input_count_);
+  append(output_group_count_, other.output_group_count_);
+  append(response_ns_, other.response_ns_);
+  append(payloads_, other.payloads_);
+  arena_.Adopt(other.arena_);
+
+  other.ClearColumns();
+}
+
+RequestRecord
+RequestRecordStore::GetRecord(size_t i) const
+{
+  using time_point = std::chrono::time_point<std::chrono::system_clock>;
+
+  const auto to_record_data{[](std::span<const RecordPayload> payloads) {
+    std::unordered_map<std::string, RecordData> record_data{};
+    for (const auto& payload : payloads) {
+      if (payload.is_hash) {
+        record_data.emplace(
+            payload.Name(),
+            RecordData(payload.hash, payload.size, payload.DataType()));
+        continue;
+      }
+      record_data.emplace(
+          payload.Name(),
+          RecordData(
+              std::vector<uint8_t>(payload.data, payload.data + payload.size),
+              payload.DataType()));
+    }
+    return record_data;
+  }};
+
+  std::vector<time_point> response_timestamps{};
+  for (const auto timestamp_ns : ResponseNs(i)) {
+    response_timestamps.emplace_back(std::chrono::nanoseconds(timestamp_ns));
+  }
+
+  std::vector<RequestRecord::RequestInput> request_inputs{};
+  if (input_count_[i] != 0) {
+    request_inputs.push_back(to_record_data(Inputs(i)));
+  }
+
+  std::vector<RequestRecord::ResponseOutput> response_outputs{};
+  for (size_t group = 0; group < OutputGroupCount(i); group++) {
+    response_outputs.push_back(to_record_data(Outputs(i, group)));
+  }
+
+  return RequestRecord(
+      time_point(std::chrono::nanoseconds(start_ns_[i])),
+      std::move(response_timestamps), std::move(request_inputs),
+      std::move(response_outputs), SequenceEnd(i), Delayed(i), SequenceId(i),
+      HasNullLastResponse(i),
+      time_point(std::chrono::nanoseconds(scheduled_ns_[i])));
+}
+
+std::vector<RequestRecord>
+RequestRecordStore::GetRecords() const
+{
+  std::vector<RequestRecord> records{};
+  records.reserve(size());
+  for (size_t i = 0; i < size(); i++) {
+    records.push_back(GetRecord(i));
+  }
+  return records;
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,377 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "output_capture.h"
+#include "request_record.h"
+
+namespace triton { namespace perfanalyzer {
+
+/// Process-wide table of the tensor names and data types that appear in
+/// request records. Records keep the small integer id instead of their own
+/// copy of the string.
+class RecordStringTable {
+ public:
+  /// Returns the id of the given string, adding it to the table if needed.
+  static uint32_t Intern(const std::string& str);
+
+  /// Returns the string with the given id. The reference stays valid for the
+  /// lifetime of the process.
+  static const std::string& Get(uint32_t id);
+
+ private:
+  static RecordStringTable& Instance();
+
+  std::shared_mutex mu_;
+  std::deque<std::string> strings_;
+  std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+/// Reference to the bytes of a single request input or response output.
+/// Payloads that were captured as a hash have no data, and their size is the
+/// size of the original data.
+struct RecordPayload {
+  const uint8_t* data{nullptr};
+  uint64_t size{0};
+  uint32_t name_id{0};
+  uint32_t data_type_id{0};
+  bool is_hash{false};
+  uint64_t hash{0};
+
+  const std::string& Name() const { return RecordStringTable::Get(name_id); }
+  const std::string& DataType() const
+  {
+    return RecordStringTable::Get(data_type_id);
+  }
+};
+
+/// Reference to the dataset entry a request's inputs were taken from. The
+/// bytes are resolved from the data loader when the record is exported, so
+/// recording a request does not copy its input tensors.
+struct RecordInputRef {
+  int32_t stream_id{-1};
+  int32_t step_id{-1};
+
+  bool IsValid() const { return stream_id >= 0 && step_id >= 0; }
+};
+
+/// Append-only byte arena backing the payloads of a RequestRecordStore.
+///
+/// Blocks are reference counted so that records handed from one store to
+/// another keep their bytes alive without copying them. A block is only ever
+/// written past the bytes already handed out, so a store may keep filling its
+/// current block after sharing it.
+class RecordArena {
+ public:
+  RecordArena() = default;
+  RecordArena(RecordArena&&) = default;
+  RecordArena& operator=(RecordArena&&) = default;
+  RecordArena(const RecordArena& other) : blocks_(other.blocks_) {}
+  RecordArena& operator=(const RecordArena& other);
+
+  /// Copies the given bytes into the arena and returns their new location.
+  const uint8_t* Copy(const uint8_t* data, size_t size);
+
+  /// Takes shared ownership of every block of the other arena. The other
+  /// arena keeps its current block so it can continue to fill it.
+  void Adopt(RecordArena& other);
+
+  /// Takes shared ownership of every block of the other arena.
+  void Share(const RecordArena& other);
+
+  void Clear();
+
+ private:
+  static constexpr size_t BLOCK_SIZE{1 << 18};
+
+  std::vector<std::shared_ptr<uint8_t[]>> blocks_;
+  std::shared_ptr<uint8_t[]> current_;
+  uint8_t* cursor_{nullptr};
+  size_t remaining_{0};
+};
+
+/// Reusable staging area for a single in-flight request. It keeps its
+/// capacity between requests so that recording a request or one of its
+/// responses does not allocate once the builder has warmed up.
+class RequestRecordBuilder {
+ public:
+  /// Starts a new record, discarding anything staged for the previous one.
+  void Reset(bool sequence_end, bool delayed, uint64_t sequence_id);
+
+  void SetStartNs(uint64_t start_ns) { start_ns_ = start_ns; }
+
+  /// Sets when the request was scheduled to be sent. Requests that are not
+  /// sent on a schedule keep the default of 0.
+  void SetScheduledNs(uint64_t scheduled_ns) { scheduled_ns_ = scheduled_ns; }
+
+  void AddInput(
+      uint32_t name_id, uint32_t data_type_id, const uint8_t* data,
+      size_t size);
+
+  /// Records the inputs of the request by reference to the dataset entry
+  /// they were taken from, instead of by copy.
+  void SetInputRef(int32_t stream_id, int32_t step_id)
+  {
+    input_ref_ = {stream_id, step_id};
+  }
+
+  /// Records the arrival of a response. Outputs added afterwards belong to
+  /// this response. Once a null response is recorded, the record is marked as
+  /// having a null last response.
+  void AddResponse(uint64_t timestamp_ns, bool is_null_response);
+
+  void AddOutput(
+      uint32_t name_id, uint32_t data_type_id, const uint8_t* data,
+      size_t size);
+
+  /// Records an output of the latest response by the hash and size of its
+  /// content only.
+  void AddOutputHash(
+      uint32_t name_id, uint32_t data_type_id, uint64_t hash, size_t size);
+
+  /// Sets how the outputs of the request are to be captured. Reset restores
+  /// the default of capturing them in full.
+  void SetOutputCapture(OutputCapturePolicy policy)
+  {
+    output_capture_ = policy;
+  }
+  OutputCapturePolicy GetOutputCapture() const { return output_capture_; }
+
+  uint64_t StartNs() const { return start_ns_; }
+  uint64_t SequenceId() const { return sequence_id_; }
+  size_t ResponseCount() const { return response_ns_.size(); }
+
+ private:
+  struct StagedPayload {
+    uint64_t offset;
+    uint64_t size;
+    uint32_t name_id;
+    uint32_t data_type_id;
+    bool is_hash{false};
+    uint64_t hash{0};
+  };
+
+  void Stage(
+      std::vector<StagedPayload>& payloads, uint32_t name_id,
+      uint32_t data_type_id, const uint8_t* data, size_t size);
+
+  void EndOutput();
+
+  uint64_t start_ns_{0};
+  uint64_t scheduled_ns_{0};
+  uint64_t sequence_id_{0};
+  bool sequence_end_{true};
+  bool delayed_{false};
+  bool has_null_last_response_{false};
+  RecordInputRef input_ref_{};
+  OutputCapturePolicy output_capture_{OutputCapturePolicy::Full};
+  std::vector<uint64_t> response_ns_;
+  std::vector<StagedPayload> inputs_;
+  std::vector<StagedPayload> outputs_;
+  // End index into outputs_ of the outputs of each response
+  std::vector<uint64_t> output_group_ends_;
+  std::vector<uint8_t> bytes_;
+
+  friend class RequestRecordStore;
+};
+
+/// Columnar store of completed request records.
+///
+/// Each record is a row across a set of flat columns. Response timestamps,
+/// inputs and outputs live in shared columns that the per-record columns
+/// index into, and payload bytes live in a RecordArena. Appending a record
+/// therefore only grows a handful of vectors, and moving records between
+/// stores moves whole columns.
+class RequestRecordStore {
+ public:
+  RequestRecordStore() = default;
+
+  /// Builds a store holding a copy of the given records.
+  explicit RequestRecordStore(const std::vector<RequestRecord>& records);
+
+  size_t size() const { return start_ns_.size(); }
+  bool empty() const { return start_ns_.empty(); }
+  void clear();
+
+  /// Appends a copy of the given record.
+  void push_back(const RequestRecord& record);
+
+  /// Appends the record staged in the given builder.
+  void Append(const RequestRecordBuilder& builder);
+
+  /// Moves all records of the other store to the end of this store. The other
+  /// store is left empty.
+  void Merge(RequestRecordStore&& other);
+
+  /// Moves the records for which `predicate(index)` returns true to the end of
+  /// `selected`, preserving their order, and keeps the remaining ones. The
+  /// remaining records are compacted so that the payload memory of the
+  /// selected records is not retained by this store.
+  ///
+  /// The predicate is called exactly once per record, in order. When all or
+  /// none of the records are selected, whole columns are moved instead of
+  /// copying the records one by one.
+  template <typename Predicate>
+  void MoveIf(Predicate predicate, RequestRecordStore& selected)
+  {
+    std::vector<bool> is_selected(size());
+    size_t selected_count{0};
+    for (size_t i = 0; i < size(); i++) {
+      is_selected[i] = predicate(i);
+      selected_count += is_selected[i];
+    }
+
+    if (selected_count == 0) {
+      return;
+    }
+    if (selected_count == size()) {
+      selected.Merge(std::move(*this));
+      return;
+    }
+
+    RequestRecordStore retained{};
+    retained.ReserveRows(size() - selected_count);
+    selected.ReserveRows(selected_count);
+    selected.arena_.Share(arena_);
+    for (size_t i = 0; i < size(); i++) {
+      if (is_selected[i]) {
+        selected.AppendFrom(*this, i, false);
+      } else {
+        retained.AppendFrom(*this, i, true);
+      }
+    }
+    *this = std::move(retained);
+  }
+
+  /// The timestamp of when the request was started.
+  uint64_t StartNs(size_t i) const { return start_ns_[i]; }
+
+  /// The timestamp of when the request was scheduled to be sent, or 0 if the
+  /// request was not sent on a schedule.
+  uint64_t ScheduledNs(size_t i) const { return scheduled_ns_[i]; }
+
+  /// The timestamp of the last non-null response of the request, or 0 if the
+  /// request did not receive one.
+  uint64_t EndNs(size_t i) const { return end_ns_[i]; }
+
+  std::span<const uint64_t> ResponseNs(size_t i) const
+  {
+    return {response_ns_.data() + response_begin_[i], response_count_[i]};
+  }
+
+  bool SequenceEnd(size_t i) const { return flags_[i] & SEQUENCE_END; }
+  bool Delayed(size_t i) const { return flags_[i] & DELAYED; }
+  bool HasNullLastResponse(size_t i) const
+  {
+    return flags_[i] & NULL_LAST_RESPONSE;
+  }
+  uint64_t SequenceId(size_t i) const { return sequence_id_[i]; }
+
+  std::span<const RecordPayload> Inputs(size_t i) const
+  {
+    return {payloads_.data() + input_begin_[i], input_count_[i]};
+  }
+
+  /// The dataset entry the inputs of the request were taken from. Only valid
+  /// for records whose inputs were recorded by reference.
+  const RecordInputRef& InputRef(size_t i) const { return input_ref_[i]; }
+
+  /// The number of responses for which outputs were recorded.
+  size_t OutputGroupCount(size_t i) const { return output_group_count_[i]; }
+
+  std::span<const RecordPayload> Outputs(size_t i, size_t group) const
+  {
+    const auto& output_group{output_groups_[output_group_begin_[i] + group]};
+    return {payloads_.data() + output_group.begin, output_group.count};
+  }
+
+  /// Returns a copy of the record at the given index. Inputs recorded by
+  /// reference are not resolved.
+  RequestRecord GetRecord(size_t i) const;
+
+  /// Returns a copy of all records in the store.
+  std::vector<RequestRecord> GetRecords() const;
+
+ private:
+  enum Flags : uint8_t {
+    SEQUENCE_END = 1 << 0,
+    DELAYED = 1 << 1,
+    NULL_LAST_RESPONSE = 1 << 2
+  };
+
+  struct OutputGroup {
+    uint64_t begin;
+    uint32_t count;
+  };
+
+  /// Appends the record at index i of the other store. If copy_payload is
+  /// false, the payload bytes must already be owned by this store's arena.
+  void AppendFrom(
+      const RequestRecordStore& other, size_t i, const bool copy_payload);
+
+  void AppendRow(
+      uint64_t start_ns, uint64_t scheduled_ns, uint64_t end_ns, uint8_t flags,
+      uint64_t sequence_id, const RecordInputRef& input_ref);
+
+  void ClearColumns();
+
+  /// Reserves the per-record columns for the given number of additional
+  /// records.
+  void ReserveRows(size_t count);
+
+  static uint64_t ComputeEndNs(
+      std::span<const uint64_t> response_ns, bool has_null_last_response);
+
+  std::vector<uint64_t> start_ns_;
+  std::vector<uint64_t> scheduled_ns_;
+  std::vector<uint64_t> end_ns_;
+  std::vector<uint8_t> flags_;
+  std::vector<uint64_t> sequence_id_;
+  std::vector<RecordInputRef> input_ref_;
+  std::vector<uint64_t> response_begin_;
+  std::vector<uint32_t> response_count_;
+  std::vector<uint64_t> input_begin_;
+  std::vector<uint32_t> input_count_;
+  std::vector<uint64_t> output_group_begin_;
+  std::vector<uint32_t> output_group_count_;
+
+  std::vector<uint64_t> response_ns_;
+  std::vector<OutputGroup> output_groups_;
+  std::vector<RecordPayload> payloads_;
+  RecordArena arena_;
+};
+
+}}  // namespace triton::perfanalyzer
@@ -26,44 +26,37 @@
 
 #include "payload_json_utils.h"
 
-#include <rapidjson/allocators.h>
 #include <rapidjson/document.h>
 #include <rapidjson/error/error.h>
-#include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
+#include <stddef.h>
 
 #include <stdexcept>
 #include <string>
 
 #include "../rapidjson_utils.h"
+#include "chat_history.h"
 
 namespace triton::perfanalyzer {
 
 void
 PayloadJsonUtils::UpdateHistoryAndAddToPayload(
-    std::string& payload, rapidjson::Document& chat_history)
+    std::string& payload, ChatHistory& chat_history)
 {
-  auto payload_document{GetPayloadDocument(payload)};
+  const auto payload_document{GetPayloadDocument(payload)};
 
   AddPayloadToChatHistory(payload_document, chat_history);
 
-  SetPayloadToChatHistory(payload_document, chat_history);
-
-  payload = GetSerializedPayload(payload_document);
+  payload = GetSerializedPayload(payload_document, chat_history);
 }
 
 void
 PayloadJsonUtils::AddPayloadToChatHistory(
-    const rapidjson::Document& payload_document,
-    rapidjson::Document& chat_history)
+    const rapidjson::Document& payload_document, ChatHistory& chat_history)
 {
-  const auto& payload_messages{GetPayloadMessages(payload_document)};
-
-  rapidjson::Value payload_messages_copy{};
-  payload_messages_copy.CopyFrom(payload_messages, chat_history.GetAllocator());
-
-  for (auto& payload_message : payload_messages_copy.GetArray()) {
-    chat_history.PushBack(payload_message, chat_history.GetAllocator());
+  for (const auto& payload_message :
+       GetPayloadMessages(payload_document).GetArray()) {
+    chat_history.Append(payload_message);
   }
 }
 
@@ -75,13 +68,6 @@ PayloadJsonUtils::GetPayloadMessages(
   return payload_document["messages"];
 }
 
-rapidjson::Value&
-PayloadJsonUtils::GetPayloadMessages(rapidjson::Document& payload_document)
-{
-  ValidatePayloadMessages(payload_document);
-  return payload_document["messages"];
-}
-
 void
 PayloadJsonUtils::ValidatePayloadMessages(
     const rapidjson::Document& payload_document)
@@ -95,24 +81,35 @@ PayloadJsonUtils::ValidatePayloadMessages(
   }
 }
 
-void
-PayloadJsonUtils::SetPayloadToChatHistory(
-    rapidjson::Document& payload_document,
-    const rapidjson::Document& chat_history)
-{
-  auto& payload_messages{GetPayloadMessages(payload_document)};
-
-  payload_messages.CopyFrom(chat_history, payload_document.GetAllocator());
-}
-
 std::string
 PayloadJsonUtils::GetSerializedPayload(
-    const rapidjson::Document& payload_document)
+    const rapidjson::Document& payload_document,
+    const ChatHistory& chat_history)
 {
-  rapidjson::StringBuffer buffer{};
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  payload_document.Accept(writer);
-  return buffer.GetString();
+  // Serialize the payload with an empty 'messages' array and remember where
+  // the array starts, then splice the history in there
+  std::string serialized_payload{};
+  size_t messages_offset{0};
+
+  StringOutputStream stream(serialized_payload);
+  rapidjson::Writer<StringOutputStream> writer(stream);
+  writer.StartObject();
+  for (auto member{payload_document.MemberBegin()};
+       member != payload_document.MemberEnd(); ++member) {
+    writer.Key(member->name.GetString(), member->name.GetStringLength());
+    if (member->name == "messages") {
+      writer.StartArray();
+      messages_offset = serialized_payload.size();
+      writer.EndArray();
+    } else {
+      member->value.Accept(writer);
+    }
+  }
+  writer.EndObject();
+
+  serialized_payload.insert(messages_offset, chat_history.Messages());
+
+  return serialized_payload;
 }
 
 rapidjson::Document
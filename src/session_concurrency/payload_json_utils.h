@@ -29,33 +29,33 @@
 
 #include <string>
 
+#include "chat_history.h"
+
 namespace triton::perfanalyzer {
 
 class PayloadJsonUtils {
  public:
+  /// Adds the messages of a payload to the chat history, then replaces them
+  /// in the payload with the whole history. Only the payload is parsed and
+  /// serialized; the history is spliced into it as it is.
+  /// \param payload The payload of a turn, which is updated in place.
+  /// \param chat_history The history of the chat the payload belongs to.
   static void UpdateHistoryAndAddToPayload(
-      std::string& payload, rapidjson::Document& chat_history);
+      std::string& payload, ChatHistory& chat_history);
 
  private:
   static void AddPayloadToChatHistory(
-      const rapidjson::Document& payload_document,
-      rapidjson::Document& chat_history);
+      const rapidjson::Document& payload_document, ChatHistory& chat_history);
 
   static const rapidjson::Value& GetPayloadMessages(
       const rapidjson::Document& payload_document);
 
-  static rapidjson::Value& GetPayloadMessages(
-      rapidjson::Document& payload_document);
-
   static void ValidatePayloadMessages(
       const rapidjson::Document& payload_document);
 
-  static void SetPayloadToChatHistory(
-      rapidjson::Document& payload_document,
-      const rapidjson::Document& chat_history);
-
   static std::string GetSerializedPayload(
-      const rapidjson::Document& payload_document);
+      const rapidjson::Document& payload_document,
+      const ChatHistory& chat_history);
 
   static rapidjson::Document GetPayloadDocument(const std::string& payload);
 };
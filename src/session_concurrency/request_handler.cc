@@ -26,24 +26,26 @@
 
 #include "request_handler.h"
 
-#include <rapidjson/allocators.h>
 #include <rapidjson/document.h>
 #include <stddef.h>
 
 #include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <exception>
 #include <functional>
-#include <future>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "../client_backend/client_backend.h"
+#include "../coroutine_executor.h"
 #include "../model_parser.h"
 #include "../request_record.h"
+#include "chat_history.h"
 #include "payload_dataset_manager.h"
 #include "payload_json_utils.h"
 #include "response_json_utils.h"
@@ -65,11 +67,12 @@ RequestHandler::RequestHandler(
 }
 
 void
-RequestHandler::SendRequestAndWaitForResponse(
-    size_t dataset_index, rapidjson::Document& chat_history,
-    RequestRecord& request_record)
+RequestHandler::PrepareAndSendRequest(
+    CompletionAwaiter& awaiter, size_t dataset_index,
+    ChatHistory& chat_history, RequestRecord& request_record,
+    std::string& payload)
 {
-  auto payload{payload_dataset_manager_->GetPayload(dataset_index)};
+  payload = payload_dataset_manager_->GetPayload(dataset_index);
 
   PayloadJsonUtils::UpdateHistoryAndAddToPayload(payload, chat_history);
 
@@ -77,13 +80,9 @@ RequestHandler::SendRequestAndWaitForResponse(
 
   RecordRequestInputs(payload, dataset_index, request_inputs);
 
-  auto response_promise{std::make_shared<std::promise<void>>()};
-  std::future<void> response_future{response_promise->get_future()};
-
   SendRequest(
-      payload, std::move(response_promise), chat_history, request_record);
-
-  WaitForResponse(std::move(response_future));
+      payload, awaiter, chat_history, request_record,
+      output_capture_sampler_.Next());
 }
 
 void
@@ -134,15 +133,15 @@ RequestHandler::RecordDelayInput(
 
 void
 RequestHandler::SendRequest(
-    const std::string& payload,
-    std::shared_ptr<std::promise<void>>&& response_promise,
-    rapidjson::Document& chat_history, RequestRecord& request_record)
+    const std::string& payload, CompletionAwaiter& awaiter,
+    ChatHistory& chat_history, RequestRecord& request_record,
+    const OutputCapturePolicy output_capture)
 {
   const auto requested_outputs{PrepareRequestedOutputs()};
 
   const auto callback{PrepareCallback(
-      std::move(response_promise), requested_outputs, request_record,
-      chat_history)};
+      awaiter, requested_outputs, request_record, chat_history,
+      output_capture)};
 
   const cb::InferOptions options(parser_->ModelName());
 
@@ -156,6 +155,7 @@ RequestHandler::SendRequest(
   if (!error.IsOk()) {
     throw std::runtime_error(error.Message());
   }
+  awaiter.Started();
 }
 
 const std::vector<const cb::InferRequestedOutput*>
@@ -178,35 +178,43 @@ RequestHandler::PrepareRequestedOutputs() const
 
 const std::function<void(cb::InferResult*)>
 RequestHandler::PrepareCallback(
-    std::shared_ptr<std::promise<void>>&& response_promise,
+    CompletionAwaiter& awaiter,
     const std::vector<const cb::InferRequestedOutput*>& requested_outputs,
-    RequestRecord& request_record, rapidjson::Document& chat_history) const
+    RequestRecord& request_record, ChatHistory& chat_history,
+    const OutputCapturePolicy output_capture) const
 {
-  return [response_promise, requested_outputs, &request_record, &chat_history,
-          this](cb::InferResult* infer_result) mutable {
-    if (!infer_result) {
-      throw std::runtime_error("infer_result was null");
-    } else if (!infer_result->RequestStatus().IsOk()) {
-      throw std::runtime_error(infer_result->RequestStatus().Message());
+  return [&awaiter, requested_outputs, &request_record, &chat_history,
+          output_capture, this](cb::InferResult* infer_result) {
+    // Errors are handed to the session, as there is nobody to catch them on
+    // the thread of the client backend
+    std::exception_ptr error{};
+    try {
+      if (!infer_result) {
+        throw std::runtime_error("infer_result was null");
+      } else if (!infer_result->RequestStatus().IsOk()) {
+        throw std::runtime_error(infer_result->RequestStatus().Message());
+      }
+
+      RecordResponse(
+          infer_result, requested_outputs, request_record, output_capture);
+
+      std::vector<uint8_t> response_buffer{};
+      const auto response{
+          GetOutputData(infer_result, "response", response_buffer)};
+
+      const auto& response_document{
+          ResponseJsonUtils::GetResponseDocument(response)};
+
+      const auto& response_message{
+          ResponseJsonUtils::GetMessage(response_document)};
+
+      chat_history.Append(response_message);
+    }
+    catch (...) {
+      error = std::current_exception();
     }
 
-    RecordResponse(infer_result, requested_outputs, request_record);
-
-    const auto response_buffer{GetResponseBuffer(infer_result)};
-
-    const auto& response_document{
-        ResponseJsonUtils::GetResponseDocument(response_buffer)};
-
-    const auto& response_message{
-        ResponseJsonUtils::GetMessage(response_document)};
-
-    rapidjson::Value response_message_copy{};
-    response_message_copy.CopyFrom(
-        response_message, chat_history.GetAllocator());
-
-    chat_history.PushBack(response_message_copy, chat_history.GetAllocator());
-
-    response_promise->set_value();
+    awaiter.Complete(error);
   };
 }
 
@@ -214,40 +222,71 @@ void
 RequestHandler::RecordResponse(
     cb::InferResult* infer_result,
     const std::vector<const cb::InferRequestedOutput*>& requested_outputs,
-    RequestRecord& request_record) const
+    RequestRecord& request_record,
+    const OutputCapturePolicy output_capture) const
 {
-  const auto& end_time{std::chrono::system_clock::now()};
+  // The client backend reports when the response was received, which is
+  // earlier than this callback
+  std::vector<std::chrono::time_point<std::chrono::system_clock>> timestamps{};
+  const bool has_timestamp{
+      infer_result->ResponseTimestamps(&timestamps).IsOk() &&
+      !timestamps.empty()};
+  const auto& end_time{
+      has_timestamp ? timestamps.back() : std::chrono::system_clock::now()};
 
   request_record.response_timestamps_.push_back(end_time);
 
   auto& response_outputs{request_record.response_outputs_.emplace_back()};
 
-  RecordResponseOutputs(infer_result, requested_outputs, response_outputs);
+  RecordResponseOutputs(
+      infer_result, requested_outputs, response_outputs, output_capture);
 }
 
 void
 RequestHandler::RecordResponseOutputs(
     cb::InferResult* infer_result,
     const std::vector<const cb::InferRequestedOutput*>& requested_outputs,
-    RequestRecord::ResponseOutput& response_outputs) const
+    RequestRecord::ResponseOutput& response_outputs,
+    const OutputCapturePolicy output_capture) const
 {
+  if (output_capture == OutputCapturePolicy::None) {
+    return;
+  }
+
   for (const auto& requested_output : requested_outputs) {
     const auto& name{requested_output->Name()};
 
     const auto& data_type{requested_output->Datatype()};
 
     std::vector<uint8_t> buf{};
-    infer_result->RawData(name, buf);
+    const auto data{GetOutputData(infer_result, name, buf)};
+
+    if (output_capture == OutputCapturePolicy::Hash) {
+      const uint64_t hash{HashOutputData(
+          reinterpret_cast<const uint8_t*>(data.data()), data.size())};
+      response_outputs.emplace(name, RecordData(hash, data.size(), data_type));
+      continue;
+    }
+
+    if (buf.empty()) {
+      buf.assign(data.begin(), data.end());
+    }
 
     response_outputs.emplace(name, RecordData(std::move(buf), data_type));
   }
 }
 
-const std::vector<uint8_t>
-RequestHandler::GetResponseBuffer(cb::InferResult* infer_result) const
+std::string_view
+RequestHandler::GetOutputData(
+    cb::InferResult* infer_result, const std::string& output_name,
+    std::vector<uint8_t>& buffer) const
 {
-  const std::string output_name{"response"};
-  std::vector<uint8_t> buffer{};
+  const uint8_t* data{};
+  size_t byte_size{};
+
+  if (infer_result->RawData(output_name, &data, &byte_size).IsOk()) {
+    return {reinterpret_cast<const char*>(data), byte_size};
+  }
 
   const auto error{infer_result->RawData(output_name, buffer)};
 
@@ -255,7 +294,7 @@ RequestHandler::GetResponseBuffer(cb::InferResult* infer_result) const
     throw std::runtime_error(error.Message());
   }
 
-  return buffer;
+  return {reinterpret_cast<const char*>(buffer.data()), buffer.size()};
 }
 
 const std::vector<cb::InferInput*>
@@ -287,10 +326,4 @@ RequestHandler::PrepareInputs(const std::string& payload) const
   return {infer_input};
 }
 
-void
-RequestHandler::WaitForResponse(std::future<void>&& response_future) const
-{
-  response_future.get();
-}
-
 }  // namespace triton::perfanalyzer
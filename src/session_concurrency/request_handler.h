@@ -25,20 +25,22 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
-#include <rapidjson/document.h>
 #include <stddef.h>
 
 #include <chrono>
 #include <cstdint>
 #include <functional>
-#include <future>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "../client_backend/client_backend.h"
+#include "../coroutine_executor.h"
 #include "../model_parser.h"
+#include "../output_capture.h"
 #include "../request_record.h"
+#include "chat_history.h"
 #include "payload_dataset_manager.h"
 
 namespace triton::perfanalyzer {
@@ -50,9 +52,36 @@ class RequestHandler {
       const std::shared_ptr<ModelParser> parser,
       std::shared_ptr<PayloadDatasetManager> payload_dataset_manager);
 
-  void SendRequestAndWaitForResponse(
-      size_t dataset_index, rapidjson::Document& chat_history,
-      RequestRecord& request_record);
+  /// Send the request of the given payload from a coroutine, which is resumed
+  /// on the executor once its response has been recorded and added to the
+  /// chat history. The coroutine doesn't hold on to a thread while it waits.
+  /// Awaiting the request throws the error of the request or of its response,
+  /// if any.
+  /// \param executor The executor the coroutine is resumed on.
+  /// \param dataset_index The index of the payload in the dataset.
+  /// \param chat_history The chat history of the session, which the payload
+  /// is added to and the response message is appended to.
+  /// \param request_record Returns the record of the request.
+  /// \return The awaitable request.
+  CompletionAwaiter AsyncSendRequest(
+      CoroutineExecutor& executor, size_t dataset_index,
+      ChatHistory& chat_history, RequestRecord& request_record)
+  {
+    // The client backend sends the payload without copying it, so it is kept
+    // by the start of the awaiter until the response has arrived
+    return CompletionAwaiter{
+        executor,
+        [this, dataset_index, &chat_history, &request_record,
+         payload = std::string{}](CompletionAwaiter& awaiter) mutable {
+          PrepareAndSendRequest(
+              awaiter, dataset_index, chat_history, request_record, payload);
+        }};
+  }
+
+  void SetOutputCapture(const OutputCapture& output_capture)
+  {
+    output_capture_sampler_ = OutputCaptureSampler(output_capture);
+  }
 
  private:
   void RecordRequestInputs(
@@ -71,41 +100,51 @@ class RequestHandler {
       const std::chrono::milliseconds delay,
       RequestRecord::RequestInput& request_inputs) const;
 
+  void PrepareAndSendRequest(
+      CompletionAwaiter& awaiter, size_t dataset_index,
+      ChatHistory& chat_history, RequestRecord& request_record,
+      std::string& payload);
+
   void SendRequest(
-      const std::string& payload,
-      std::shared_ptr<std::promise<void>>&& response_promise,
-      rapidjson::Document& chat_history, RequestRecord& request_record);
+      const std::string& payload, CompletionAwaiter& awaiter,
+      ChatHistory& chat_history, RequestRecord& request_record,
+      const OutputCapturePolicy output_capture);
 
   const std::vector<const cb::InferRequestedOutput*> PrepareRequestedOutputs()
       const;
 
   const std::function<void(cb::InferResult*)> PrepareCallback(
-      std::shared_ptr<std::promise<void>>&& response_promise,
+      CompletionAwaiter& awaiter,
       const std::vector<const cb::InferRequestedOutput*>& requested_outputs,
-      RequestRecord& request_record, rapidjson::Document& chat_history) const;
+      RequestRecord& request_record, ChatHistory& chat_history,
+      const OutputCapturePolicy output_capture) const;
 
   void RecordResponse(
       cb::InferResult* infer_result,
       const std::vector<const cb::InferRequestedOutput*>& requested_outputs,
-      RequestRecord& request_record) const;
+      RequestRecord& request_record,
+      const OutputCapturePolicy output_capture) const;
 
   void RecordResponseOutputs(
       cb::InferResult* infer_result,
       const std::vector<const cb::InferRequestedOutput*>& requested_outputs,
-      RequestRecord::ResponseOutput& response_outputs) const;
+      RequestRecord::ResponseOutput& response_outputs,
+      const OutputCapturePolicy output_capture) const;
 
-  const std::vector<uint8_t> GetResponseBuffer(
-      cb::InferResult* infer_result) const;
+  // Returns the data of the output, which is borrowed from the result when the
+  // client backend supports it and is otherwise copied into `buffer`.
+  std::string_view GetOutputData(
+      cb::InferResult* infer_result, const std::string& output_name,
+      std::vector<uint8_t>& buffer) const;
 
   const std::vector<cb::InferInput*> PrepareInputs(
       const std::string& payload) const;
 
-  void WaitForResponse(std::future<void>&& response_future) const;
-
   std::unique_ptr<cb::ClientBackend> client_backend_{};
   std::shared_ptr<cb::ClientBackendFactory> factory_{};
   const std::shared_ptr<ModelParser> parser_{};
   std::shared_ptr<PayloadDatasetManager> payload_dataset_manager_{};
+  OutputCaptureSampler output_capture_sampler_{};
 };
 
 }  // namespace triton::perfanalyzer
@@ -31,6 +31,8 @@
 
 #include <cstdint>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "../rapidjson_utils.h"
@@ -41,18 +43,23 @@ const rapidjson::Document
 ResponseJsonUtils::GetResponseDocument(
     const std::vector<uint8_t>& response_buffer)
 {
-  rapidjson::Document response_document{};
+  return GetResponseDocument(std::string_view(
+      reinterpret_cast<const char*>(response_buffer.data()),
+      response_buffer.size()));
+}
 
-  const std::string response_buffer_str(
-      response_buffer.begin(), response_buffer.end());
+const rapidjson::Document
+ResponseJsonUtils::GetResponseDocument(std::string_view response)
+{
+  rapidjson::Document response_document{};
 
-  response_document.Parse(response_buffer_str.c_str(), response_buffer.size());
+  response_document.Parse(response.data(), response.size());
 
   if (response_document.HasParseError()) {
     throw std::runtime_error(
         "RapidJSON parse error " +
         std::to_string(response_document.GetParseError()) +
-        ". Review JSON for formatting errors:\n\n" + response_buffer_str +
+        ". Review JSON for formatting errors:\n\n" + std::string(response) +
         "\n\n\n");
   }
 
@@ -28,6 +28,7 @@
 #include <rapidjson/document.h>
 
 #include <cstdint>
+#include <string_view>
 #include <vector>
 
 namespace triton::perfanalyzer {
@@ -37,6 +38,9 @@ class ResponseJsonUtils {
   static const rapidjson::Document GetResponseDocument(
       const std::vector<uint8_t>& response_buffer);
 
+  static const rapidjson::Document GetResponseDocument(
+      std::string_view response);
+
   static const rapidjson::Value& GetMessage(
       const rapidjson::Document& response_document);
 };
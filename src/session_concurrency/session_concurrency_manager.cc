@@ -26,8 +26,6 @@
 
 #include "session_concurrency_manager.h"
 
-#include <rapidjson/document.h>
-#include <rapidjson/rapidjson.h>
 #include <stddef.h>
 
 #include <atomic>
@@ -39,15 +37,17 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
-#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "../client_backend/client_backend.h"
+#include "../coroutine_executor.h"
 #include "../load_manager.h"
 #include "../model_parser.h"
 #include "../perf_utils.h"
 #include "../request_record.h"
+#include "../request_record_store.h"
+#include "chat_history.h"
 #include "payload_dataset_manager.h"
 #include "request_handler.h"
 
@@ -72,24 +72,23 @@ SessionConcurrencyManager::SessionConcurrencyManager(
 {
 }
 
-std::vector<RequestRecord>
+RequestRecordStore
 SessionConcurrencyManager::Start()
 {
   const auto all_session_payloads{
       payload_dataset_manager_->GroupPayloadsBySession()};
-  MakeAndWaitForThreads(all_session_payloads);
+  request_handler_->SetOutputCapture(output_capture_);
+  SpawnAndWaitForSessions(all_session_payloads);
   return GetRequestRecords();
 }
 
 void
-SessionConcurrencyManager::MakeAndWaitForThreads(
+SessionConcurrencyManager::SpawnAndWaitForSessions(
     const std::vector<std::vector<size_t>>& all_session_payloads)
 {
-  if (!threads_.empty()) {
-    throw std::runtime_error("Expected threads_ to be empty.");
-  } else if (!all_threads_request_records_.empty()) {
+  if (!all_sessions_request_records_.empty()) {
     throw std::runtime_error(
-        "Expected all_threads_request_records_ to be empty.");
+        "Expected all_sessions_request_records_ to be empty.");
   } else if (all_session_payloads.size() < session_concurrency_) {
     throw std::runtime_error(
         "The input data file contains " +
@@ -101,25 +100,23 @@ SessionConcurrencyManager::MakeAndWaitForThreads(
         "session concurrency level.");
   }
 
-  all_threads_request_records_.resize(session_concurrency_);
+  all_sessions_request_records_.resize(session_concurrency_);
 
-  for (size_t i{0}; i < session_concurrency_; ++i) {
-    auto& request_records{all_threads_request_records_[i]};
+  CoroutineExecutor executor(max_threads_, [this]() { PinWorkerThread(); });
 
-    threads_.emplace_back(
-        &SessionConcurrencyManager::ProcessSessionsUntilComplete, this,
-        std::cref(all_session_payloads), std::ref(request_records));
+  for (auto& request_records : all_sessions_request_records_) {
+    executor.Spawn(ProcessSessionsUntilComplete(
+        executor, all_session_payloads, request_records));
   }
 
-  for (auto& thread : threads_) {
-    thread.join();
-  }
+  executor.Wait();
 }
 
-void
+Task
 SessionConcurrencyManager::ProcessSessionsUntilComplete(
+    CoroutineExecutor& executor,
     const std::vector<std::vector<size_t>>& all_session_payloads,
-    std::vector<RequestRecord>& request_records)
+    RequestRecordStore& request_records)
 {
   while (true) {
     const size_t session_index{next_session_index_++};
@@ -130,24 +127,28 @@ SessionConcurrencyManager::ProcessSessionsUntilComplete(
 
     const auto& one_session_payloads{all_session_payloads[session_index]};
 
-    SendSequentialRequestsForOneSession(one_session_payloads, request_records);
+    co_await SendSequentialRequestsForOneSession(
+        executor, one_session_payloads, request_records);
   }
 }
 
-void
+Task
 SessionConcurrencyManager::SendSequentialRequestsForOneSession(
+    CoroutineExecutor& executor,
     const std::vector<size_t>& one_session_payloads,
-    std::vector<RequestRecord>& request_records)
+    RequestRecordStore& request_records)
 {
-  rapidjson::Document chat_history(rapidjson::kArrayType);
+  ChatHistory chat_history{};
 
   for (size_t i{0}; i < one_session_payloads.size(); ++i) {
     const size_t payload_dataset_index{one_session_payloads[i]};
 
-    auto& request_record{request_records.emplace_back()};
+    RequestRecord request_record{};
 
-    request_handler_->SendRequestAndWaitForResponse(
-        payload_dataset_index, chat_history, request_record);
+    co_await request_handler_->AsyncSendRequest(
+        executor, payload_dataset_index, chat_history, request_record);
+
+    request_records.push_back(request_record);
 
     const bool is_last_request{i == one_session_payloads.size() - 1};
 
@@ -155,13 +156,12 @@ SessionConcurrencyManager::SendSequentialRequestsForOneSession(
       break;
     }
 
-    GetAndWaitForDelay(payload_dataset_index);
+    co_await executor.SleepFor(GetDelay(payload_dataset_index));
   }
 }
 
-void
-SessionConcurrencyManager::GetAndWaitForDelay(
-    size_t payload_dataset_index) const
+std::chrono::milliseconds
+SessionConcurrencyManager::GetDelay(size_t payload_dataset_index) const
 {
   const auto delay{payload_dataset_manager_->GetDelay(payload_dataset_index)};
 
@@ -171,18 +171,15 @@ SessionConcurrencyManager::GetAndWaitForDelay(
         std::to_string(payload_dataset_index));
   }
 
-  std::this_thread::sleep_for(*delay);
+  return *delay;
 }
 
-std::vector<RequestRecord>
-SessionConcurrencyManager::GetRequestRecords() const
+RequestRecordStore
+SessionConcurrencyManager::GetRequestRecords()
 {
-  std::vector<RequestRecord> request_records{};
-  for (const auto& one_thread_request_records : all_threads_request_records_) {
-    request_records.insert(
-        request_records.end(),
-        std::make_move_iterator(one_thread_request_records.begin()),
-        std::make_move_iterator(one_thread_request_records.end()));
+  RequestRecordStore request_records{};
+  for (auto& one_session_request_records : all_sessions_request_records_) {
+    request_records.Merge(std::move(one_session_request_records));
   }
   return request_records;
 }
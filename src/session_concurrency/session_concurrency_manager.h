@@ -28,6 +28,7 @@
 #include <stddef.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -35,15 +36,21 @@
 #include <vector>
 
 #include "../client_backend/client_backend.h"
+#include "../coroutine_executor.h"
 #include "../load_manager.h"
 #include "../model_parser.h"
 #include "../perf_utils.h"
 #include "../request_record.h"
+#include "../request_record_store.h"
 #include "payload_dataset_manager.h"
 #include "request_handler.h"
 
 namespace triton::perfanalyzer {
 
+/// Runs a fixed number of multi-turn chat sessions at a time. Each session is a
+/// coroutine that is suspended while its request is in flight and during the
+/// delay before its next turn, so a few threads drive any number of sessions.
+///
 class SessionConcurrencyManager : public LoadManager {
  public:
   SessionConcurrencyManager(
@@ -55,29 +62,31 @@ class SessionConcurrencyManager : public LoadManager {
           request_parameters,
       const size_t session_concurrency);
 
-  std::vector<RequestRecord> Start();
+  RequestRecordStore Start();
 
  private:
-  void MakeAndWaitForThreads(
+  void SpawnAndWaitForSessions(
       const std::vector<std::vector<size_t>>& all_session_payloads);
 
-  void ProcessSessionsUntilComplete(
+  Task ProcessSessionsUntilComplete(
+      CoroutineExecutor& executor,
       const std::vector<std::vector<size_t>>& all_session_payloads,
-      std::vector<RequestRecord>& request_records);
+      RequestRecordStore& request_records);
 
-  void SendSequentialRequestsForOneSession(
-      const std::vector<size_t>& session_payloads,
-      std::vector<RequestRecord>& request_records);
+  Task SendSequentialRequestsForOneSession(
+      CoroutineExecutor& executor, const std::vector<size_t>& session_payloads,
+      RequestRecordStore& request_records);
 
-  void GetAndWaitForDelay(size_t dataset_index) const;
+  std::chrono::milliseconds GetDelay(size_t dataset_index) const;
 
-  std::vector<RequestRecord> GetRequestRecords() const;
+  RequestRecordStore GetRequestRecords();
 
   const size_t session_concurrency_{};
   std::atomic<size_t> next_session_index_{};
   std::shared_ptr<PayloadDatasetManager> payload_dataset_manager_{};
   std::shared_ptr<RequestHandler> request_handler_{};
-  std::vector<std::vector<RequestRecord>> all_threads_request_records_{};
+  // The request records of each of the concurrent sessions
+  std::vector<RequestRecordStore> all_sessions_request_records_{};
 };
 
 }  // namespace triton::perfanalyzer
@@ -0,0 +1,180 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "binary_trace.h"
+#include "doctest.h"
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+std::string_view
+View(const TensorData& data)
+{
+  return std::string_view(
+      reinterpret_cast<const char*>(data.data_ptr), data.batch1_size);
+}
+
+uint64_t
+Uint64(const TensorData& data)
+{
+  REQUIRE(data.batch1_size == sizeof(uint64_t));
+  uint64_t value{};
+  std::memcpy(&value, data.data_ptr, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+TEST_CASE("BinaryTrace")
+{
+  const std::string path{
+      (std::filesystem::temp_directory_path() / "pa_test_binary_trace")
+          .string()};
+  const std::vector<BinaryTraceRecord> records{
+      {10, 3000, "session_a", R"({"model":"a"})"},
+      {20, std::nullopt, "session_a", R"({"model":"b"})"},
+      {30, 2000, std::nullopt, ""}};
+  const auto record_at{[&records](size_t i) { return records[i]; }};
+
+  SUBCASE("round trip")
+  {
+    BinaryTrace::Write(path, records.size(), record_at);
+    REQUIRE(BinaryTrace::IsBinaryTrace(path));
+
+    const BinaryTrace trace(path);
+    REQUIRE(trace.Size() == 3);
+    CHECK(trace.HasInput("payload"));
+    CHECK(trace.HasInput("timestamp"));
+    CHECK(trace.HasInput("delay"));
+    CHECK(trace.HasInput("session_id"));
+    CHECK_FALSE(trace.HasInput("INPUT0"));
+
+    CHECK(View(trace.GetInputData("payload", 0)) == R"({"model":"a"})");
+    CHECK(View(trace.GetInputData("payload", 1)) == R"({"model":"b"})");
+    const TensorData empty_payload{trace.GetInputData("payload", 2)};
+    CHECK(empty_payload.is_valid);
+    CHECK(empty_payload.batch1_size == 0);
+
+    CHECK(Uint64(trace.GetInputData("timestamp", 2)) == 30);
+    CHECK(Uint64(trace.GetInputData("delay", 0)) == 3000);
+    CHECK_FALSE(trace.GetInputData("delay", 1).is_valid);
+
+    // Session IDs keep the byte size prefix of a BYTES element
+    const TensorData session_id{trace.GetInputData("session_id", 1)};
+    REQUIRE(session_id.is_valid);
+    uint32_t size{};
+    std::memcpy(&size, session_id.data_ptr, sizeof(size));
+    CHECK(size == 9);
+    CHECK(View(session_id).substr(sizeof(size)) == "session_a");
+    CHECK_FALSE(trace.GetInputData("session_id", 2).is_valid);
+
+    CHECK_FALSE(trace.GetInputData("payload", 3).is_valid);
+  }
+
+  SUBCASE("columns without values are left out")
+  {
+    BinaryTrace::Write(path, 1, [](size_t) {
+      return BinaryTraceRecord{{}, {}, {}, "{}"};
+    });
+
+    const BinaryTrace trace(path);
+    CHECK(trace.Size() == 1);
+    CHECK(trace.HasInput("payload"));
+    CHECK_FALSE(trace.HasInput("timestamp"));
+    CHECK_FALSE(trace.HasInput("delay"));
+    CHECK_FALSE(trace.HasInput("session_id"));
+    CHECK(View(trace.GetInputData("payload", 0)) == "{}");
+    CHECK(std::filesystem::file_size(path) == sizeof(BinaryTrace::Header) +
+                                                  2 * sizeof(uint64_t) + 2);
+  }
+
+  SUBCASE("byte order")
+  {
+    BinaryTrace::Write(path, records.size(), record_at);
+    BinaryTrace::Header header{};
+    std::ifstream(path, std::ios::binary)
+        .read(reinterpret_cast<char*>(&header), sizeof(header));
+    CHECK(header.byte_order == BinaryTrace::kByteOrderMark);
+    CHECK(BinaryTrace(path).Size() == 3);
+
+    // The same header as written on a machine with the other byte order
+    header.version = __builtin_bswap32(header.version);
+    header.flags = __builtin_bswap32(header.flags);
+    header.byte_order = __builtin_bswap32(header.byte_order);
+    for (uint64_t* field :
+         {&header.count, &header.timestamps_offset, &header.delays_offset,
+          &header.session_ids_offset, &header.payloads_offset,
+          &header.blob_offset, &header.blob_size}) {
+      *field = __builtin_bswap64(*field);
+    }
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.close();
+
+    CHECK(BinaryTrace::IsBinaryTrace(path));
+    const std::string swapped{
+        "Binary trace '" + path +
+        "' was written on a machine with the other byte order."};
+    CHECK_THROWS_WITH_AS(
+        BinaryTrace{path}, swapped.c_str(), std::runtime_error);
+  }
+
+  SUBCASE("invalid files")
+  {
+    const std::string missing{"Failed to open binary trace '" + path + "'."};
+    CHECK_FALSE(BinaryTrace::IsBinaryTrace(path));
+    CHECK_THROWS_WITH_AS(
+        BinaryTrace{path}, missing.c_str(), std::runtime_error);
+
+    std::ofstream(path) << R"({"data": []})";
+    CHECK_FALSE(BinaryTrace::IsBinaryTrace(path));
+    const std::string not_trace{"'" + path + "' is not a binary trace."};
+    CHECK_THROWS_WITH_AS(
+        BinaryTrace{path}, not_trace.c_str(), std::runtime_error);
+
+    BinaryTrace::Write(path, records.size(), record_at);
+    std::filesystem::resize_file(
+        path, std::filesystem::file_size(path) - 1);
+    const std::string truncated{
+        "Binary trace '" + path + "' is truncated or corrupt."};
+    CHECK_THROWS_WITH_AS(
+        BinaryTrace{path}, truncated.c_str(), std::runtime_error);
+  }
+
+  std::filesystem::remove(path);
+}
+
+}}  // namespace triton::perfanalyzer
@@ -70,6 +70,8 @@ CHECK_PARAMS(PAParamsPtr act, PAParamsPtr exp)
   CHECK(act->max_threads_specified == exp->max_threads_specified);
   CHECK(act->sequence_length == exp->sequence_length);
   CHECK(act->percentile == exp->percentile);
+  CHECK(
+      act->latency_histogram_precision == exp->latency_histogram_precision);
   REQUIRE(act->user_data.size() == exp->user_data.size());
   for (size_t i = 0; i < act->user_data.size(); i++) {
     CHECK_STRING(act->user_data[i], exp->user_data[i]);
@@ -111,8 +113,28 @@ CHECK_PARAMS(PAParamsPtr act, PAParamsPtr exp)
       doctest::Approx(exp->request_rate_range[2]));
   CHECK(act->num_of_sequences == exp->num_of_sequences);
   CHECK(act->search_mode == exp->search_mode);
+  CHECK(act->goodput_slo.percentile == exp->goodput_slo.percentile);
+  CHECK(
+      act->goodput_slo.latency_limit_ns == exp->goodput_slo.latency_limit_ns);
+  CHECK(act->goodput_slo.max_error_rate == exp->goodput_slo.max_error_rate);
   CHECK(act->request_distribution == exp->request_distribution);
+  CHECK(
+      act->request_distribution_params.cv ==
+      doctest::Approx(exp->request_distribution_params.cv));
+  CHECK(
+      act->request_distribution_params.pareto_alpha ==
+      doctest::Approx(exp->request_distribution_params.pareto_alpha));
+  CHECK(
+      act->request_distribution_params.burst_ratio ==
+      doctest::Approx(exp->request_distribution_params.burst_ratio));
+  CHECK(
+      act->request_distribution_params.burst_fraction ==
+      doctest::Approx(exp->request_distribution_params.burst_fraction));
+  CHECK(
+      act->request_distribution_params.burst_ms ==
+      doctest::Approx(exp->request_distribution_params.burst_ms));
   CHECK_STRING(act->request_intervals_file, exp->request_intervals_file);
+  CHECK_STRING(act->request_rate_curve, exp->request_rate_curve);
   CHECK(act->shared_memory_type == exp->shared_memory_type);
   CHECK(act->output_shm_size == exp->output_shm_size);
   CHECK(act->kind == exp->kind);
@@ -180,6 +202,18 @@ CHECK_PARAMS(PAParamsPtr act, PAParamsPtr exp)
       act->periodic_concurrency_range.step ==
       exp->periodic_concurrency_range.step);
   CHECK(act->request_period == exp->request_period);
+  CHECK(act->output_capture.policy == exp->output_capture.policy);
+  CHECK(act->output_capture.sample_rate == exp->output_capture.sample_rate);
+  CHECK(act->request_pacing.strategy == exp->request_pacing.strategy);
+  CHECK(act->request_pacing.slack == exp->request_pacing.slack);
+  CHECK(act->request_pacing.dispatch == exp->request_pacing.dispatch);
+  CHECK(act->concurrency_engine == exp->concurrency_engine);
+  CHECK(act->worker_cpus == exp->worker_cpus);
+  CHECK(act->completion_cpus == exp->completion_cpus);
+  CHECK(act->transfer_shards == exp->transfer_shards);
+  CHECK(act->max_connections == exp->max_connections);
+  CHECK(act->profiler_cpus == exp->profiler_cpus);
+  CHECK_STRING(act->convert_input_data, exp->convert_input_data);
   CHECK(act->request_parameters.size() == exp->request_parameters.size());
   for (auto act_param : act->request_parameters) {
     auto exp_param = exp->request_parameters.find(act_param.first);
@@ -759,6 +793,37 @@ TEST_CASE("Testing Command Line Parser")
     }
   }
 
+  SUBCASE("Option : --latency-histogram-precision")
+  {
+    SUBCASE("set to 2")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--latency-histogram-precision", "2"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->latency_histogram_precision = 2;
+    }
+
+    SUBCASE("set to 6 - out of range")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--latency-histogram-precision", "6"};
+
+      expected_msg = CreateUsageMessage(
+          "--latency-histogram-precision",
+          "The value must be in range [1, 5].");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+
+      check_params = false;
+    }
+  }
+
   SUBCASE("Option : --data-directory")
   {
     SUBCASE("set to `/usr/data`")
@@ -1251,6 +1316,90 @@ TEST_CASE("Testing Command Line Parser")
       exp->concurrency_range.end = concurrency_range_end;
       exp->max_threads = exp->concurrency_range.end;
     }
+
+    SUBCASE(
+        "Max_threads set to default with the event-loop engine when "
+        "concurrency-range.end > 16")
+    {
+      concurrency_range_end = 1000;
+      std::string concurrency_range_str =
+          std::to_string(concurrency_range_start) + ":" +
+          std::to_string(concurrency_range_end);
+      args.push_back(option_name);
+      args.push_back(concurrency_range_str.data());
+      args.push_back("--concurrency-engine");
+      args.push_back("event-loop");
+      args.push_back("--async");
+
+      int argc = args.size();
+      char* argv[argc];
+      std::copy(args.begin(), args.end(), argv);
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->concurrency_range.start = concurrency_range_start;
+      exp->concurrency_range.end = concurrency_range_end;
+      exp->concurrency_engine = ConcurrencyEngine::EventLoop;
+      exp->async = true;
+      exp->max_threads = DEFAULT_MAX_THREADS;
+    }
+
+    SUBCASE(
+        "Max_threads set to default with the event-loop engine and "
+        "streaming")
+    {
+      concurrency_range_end = 1000;
+      std::string concurrency_range_str =
+          std::to_string(concurrency_range_start) + ":" +
+          std::to_string(concurrency_range_end);
+      args.push_back(option_name);
+      args.push_back(concurrency_range_str.data());
+      args.push_back("--concurrency-engine");
+      args.push_back("event-loop");
+      args.push_back("-i");
+      args.push_back("grpc");
+      args.push_back("--streaming");
+
+      int argc = args.size();
+      char* argv[argc];
+      std::copy(args.begin(), args.end(), argv);
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->concurrency_range.start = concurrency_range_start;
+      exp->concurrency_range.end = concurrency_range_end;
+      exp->concurrency_engine = ConcurrencyEngine::EventLoop;
+      exp->protocol = cb::ProtocolType::GRPC;
+      exp->streaming = true;
+      exp->url = "localhost:8001";  // gRPC url
+      exp->max_threads = DEFAULT_MAX_THREADS;
+    }
+
+    SUBCASE("Event-loop engine rejected with the synchronous API")
+    {
+      concurrency_range_end = 1000;
+      std::string concurrency_range_str =
+          std::to_string(concurrency_range_start) + ":" +
+          std::to_string(concurrency_range_end);
+      args.push_back(option_name);
+      args.push_back(concurrency_range_str.data());
+      args.push_back("--concurrency-engine");
+      args.push_back("event-loop");
+
+      int argc = args.size();
+      char* argv[argc];
+      std::copy(args.begin(), args.end(), argv);
+
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv),
+          "The --concurrency-engine=event-loop option requires --async or "
+          "--streaming.",
+          PerfAnalyzerException);
+
+      check_params = false;
+    }
   }
 
   SUBCASE("Option : --periodic-concurrency-range")
@@ -1962,6 +2111,721 @@ TEST_CASE("Testing Command Line Parser")
     }
   }
 
+  SUBCASE("Option : --output-capture")
+  {
+    SUBCASE("hash")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--output-capture", "hash"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->output_capture.policy = OutputCapturePolicy::Hash;
+    }
+    SUBCASE("sampled with sample rate")
+    {
+      int argc = 7;
+      char* argv[argc] = {app_name,
+                          "-m",
+                          model_name,
+                          "--output-capture",
+                          "sampled",
+                          "--output-capture-sample-rate",
+                          "100"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->output_capture.policy = OutputCapturePolicy::Sampled;
+      exp->output_capture.sample_rate = 100;
+    }
+    SUBCASE("unsupported type")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--output-capture", "partial"};
+
+      expected_msg = CreateUsageMessage(
+          "--output-capture",
+          "Unsupported type provided: 'partial'. Choices are 'none', 'hash', "
+          "'sampled' or 'full'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("zero sample rate")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--output-capture-sample-rate", "0"};
+
+      expected_msg = CreateUsageMessage(
+          "--output-capture-sample-rate", "The value must be > 0.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --request-pacing")
+  {
+    SUBCASE("hybrid with slack")
+    {
+      int argc = 7;
+      char* argv[argc] = {app_name,
+                          "-m",
+                          model_name,
+                          "--request-pacing",
+                          "hybrid",
+                          "--request-pacing-slack",
+                          "250"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_pacing.strategy = PacingStrategy::Hybrid;
+      exp->request_pacing.slack = std::chrono::microseconds(250);
+    }
+    SUBCASE("deadline")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-pacing", "deadline"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_pacing.strategy = PacingStrategy::Deadline;
+    }
+    SUBCASE("batched")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-pacing", "batched"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_pacing.strategy = PacingStrategy::Batched;
+    }
+    SUBCASE("unsupported type")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-pacing", "busy"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-pacing",
+          "Unsupported type provided: 'busy'. Choices are 'sleep', 'hybrid', "
+          "'deadline' or 'batched'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("negative slack")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-pacing-slack", "-1"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-pacing-slack", "The value must be >= 0.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --request-dispatch")
+  {
+    SUBCASE("timing-wheel")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-dispatch", "timing-wheel"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_pacing.dispatch = RequestDispatch::TimingWheel;
+    }
+    SUBCASE("worker")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-dispatch", "worker"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_pacing.dispatch = RequestDispatch::PerWorker;
+    }
+    SUBCASE("unsupported type")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-dispatch", "heap"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-dispatch",
+          "Unsupported type provided: 'heap'. Choices are 'worker' or "
+          "'timing-wheel'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --concurrency-engine")
+  {
+    SUBCASE("event-loop")
+    {
+      int argc = 6;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--async", "--concurrency-engine",
+          "event-loop"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->async = true;
+      exp->concurrency_engine = ConcurrencyEngine::EventLoop;
+    }
+    SUBCASE("threaded")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--concurrency-engine", "threaded"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->concurrency_engine = ConcurrencyEngine::Threaded;
+    }
+    SUBCASE("unsupported type")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--concurrency-engine", "epoll"};
+
+      expected_msg = CreateUsageMessage(
+          "--concurrency-engine",
+          "Unsupported type provided: 'epoll'. Choices are 'threaded' or "
+          "'event-loop'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --worker-cpus")
+  {
+    // Use a CPU this process is allowed to run on
+    std::string cpu{
+        std::to_string(cb::CpuAffinity::Current().Cpus().front())};
+
+    SUBCASE("cpu list")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--worker-cpus", cpu.data()};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->worker_cpus = cb::CpuAffinity::Parse(cpu);
+    }
+    SUBCASE("decreasing range")
+    {
+      int argc = 5;
+      char* argv[argc] = {app_name, "-m", model_name, "--worker-cpus", "3-1"};
+
+      expected_msg = CreateUsageMessage(
+          "--worker-cpus",
+          "Invalid CPU range '3-1'. The range must not decrease.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --completion-cpus")
+  {
+    std::string cpu{
+        std::to_string(cb::CpuAffinity::Current().Cpus().front())};
+    int argc = 5;
+    char* argv[argc] = {
+        app_name, "-m", model_name, "--completion-cpus", cpu.data()};
+
+    REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+    CHECK(!parser.UsageCalled());
+
+    exp->completion_cpus = cb::CpuAffinity::Parse(cpu);
+  }
+
+  SUBCASE("Option : --fixed-schedule-*")
+  {
+    SUBCASE("without --fixed-schedule")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--fixed-schedule-speedup", "4"};
+
+      expected_msg =
+          "The --fixed-schedule-trace, --fixed-schedule-time-unit, "
+          "--fixed-schedule-speedup and --fixed-schedule-window options "
+          "require --fixed-schedule.";
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("unsupported time unit")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--fixed-schedule-time-unit", "ns"};
+
+      expected_msg = CreateUsageMessage(
+          "--fixed-schedule-time-unit",
+          "Unsupported type provided: 'ns'. Choices are 'ms' or 'us'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("speedup of zero")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--fixed-schedule-speedup", "0"};
+
+      expected_msg = CreateUsageMessage(
+          "--fixed-schedule-speedup", "The value must be > 0.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("window that ends before it starts")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--fixed-schedule-window", "20:10"};
+
+      expected_msg = CreateUsageMessage(
+          "--fixed-schedule-window",
+          "Invalid window '20:10'. The end must be after the start.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --convert-input-data")
+  {
+    int argc = 5;
+    char* argv[argc] = {
+        app_name, "-m", model_name, "--convert-input-data", "trace.patrace"};
+
+    expected_msg =
+        "The --convert-input-data option is only supported with OpenAI "
+        "service kind.";
+    CHECK_THROWS_WITH_AS(
+        act = parser.Parse(argc, argv), expected_msg.c_str(),
+        PerfAnalyzerException);
+    check_params = false;
+  }
+
+  SUBCASE("Option : --transfer-shards")
+  {
+    SUBCASE("zero shards")
+    {
+      int argc = 5;
+      char* argv[argc] = {app_name, "-m", model_name, "--transfer-shards", "0"};
+
+      expected_msg =
+          CreateUsageMessage("--transfer-shards", "The value must be > 0.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("without OpenAI service kind")
+    {
+      int argc = 5;
+      char* argv[argc] = {app_name, "-m", model_name, "--transfer-shards", "4"};
+
+      expected_msg =
+          "The --transfer-shards option is only supported with OpenAI service "
+          "kind.";
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --max-connections")
+  {
+    SUBCASE("zero connections")
+    {
+      int argc = 5;
+      char* argv[argc] = {app_name, "-m", model_name, "--max-connections", "0"};
+
+      expected_msg =
+          CreateUsageMessage("--max-connections", "The value must be > 0.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("without OpenAI service kind")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--max-connections", "16"};
+
+      expected_msg =
+          "The --max-connections option is only supported with OpenAI service "
+          "kind.";
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --profiler-cpus")
+  {
+    int argc = 5;
+    char* argv[argc] = {app_name, "-m", model_name, "--profiler-cpus", "first"};
+
+    expected_msg =
+        CreateUsageMessage("--profiler-cpus", "Invalid CPU list 'first'.");
+    CHECK_THROWS_WITH_AS(
+        act = parser.Parse(argc, argv), expected_msg.c_str(),
+        PerfAnalyzerException);
+    check_params = false;
+  }
+
+  SUBCASE("Option : --request-distribution")
+  {
+    SUBCASE("poisson")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution", "poisson"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_distribution = Distribution::POISSON;
+    }
+    SUBCASE("gamma with default shape")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution", "gamma"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_distribution = Distribution::GAMMA;
+    }
+    SUBCASE("lognormal with cv")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution",
+          "lognormal:cv=2.5"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_distribution = Distribution::LOGNORMAL;
+      exp->request_distribution_params.cv = 2.5;
+    }
+    SUBCASE("pareto with alpha")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution",
+          "pareto:alpha=1.5"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_distribution = Distribution::PARETO;
+      exp->request_distribution_params.pareto_alpha = 1.5;
+    }
+    SUBCASE("mmpp with all shape parameters")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution",
+          "mmpp:ratio=20,fraction=0.05,burst_ms=100"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->request_distribution = Distribution::MMPP;
+      exp->request_distribution_params.burst_ratio = 20;
+      exp->request_distribution_params.burst_fraction = 0.05;
+      exp->request_distribution_params.burst_ms = 100;
+    }
+    SUBCASE("unsupported type")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution", "weibull"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-distribution",
+          "Unsupported type provided: 'weibull'. Choices are 'poisson', "
+          "'constant', 'gamma', 'mmpp', 'lognormal' or 'pareto'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("unsupported shape parameter")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution",
+          "poisson:cv=2"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-distribution",
+          "Unsupported shape parameter for 'poisson': 'cv'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("malformed shape parameter")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution", "gamma:cv"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-distribution",
+          "The shape parameter 'cv' does not match <key=value>.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("pareto alpha too small")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution",
+          "pareto:alpha=1"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-distribution", "The alpha must be > 1.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("mmpp fraction out of range")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-distribution",
+          "mmpp:fraction=1"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-distribution", "The fraction must be > 0 and < 1.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --goodput-slo")
+  {
+    SUBCASE("with request rate range")
+    {
+      int argc = 7;
+      char* argv[argc] = {app_name,
+                          "-m",
+                          model_name,
+                          "--request-rate-range",
+                          "100:0:10",
+                          "--goodput-slo",
+                          "p99=250,error-rate=0.01"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->inference_load_mode = InferenceLoadMode::RequestRate;
+      exp->max_threads = 4;
+      exp->request_rate_range[SEARCH_RANGE::kSTART] = 100;
+      exp->request_rate_range[SEARCH_RANGE::kEND] = 0;
+      exp->request_rate_range[SEARCH_RANGE::kSTEP] = 10;
+      exp->search_mode = SearchMode::GOODPUT;
+      exp->goodput_slo.percentile = 99;
+      exp->goodput_slo.latency_limit_ns = 250 * NANOS_PER_MILLIS;
+      exp->goodput_slo.max_error_rate = 0.01;
+    }
+    SUBCASE("invalid SLO")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--goodput-slo", "error-rate=0.01"};
+
+      expected_msg = CreateUsageMessage(
+          "--goodput-slo",
+          "The SLO requires a latency limit 'p<percentile>=<milliseconds>'.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("with binary search")
+    {
+      int argc = 6;
+      char* argv[argc] = {app_name,          "-m",
+                          model_name,        "--binary-search",
+                          "--goodput-slo",   "p99=250"};
+
+      expected_msg = "Cannot use both --binary-search and --goodput-slo.";
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("with a load curve")
+    {
+      int argc = 7;
+      char* argv[argc] = {app_name,
+                          "-m",
+                          model_name,
+                          "--request-rate-curve",
+                          "linear:0=10,10=30",
+                          "--goodput-slo",
+                          "p99=250"};
+
+      expected_msg =
+          "The --goodput-slo option requires --concurrency-range or "
+          "--request-rate-range.";
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
+  SUBCASE("Option : --request-rate-curve")
+  {
+    SUBCASE("linear")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-rate-curve",
+          "linear:0=10,10=30"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->inference_load_mode = InferenceLoadMode::RequestRate;
+      exp->max_threads = 4;
+      exp->request_rate_curve = "linear:0=10,10=30";
+      exp->request_rate_range[SEARCH_RANGE::kSTART] = 20;
+      exp->request_rate_range[SEARCH_RANGE::kEND] = 20;
+      exp->request_count = 200;
+      exp->measurement_mode = MeasurementMode::COUNT_WINDOWS;
+      exp->measurement_request_count = 200;
+    }
+    SUBCASE("sine with request count")
+    {
+      int argc = 7;
+      char* argv[argc] = {
+          app_name,
+          "-m",
+          model_name,
+          "--request-rate-curve",
+          "sine:base=100,amplitude=50,period=10,duration=20",
+          "--request-count",
+          "500"};
+
+      REQUIRE_NOTHROW(act = parser.Parse(argc, argv));
+      CHECK(!parser.UsageCalled());
+
+      exp->inference_load_mode = InferenceLoadMode::RequestRate;
+      exp->max_threads = 4;
+      exp->request_rate_curve =
+          "sine:base=100,amplitude=50,period=10,duration=20";
+      exp->request_rate_range[SEARCH_RANGE::kSTART] = 100;
+      exp->request_rate_range[SEARCH_RANGE::kEND] = 100;
+      exp->request_count = 500;
+      exp->measurement_mode = MeasurementMode::COUNT_WINDOWS;
+      exp->measurement_request_count = 500;
+    }
+    SUBCASE("invalid curve")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-rate-curve",
+          "linear:0=10,10=0"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-rate-curve", "The rates must be > 0.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("shorter than a second")
+    {
+      int argc = 5;
+      char* argv[argc] = {
+          app_name, "-m", model_name, "--request-rate-curve",
+          "linear:0=10,0.5=10"};
+
+      expected_msg = CreateUsageMessage(
+          "--request-rate-curve", "The duration must be >= 1 second.");
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+    SUBCASE("with request rate range")
+    {
+      int argc = 7;
+      char* argv[argc] = {
+          app_name,
+          "-m",
+          model_name,
+          "--request-rate-range",
+          "10",
+          "--request-rate-curve",
+          "linear:0=10,10=30"};
+
+      expected_msg = "Cannot use both RequestRate and --request-rate-curve.";
+      CHECK_THROWS_WITH_AS(
+          act = parser.Parse(argc, argv), expected_msg.c_str(),
+          PerfAnalyzerException);
+      check_params = false;
+    }
+  }
+
   SUBCASE("Option : --grpc-method")
   {
     SUBCASE("correct full grpc method name")
@@ -137,6 +137,25 @@ class TestConcurrencyManager : public TestLoadManagerBase,
     CheckConcurrency();
   }
 
+  /// Test that the concurrency follows each of the given levels in turn
+  ///
+  void TestConcurrencyChanges(const std::vector<size_t>& concurrencies)
+  {
+    stats_->SetDelays({50});
+
+    for (size_t concurrency : concurrencies) {
+      ChangeConcurrencyLevel(concurrency);
+      std::this_thread::sleep_for(std::chrono::milliseconds(225));
+
+      CHECK(
+          stats_->num_active_infer_calls ==
+          doctest::Approx(concurrency).epsilon(0.25));
+    }
+    CHECK(threads_.size() <= max_threads_);
+
+    StopWorkerThreads();
+  }
+
   /// Test sequence handling
   ///
   void TestSequences()
@@ -415,15 +434,94 @@ TEST_CASE("concurrency_concurrency")
   tcm.TestConcurrency(response_delay, sleep_time);
 }
 
+/// Test that the event loop engine keeps many times more requests in flight
+/// than it has threads, and follows the concurrency both up and down while
+/// requests are in flight
+///
+TEST_CASE("concurrency_event_loop")
+{
+  PerfAnalyzerParameters params{};
+  params.async = true;
+  params.concurrency_range = {64, 64, 1};
+  params.max_threads = 2;
+
+  SUBCASE("no-streaming")
+  {
+    params.streaming = false;
+  }
+  SUBCASE("streaming")
+  {
+    params.streaming = true;
+  }
+
+  TestConcurrencyManager tcm(params);
+  tcm.SetConcurrencyEngine(ConcurrencyEngine::EventLoop);
+
+  tcm.InitManager(
+      params.string_length, params.string_data, params.zero_input,
+      params.user_data, params.start_sequence_id, params.sequence_id_range,
+      params.sequence_length, params.sequence_length_specified,
+      params.sequence_length_variation);
+
+  tcm.TestConcurrencyChanges({64, 16, 48});
+}
+
+/// Test that sync workers fall back to the threaded loop with the event loop
+/// engine, so a sync run past the default of 16 threads gets a thread for
+/// every concurrent request
+///
+TEST_CASE("concurrency_event_loop_sync")
+{
+  PerfAnalyzerParameters params{};
+  params.forced_sync = true;
+  params.async = false;
+  params.concurrency_range = {24, 24, 1};
+  params.max_threads = 24;
+
+  std::vector<ThreadConfig> expected_configs;
+  for (size_t i = 0; i < params.max_threads; i++) {
+    ThreadConfig tc(i);
+    tc.concurrency_ = 1;
+    tc.seq_stat_index_offset_ = i;
+    tc.num_requests_ = 0;
+    expected_configs.push_back(tc);
+  }
+
+  TestConcurrencyManager tcm(params);
+  tcm.SetConcurrencyEngine(ConcurrencyEngine::EventLoop);
+
+  tcm.InitManager(
+      params.string_length, params.string_data, params.zero_input,
+      params.user_data, params.start_sequence_id, params.sequence_id_range,
+      params.sequence_length, params.sequence_length_specified,
+      params.sequence_length_variation);
+
+  tcm.TestReconfigThreads(24, 0, expected_configs);
+  tcm.TestConcurrency(50, std::chrono::milliseconds(225));
+}
+
 /// Check that the inference requests for sequences follow all rules and
 /// parameters
 ///
 TEST_CASE("concurrency_sequence")
 {
-  PerfAnalyzerParameters params = TestLoadManagerBase::GetSequenceTestParams();
+  PerfAnalyzerParameters params{};
   const bool is_sequence_model{true};
+  ConcurrencyEngine engine{ConcurrencyEngine::Threaded};
+
+  SUBCASE("threaded")
+  {
+    engine = ConcurrencyEngine::Threaded;
+    params = TestLoadManagerBase::GetSequenceTestParams();
+  }
+  SUBCASE("event loop")
+  {
+    engine = ConcurrencyEngine::EventLoop;
+    params = TestLoadManagerBase::GetSequenceTestParams();
+  }
 
   TestConcurrencyManager tcm(params, is_sequence_model);
+  tcm.SetConcurrencyEngine(engine);
 
   tcm.InitManager(
       params.string_length, params.string_data, params.zero_input,
@@ -785,10 +883,22 @@ TEST_CASE("concurrency_deadlock")
   }};
 
 
-  ParameterizeDelays();
+  ConcurrencyEngine engine{ConcurrencyEngine::Threaded};
+
+  SUBCASE("threaded")
+  {
+    engine = ConcurrencyEngine::Threaded;
+    ParameterizeDelays();
+  }
+  SUBCASE("event loop")
+  {
+    engine = ConcurrencyEngine::EventLoop;
+    ParameterizeDelays();
+  }
 
 
   TestConcurrencyManager tcm(params, is_sequence_model);
+  tcm.SetConcurrencyEngine(engine);
 
   tcm.InitManager(
       params.string_length, params.string_data, params.zero_input,
@@ -0,0 +1,296 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "coroutine_executor.h"
+#include "doctest.h"
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+Task
+SleepAndCount(
+    CoroutineExecutor& executor, milliseconds duration,
+    std::atomic<size_t>& count)
+{
+  co_await executor.SleepFor(duration);
+  count++;
+}
+
+Task
+AppendAt(
+    CoroutineExecutor& executor, steady_clock::time_point deadline, int value,
+    std::vector<int>& values)
+{
+  co_await executor.SleepUntil(deadline);
+  values.push_back(value);
+}
+
+Task
+Fail()
+{
+  throw std::runtime_error("task failed");
+  co_return;
+}
+
+Task
+FailAfter(CoroutineExecutor& executor, milliseconds duration)
+{
+  co_await executor.SleepFor(duration);
+  throw std::runtime_error("session failed");
+}
+
+Task
+AwaitChildren(std::vector<int>& steps)
+{
+  steps.push_back(1);
+  co_await [&steps]() -> Task {
+    steps.push_back(2);
+    co_return;
+  }();
+  steps.push_back(3);
+  bool caught{false};
+  try {
+    co_await Fail();
+  }
+  catch (const std::runtime_error&) {
+    caught = true;
+  }
+  CHECK(caught);
+  steps.push_back(4);
+}
+
+// Suspends until another thread resumes it, like a backend callback
+struct ExternalCompletion {
+  CoroutineExecutor& executor;
+  std::thread& completer;
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    completer = std::thread([this, handle]() {
+      std::this_thread::sleep_for(milliseconds(5));
+      executor.Post(handle);
+    });
+  }
+  void await_resume() const noexcept {}
+};
+
+Task
+AwaitExternal(
+    CoroutineExecutor& executor, std::thread& completer, bool& resumed)
+{
+  co_await ExternalCompletion{executor, completer};
+  resumed = true;
+}
+
+Task
+AwaitCompletion(
+    CoroutineExecutor& executor,
+    std::function<void(CompletionAwaiter&)> start, bool& resumed)
+{
+  co_await CompletionAwaiter{executor, std::move(start)};
+  resumed = true;
+}
+
+}  // namespace
+
+TEST_CASE("coroutine_executor: many sleeping tasks share a few threads")
+{
+  const size_t num_tasks{5000};
+  std::atomic<size_t> count{0};
+  CoroutineExecutor executor{2};
+
+  const auto start{steady_clock::now()};
+  for (size_t i = 0; i < num_tasks; i++) {
+    executor.Spawn(SleepAndCount(executor, milliseconds(50), count));
+  }
+  executor.Wait();
+  const auto elapsed{steady_clock::now() - start};
+
+  CHECK(count == num_tasks);
+  CHECK(executor.NumPendingTasks() == 0);
+  // The tasks sleep at the same time instead of one after another
+  CHECK(elapsed >= milliseconds(50));
+  CHECK(elapsed < milliseconds(1000));
+}
+
+TEST_CASE("coroutine_executor: timers resume in deadline order")
+{
+  std::vector<int> values{};
+  CoroutineExecutor executor{1};
+
+  const auto origin{steady_clock::now() + milliseconds(20)};
+  executor.Spawn(AppendAt(executor, origin + milliseconds(30), 3, values));
+  executor.Spawn(AppendAt(executor, origin + milliseconds(10), 1, values));
+  executor.Spawn(AppendAt(executor, origin + milliseconds(20), 2, values));
+  executor.Spawn(AppendAt(executor, origin + milliseconds(10), 4, values));
+  executor.Wait();
+
+  CHECK(values == std::vector<int>{1, 4, 2, 3});
+}
+
+TEST_CASE("coroutine_executor: tasks await other tasks")
+{
+  std::vector<int> steps{};
+  CoroutineExecutor executor{1};
+
+  executor.Spawn(AwaitChildren(steps));
+  executor.Wait();
+
+  CHECK(steps == std::vector<int>{1, 2, 3, 4});
+}
+
+TEST_CASE("coroutine_executor: Wait rethrows the exception of a task")
+{
+  CoroutineExecutor executor{2};
+
+  executor.Spawn(Fail());
+  CHECK_THROWS_WITH_AS(executor.Wait(), "task failed", std::runtime_error);
+
+  // The exception is only reported once
+  CHECK_NOTHROW(executor.Wait());
+}
+
+TEST_CASE("coroutine_executor: Wait returns the first error right away")
+{
+  std::atomic<size_t> count{0};
+  CoroutineExecutor executor{2};
+
+  const auto start{steady_clock::now()};
+  for (size_t i = 0; i < 8; i++) {
+    executor.Spawn(SleepAndCount(executor, milliseconds(10000), count));
+  }
+  executor.Spawn(FailAfter(executor, milliseconds(10)));
+  CHECK_THROWS_WITH_AS(executor.Wait(), "session failed", std::runtime_error);
+
+  // Tasks spawned after the failure don't run
+  executor.Spawn(SleepAndCount(executor, milliseconds(0), count));
+  CHECK(executor.Failed());
+
+  // The sleeping tasks are stopped instead of finishing their sleep
+  while (executor.NumPendingTasks() != 0) {
+    std::this_thread::sleep_for(milliseconds(1));
+  }
+  CHECK(steady_clock::now() - start < milliseconds(5000));
+  CHECK(count == 0);
+}
+
+TEST_CASE("coroutine_executor: coroutines are resumed from other threads")
+{
+  std::thread completer{};
+  bool resumed{false};
+  CoroutineExecutor executor{1};
+
+  executor.Spawn(AwaitExternal(executor, completer, resumed));
+  executor.Wait();
+  completer.join();
+
+  CHECK(resumed);
+}
+
+TEST_CASE("coroutine_executor: CompletionAwaiter waits for the completion")
+{
+  std::thread completer{};
+  std::function<void(CompletionAwaiter&)> start{};
+  bool resumed{false};
+
+  SUBCASE("not started")
+  {
+    start = [](CompletionAwaiter&) {};
+  }
+  SUBCASE("completed during the start")
+  {
+    start = [](CompletionAwaiter& awaiter) {
+      awaiter.Complete();
+      awaiter.Started();
+    };
+  }
+  SUBCASE("completed from another thread")
+  {
+    start = [&completer](CompletionAwaiter& awaiter) {
+      awaiter.Started();
+      completer = std::thread([&awaiter]() {
+        std::this_thread::sleep_for(milliseconds(5));
+        awaiter.Complete();
+      });
+    };
+  }
+
+  CoroutineExecutor executor{1};
+  executor.Spawn(AwaitCompletion(executor, start, resumed));
+  executor.Wait();
+  if (completer.joinable()) {
+    completer.join();
+  }
+
+  CHECK(resumed);
+}
+
+TEST_CASE("coroutine_executor: CompletionAwaiter rethrows the error")
+{
+  bool resumed{false};
+  CoroutineExecutor executor{1};
+
+  executor.Spawn(AwaitCompletion(
+      executor,
+      [](CompletionAwaiter& awaiter) {
+        awaiter.Started();
+        awaiter.Complete(
+            std::make_exception_ptr(std::runtime_error("request failed")));
+      },
+      resumed));
+  CHECK_THROWS_WITH_AS(executor.Wait(), "request failed", std::runtime_error);
+  CHECK(!resumed);
+}
+
+TEST_CASE("coroutine_executor: each thread starts with on_thread_start")
+{
+  std::atomic<size_t> num_started{0};
+  std::atomic<size_t> count{0};
+  {
+    CoroutineExecutor executor{3, [&num_started]() { num_started++; }};
+    executor.Spawn(SleepAndCount(executor, milliseconds(1), count));
+    executor.Wait();
+  }
+
+  CHECK(num_started == 3);
+  CHECK(count == 1);
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,156 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <sched.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "client_backend/cpu_affinity.h"
+#include "doctest.h"
+
+namespace cb = triton::perfanalyzer::clientbackend;
+
+namespace triton { namespace perfanalyzer {
+
+TEST_CASE("cpu_affinity: parse")
+{
+  const cb::CpuAffinity allowed{cb::CpuAffinity::Current()};
+  REQUIRE(!allowed.Empty());
+  const int cpu{allowed.Cpus().front()};
+
+  SUBCASE("the allowed CPUs round-trip through their list")
+  {
+    const cb::CpuAffinity parsed{cb::CpuAffinity::Parse(allowed.ToString())};
+    CHECK(parsed == allowed);
+  }
+
+  SUBCASE("repeated CPUs are merged")
+  {
+    const std::string list{std::to_string(cpu)};
+    const cb::CpuAffinity parsed{
+        cb::CpuAffinity::Parse(list + "," + list + "-" + list)};
+    CHECK(parsed.Cpus() == std::vector<int>{cpu});
+    CHECK(parsed.ToString() == list);
+  }
+
+  SUBCASE("NUMA nodes")
+  {
+    const std::filesystem::path node_dir{
+        std::filesystem::temp_directory_path() / "pa_test_cpu_affinity"};
+    std::filesystem::create_directories(node_dir / "node3");
+    std::ofstream(node_dir / "node3" / "cpulist") << cpu << "\n";
+    // A node with memory but no CPUs
+    std::filesystem::create_directories(node_dir / "node4");
+    std::ofstream(node_dir / "node4" / "cpulist") << "\n";
+
+    const cb::CpuAffinity parsed{
+        cb::CpuAffinity::Parse("node:3", node_dir.string())};
+    CHECK(parsed.Cpus() == std::vector<int>{cpu});
+    CHECK(parsed.NumaNodes(node_dir.string()) == std::vector<int>{3});
+
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("node:7", node_dir.string()),
+        "NUMA node 7 does not exist.", std::invalid_argument);
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("node:4", node_dir.string()),
+        "The CPU list 'node:4' does not contain any CPU.",
+        std::invalid_argument);
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("node:", node_dir.string()),
+        "Invalid NUMA node 'node:'.", std::invalid_argument);
+
+    std::filesystem::remove_all(node_dir);
+  }
+
+  SUBCASE("invalid lists")
+  {
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse(""), "The CPU list '' does not contain any CPU.",
+        std::invalid_argument);
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("0,"), "Invalid CPU list '0,'.",
+        std::invalid_argument);
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("0,,1"), "Invalid CPU list '0,,1'.",
+        std::invalid_argument);
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("-1"), "Invalid CPU list '-1'.",
+        std::invalid_argument);
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("3-1"),
+        "Invalid CPU range '3-1'. The range must not decrease.",
+        std::invalid_argument);
+    const std::string out_of_range{
+        "CPU 100000 is out of range. CPUs must be below " +
+        std::to_string(CPU_SETSIZE) + "."};
+    CHECK_THROWS_WITH_AS(
+        cb::CpuAffinity::Parse("100000"), out_of_range.c_str(),
+        std::invalid_argument);
+  }
+
+  SUBCASE("CPUs that the process may not run on")
+  {
+    const int last_cpu{CPU_SETSIZE - 1};
+    if (allowed.Cpus().back() != last_cpu) {
+      const std::string not_available{
+          "CPU " + std::to_string(last_cpu) +
+          " is not available to this process. Available CPUs are " +
+          allowed.ToString() + "."};
+      CHECK_THROWS_WITH_AS(
+          cb::CpuAffinity::Parse(std::to_string(last_cpu)),
+          not_available.c_str(), std::invalid_argument);
+    }
+  }
+}
+
+TEST_CASE("cpu_affinity: pin the current thread")
+{
+  const cb::CpuAffinity allowed{cb::CpuAffinity::Current()};
+  const cb::CpuAffinity first{
+      cb::CpuAffinity::Parse(std::to_string(allowed.Cpus().front()))};
+
+  cb::CpuAffinity pinned;
+  cb::CpuAffinity unpinned;
+  std::thread([&]() {
+    first.PinCurrentThread();
+    pinned = cb::CpuAffinity::Current();
+  }).join();
+  std::thread([&]() {
+    // An empty set leaves the thread where it is
+    cb::CpuAffinity().PinCurrentThread();
+    unpinned = cb::CpuAffinity::Current();
+  }).join();
+
+  CHECK(pinned == first);
+  CHECK(unpinned == allowed);
+}
+
+}}  // namespace triton::perfanalyzer
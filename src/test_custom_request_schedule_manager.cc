@@ -25,6 +25,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <vector>
 
 #include "command_line_parser.h"
@@ -46,7 +48,7 @@ class TestCustomRequestScheduleManager : public TestLoadManagerBase,
 
   void TestSchedule(const std::vector<std::chrono::milliseconds> schedule)
   {
-    schedule_ = schedule;
+    schedule_.assign(schedule.begin(), schedule.end());
     int request_count = schedule_.size();
     PauseWorkers();
     ConfigureThreads(request_count);
@@ -74,6 +76,34 @@ class TestCustomRequestScheduleManager : public TestLoadManagerBase,
 
     CHECK(expected_timestamps == actual_timestamps);
   }
+
+  void TestTraceSchedule(
+      const std::vector<std::chrono::nanoseconds>& expected_timestamps)
+  {
+    ScanTrace();
+    REQUIRE(ScheduleSize() == expected_timestamps.size());
+    PauseWorkers();
+    ConfigureThreads(ScheduleSize());
+    GenerateSchedule();
+
+    // The trace is dealt out to the workers as they ask for their timestamps,
+    // in the order of the thread ids
+    const std::vector<size_t> thread_ids{CalculateThreadIds()};
+    std::vector<std::chrono::nanoseconds> actual_timestamps{};
+    for (size_t i{0}; i <= expected_timestamps.size(); ++i) {
+      const auto worker{std::dynamic_pointer_cast<RequestRateWorker>(
+          workers_[thread_ids[i % thread_ids.size()]])};
+      actual_timestamps.push_back(worker->GetNextTimestamp());
+    }
+
+    // After its end the trace starts over one trace duration later
+    const auto next_round_timestamp{actual_timestamps.back()};
+    actual_timestamps.pop_back();
+    CHECK(expected_timestamps == actual_timestamps);
+    CHECK(
+        next_round_timestamp ==
+        expected_timestamps.front() + expected_timestamps.back());
+  }
 };
 
 TEST_CASE("custom_request_schedule")
@@ -115,4 +145,27 @@ TEST_CASE("custom_request_schedule")
 
   tcrsm.TestSchedule(schedule);
 }
+
+TEST_CASE("custom_request_schedule: trace file")
+{
+  using namespace std::chrono_literals;
+
+  const std::filesystem::path path{
+      std::filesystem::temp_directory_path() / "pa_test_custom_schedule.csv"};
+  std::ofstream(path) << "1000\n"
+                      << "2000\n"
+                      << "2500\n"
+                      << "4000\n";
+
+  PerfAnalyzerParameters params{};
+  params.fixed_schedule_trace = path.string();
+  params.request_count = 4;
+  params.max_threads = 2;
+
+  TestCustomRequestScheduleManager tcrsm(params);
+
+  tcrsm.TestTraceSchedule({1000ms, 2000ms, 2500ms, 4000ms});
+
+  std::filesystem::remove(path);
+}
 }  // namespace triton::perfanalyzer
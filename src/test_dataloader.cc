@@ -298,6 +298,148 @@ TEST_CASE("dataloader: ReadDataFromJSON")
   }
 }
 
+TEST_CASE("dataloader: ReadDataFromBinaryTrace")
+{
+  DataLoader dataloader;
+  std::shared_ptr<ModelTensorMap> inputs = std::make_shared<ModelTensorMap>();
+  ModelTensor payload = TestDataLoader::CreateTensor("payload");
+  payload.datatype_ = "JSON";
+  ModelTensor delay = TestDataLoader::CreateTensor("delay");
+  delay.datatype_ = "UINT64";
+  delay.is_optional_ = true;
+  inputs->insert(std::make_pair(payload.name_, payload));
+  inputs->insert(std::make_pair(delay.name_, delay));
+
+  std::string trace_file = "binary_trace.patrace";
+  BinaryTrace::Write(trace_file, 2, [](size_t i) {
+    return BinaryTraceRecord{
+        {}, i == 0 ? std::optional<uint64_t>(1500) : std::nullopt, {},
+        i == 0 ? R"({"turn":0})" : R"({"turn":1})"};
+  });
+
+  SUBCASE("Valid binary trace")
+  {
+    cb::Error status = dataloader.ReadDataFromBinaryTrace(inputs, trace_file);
+    REQUIRE(status.IsOk());
+    CHECK(dataloader.GetDataStreamsCount() == 1);
+    CHECK(dataloader.GetTotalSteps(0) == 2);
+
+    TensorData data;
+    status = dataloader.GetInputData(payload, 0, 1, data);
+    REQUIRE(status.IsOk());
+    CHECK(
+        std::string(reinterpret_cast<const char*>(data.data_ptr),
+                    data.batch1_size) == R"({"turn":1})");
+
+    status = dataloader.GetInputData(delay, 0, 0, data);
+    REQUIRE(status.IsOk());
+    CHECK(*reinterpret_cast<const uint64_t*>(data.data_ptr) == 1500);
+    status = dataloader.GetInputData(delay, 0, 1, data);
+    REQUIRE(status.IsOk());
+    CHECK_FALSE(data.is_valid);
+
+    status = dataloader.GetInputData(payload, 0, 2, data);
+    CHECK_FALSE(status.IsOk());
+  }
+
+  SUBCASE("Missing required input")
+  {
+    ModelTensor session_id = TestDataLoader::CreateTensor("session_id");
+    session_id.datatype_ = "BYTES";
+    inputs->insert(std::make_pair(session_id.name_, session_id));
+
+    cb::Error status = dataloader.ReadDataFromBinaryTrace(inputs, trace_file);
+    CHECK(
+        status.Message() == "The binary trace '" + trace_file +
+                                "' has no data for input 'session_id'");
+    CHECK(status.Err() == pa::GENERIC_ERROR);
+  }
+
+  SUBCASE("Not a binary trace")
+  {
+    std::string json_file = "not_binary_trace.json";
+    std::ofstream(json_file) << R"({"data": []})";
+
+    cb::Error status = dataloader.ReadDataFromBinaryTrace(inputs, json_file);
+    std::filesystem::remove(json_file);
+    CHECK(status.Message() == "'" + json_file + "' is not a binary trace.");
+  }
+
+  SUBCASE("JSON after a binary trace")
+  {
+    std::string json_file = "after_binary_trace.json";
+    std::ofstream(json_file) << R"({"data": [{"payload": [{}]}]})";
+
+    REQUIRE(dataloader.ReadDataFromBinaryTrace(inputs, trace_file).IsOk());
+    std::shared_ptr<ModelTensorMap> outputs =
+        std::make_shared<ModelTensorMap>();
+    cb::Error status = dataloader.ReadDataFromJSON(inputs, outputs, json_file);
+    std::filesystem::remove(json_file);
+    CHECK(
+        status.Message() ==
+        "JSON input data can not be combined with a binary trace");
+    CHECK(status.Err() == pa::GENERIC_ERROR);
+    CHECK(dataloader.GetDataStreamsCount() == 1);
+    CHECK(dataloader.GetTotalSteps(0) == 2);
+  }
+
+  std::filesystem::remove(trace_file);
+}
+
+TEST_CASE("dataloader: ConvertToBinaryTrace")
+{
+  std::string json_file = "convert_input_data.json";
+  std::string trace_file = "convert_input_data.patrace";
+
+  SUBCASE("Session payloads")
+  {
+    std::ofstream(json_file) << R"({
+          "data": [
+            {
+              "payload": [{"messages": ["Hi"]}],
+              "session_id": ["a"],
+              "delay": [3000]
+            },
+            {
+              "payload": [{"messages": ["Bye"]}],
+              "session_id": ["a"]
+            }
+          ]})";
+
+    cb::Error status = DataLoader::ConvertToBinaryTrace(json_file, trace_file);
+    REQUIRE(status.IsOk());
+
+    BinaryTrace trace(trace_file);
+    REQUIRE(trace.Size() == 2);
+    CHECK_FALSE(trace.HasInput("timestamp"));
+    TensorData payload = trace.GetInputData("payload", 1);
+    CHECK(
+        std::string(reinterpret_cast<const char*>(payload.data_ptr),
+                    payload.batch1_size) == R"({"messages":["Bye"]})");
+    CHECK(trace.GetInputData("delay", 0).is_valid);
+    CHECK_FALSE(trace.GetInputData("delay", 1).is_valid);
+    CHECK(trace.GetInputData("session_id", 1).batch1_size == 5);
+  }
+
+  SUBCASE("Multiple streams")
+  {
+    std::ofstream(json_file) << R"({
+          "data": [
+            [{"payload": [{}]}],
+            [{"payload": [{}]}]
+          ]})";
+
+    cb::Error status = DataLoader::ConvertToBinaryTrace(json_file, trace_file);
+    CHECK(
+        status.Message() ==
+        "Only an input data JSON with a single flat array for the \"data\" "
+        "field can be converted to a binary trace");
+  }
+
+  std::filesystem::remove(json_file);
+  std::filesystem::remove(trace_file);
+}
+
 TEST_CASE("dataloader: ReadDataFromPipe")
 {
   DataLoader dataloader;
@@ -0,0 +1,254 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "doctest.h"
+#include "goodput_search.h"
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+constexpr uint64_t NANOS_PER_MS{1000000};
+
+// A server whose latency and completion rate at a load are given by a model,
+// measured in windows of the given number of requests
+struct SimulatedServer {
+  std::function<uint64_t(double)> latency_ms;
+  std::function<double(double)> completed_fraction{
+      [](double) { return 1.0; }};
+  uint64_t requests_per_window{1000};
+
+  std::vector<double> Run(GoodputSearch& search) const
+  {
+    std::vector<double> loads;
+    while (auto load = search.NextLoad()) {
+      loads.push_back(*load);
+      LatencyHistogram histogram{};
+      const uint64_t completed{static_cast<uint64_t>(
+          requests_per_window * completed_fraction(*load))};
+      for (uint64_t i = 0; i < completed; i++) {
+        histogram.Record(latency_ms(*load) * NANOS_PER_MS + i);
+      }
+      search.AddWindow(histogram, requests_per_window, 0, 0, 1.0);
+      REQUIRE(loads.size() < 100);
+    }
+    return loads;
+  }
+};
+
+GoodputSlo
+Slo(const uint64_t p99_ms, const double max_error_rate = 1)
+{
+  GoodputSlo slo{};
+  slo.latency_limit_ns = p99_ms * NANOS_PER_MS;
+  slo.max_error_rate = max_error_rate;
+  return slo;
+}
+
+}  // namespace
+
+TEST_CASE("goodput_search: parsing the SLO")
+{
+  SUBCASE("percentile and error rate")
+  {
+    const GoodputSlo slo{GoodputSlo::Parse("p95=200,error-rate=0.01")};
+    CHECK(slo.percentile == doctest::Approx(95));
+    CHECK(slo.latency_limit_ns == 200 * NANOS_PER_MS);
+    CHECK(slo.max_error_rate == doctest::Approx(0.01));
+  }
+  SUBCASE("fractional percentile and milliseconds")
+  {
+    const GoodputSlo slo{GoodputSlo::Parse("p99.9=2.5")};
+    CHECK(slo.percentile == doctest::Approx(99.9));
+    CHECK(slo.latency_limit_ns == 2500000);
+    CHECK(slo.max_error_rate == doctest::Approx(1));
+  }
+  SUBCASE("invalid")
+  {
+    CHECK_THROWS_AS(GoodputSlo::Parse(""), std::invalid_argument);
+    CHECK_THROWS_AS(GoodputSlo::Parse("error-rate=0.1"), std::invalid_argument);
+    CHECK_THROWS_AS(GoodputSlo::Parse("p100=10"), std::invalid_argument);
+    CHECK_THROWS_AS(GoodputSlo::Parse("p99=0"), std::invalid_argument);
+    CHECK_THROWS_AS(GoodputSlo::Parse("p99=fast"), std::invalid_argument);
+    CHECK_THROWS_AS(
+        GoodputSlo::Parse("p99=10,error-rate=1"), std::invalid_argument);
+    CHECK_THROWS_AS(GoodputSlo::Parse("p99=10,avg=5"), std::invalid_argument);
+  }
+}
+
+TEST_CASE("goodput_search: confidence intervals")
+{
+  LatencyHistogram histogram{5};
+  for (uint64_t i = 1; i <= 10000; i++) {
+    histogram.Record(i);
+  }
+  const auto [low, high]{GoodputSearch::PercentileInterval(histogram, 99)};
+  CHECK(low < 9900);
+  CHECK(high > 9900);
+  CHECK(low > 9850);
+  CHECK(high < 9950);
+
+  // Too few latencies to tell the p99 from the maximum
+  LatencyHistogram small{};
+  for (uint64_t i = 1; i <= 50; i++) {
+    small.Record(i);
+  }
+  CHECK(
+      GoodputSearch::PercentileInterval(small, 99).second ==
+      std::numeric_limits<uint64_t>::max());
+
+  const auto [no_errors_low, no_errors_high]{
+      GoodputSearch::ErrorRateInterval(1000, 1000)};
+  CHECK(no_errors_low == doctest::Approx(0));
+  CHECK(no_errors_high < 0.01);
+  const auto [errors_low, errors_high]{
+      GoodputSearch::ErrorRateInterval(1000, 900)};
+  CHECK(errors_low < 0.1);
+  CHECK(errors_high > 0.1);
+}
+
+TEST_CASE("goodput_search: finds the knee")
+{
+  // The latency jumps past the SLO above a concurrency of 37
+  SimulatedServer server{
+      [](double load) -> uint64_t { return load <= 37 ? 10 : 100; }};
+  GoodputSearch search{Slo(50), 1, 0, 1, true, 10};
+
+  const std::vector<double> loads{server.Run(search)};
+
+  // Short probes double up to the knee before it is bisected
+  REQUIRE(loads.size() >= 7);
+  CHECK(loads[0] == 1);
+  CHECK(loads[6] == 64);
+
+  const GoodputSearchResult result{search.Result()};
+  CHECK(result.found);
+  CHECK(result.max_load == 37);
+  CHECK(result.next_load == 38);
+  CHECK(result.latency_ns >= 10 * NANOS_PER_MS);
+  CHECK(result.bounds.latency_high_ns < 50 * NANOS_PER_MS);
+  CHECK(result.goodput == doctest::Approx(1000));
+  // Every load gets its verdict in a single window
+  CHECK(result.num_windows == loads.size());
+}
+
+TEST_CASE("goodput_search: request rate to a precision")
+{
+  SimulatedServer server{
+      [](double load) -> uint64_t { return load <= 412.5 ? 10 : 100; }};
+  GoodputSearch search{Slo(50), 100, 1000, 5, false, 10};
+  server.Run(search);
+
+  const GoodputSearchResult result{search.Result()};
+  CHECK(result.found);
+  CHECK(result.max_load <= 412.5);
+  CHECK(result.next_load > 412.5);
+  CHECK(result.next_load - result.max_load <= 5);
+}
+
+TEST_CASE("goodput_search: error rate")
+{
+  // Requests fail without a response above a request rate of 300
+  SimulatedServer server{
+      [](double) -> uint64_t { return 10; },
+      [](double load) { return load <= 300 ? 1.0 : 300 / load; }};
+  GoodputSearch search{Slo(50, 0.01), 50, 0, 10, false, 10};
+  server.Run(search);
+
+  const GoodputSearchResult result{search.Result()};
+  CHECK(result.found);
+  CHECK(result.max_load <= 300);
+  CHECK(result.next_load > 300);
+  CHECK(result.bounds.error_rate_high <= 0.01);
+}
+
+TEST_CASE("goodput_search: requests in flight are not errors")
+{
+  // Every window ends with a tenth of its requests still in flight, and none
+  // of them fail
+  GoodputSearch search{Slo(50, 0.01), 8, 8, 1, true, 1};
+  LatencyHistogram histogram{};
+  for (uint64_t i = 0; i < 900; i++) {
+    histogram.Record(10 * NANOS_PER_MS + i);
+  }
+  search.AddWindow(histogram, 1000, 0, 100, 1.0);
+
+  const GoodputSearchResult result{search.Result()};
+  CHECK(result.found);
+  CHECK(result.max_load == 8);
+  CHECK(result.bounds.error_rate_low == 0);
+}
+
+TEST_CASE("goodput_search: ends of the range")
+{
+  SUBCASE("the start violates the SLO")
+  {
+    SimulatedServer server{[](double) -> uint64_t { return 100; }};
+    GoodputSearch search{Slo(50), 4, 64, 1, true, 10};
+    CHECK(server.Run(search).size() == 1);
+    CHECK_FALSE(search.Result().found);
+  }
+  SUBCASE("the end meets the SLO")
+  {
+    SimulatedServer server{[](double) -> uint64_t { return 10; }};
+    GoodputSearch search{Slo(50), 4, 20, 1, true, 10};
+    CHECK(server.Run(search) == std::vector<double>{4, 8, 16, 20});
+    const GoodputSearchResult result{search.Result()};
+    CHECK(result.found);
+    CHECK(result.max_load == 20);
+    CHECK(result.next_load == 20);
+  }
+}
+
+TEST_CASE("goodput_search: inconclusive loads are measured again")
+{
+  SimulatedServer server{[](double) -> uint64_t { return 10; }};
+
+  SUBCASE("until the histogram bounds the percentile")
+  {
+    // One window of 400 requests is too small to bound a p99 from above, the
+    // two merged are not
+    server.requests_per_window = 400;
+    GoodputSearch search{Slo(50), 8, 8, 1, true, 5};
+    CHECK(server.Run(search) == std::vector<double>{8, 8});
+    CHECK(search.Result().found);
+  }
+  SUBCASE("up to the window limit")
+  {
+    server.requests_per_window = 50;
+    GoodputSearch search{Slo(50), 8, 8, 1, true, 3};
+    CHECK(server.Run(search) == std::vector<double>{8, 8, 8});
+    // Judged by the point estimate in the end
+    CHECK(search.Result().found);
+    CHECK(search.Result().num_windows == 3);
+  }
+}
+
+}}  // namespace triton::perfanalyzer
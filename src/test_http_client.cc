@@ -26,8 +26,12 @@
 
 #include <curl/curl.h>
 
+#include <filesystem>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 #include "client_backend/openai/openai_client.h"
 #include "doctest.h"
@@ -37,14 +41,25 @@ namespace openai {
 
 class TestHTTPClient : public HttpClient {
  public:
+  using HttpClient::AcquireEasyHandle;
   using HttpClient::PrintCurlCommand;
+  using HttpClient::Send;
 
   TestHTTPClient(
       const std::string& url, bool verbose,
-      const HttpSslOptions& ssl_options = HttpSslOptions())
-      : HttpClient(url, verbose, ssl_options)
+      const HttpSslOptions& ssl_options = HttpSslOptions(),
+      size_t transfer_shards = 1)
+      : HttpClient(url, verbose, ssl_options, CpuAffinity(), transfer_shards)
   {
   }
+
+  void SetupEasyHandle(CURL* handle) override
+  {
+    HttpClient::SetupEasyHandle(handle);
+    num_setup_handles_++;
+  }
+
+  size_t num_setup_handles_{0};
 };
 
 std::string
@@ -67,8 +82,7 @@ TEST_CASE("Test PrintCurlCommand")
   auto request = std::make_unique<HttpRequest>(
       [](HttpRequest*) { /* completion callback */ }, true);
   request->AddInput(
-      reinterpret_cast<uint8_t*>(const_cast<char*>(test_data)),
-      strlen(test_data));
+      reinterpret_cast<const uint8_t*>(test_data), strlen(test_data));
 
   struct curl_slist* header_list = nullptr;
   header_list =
@@ -108,6 +122,156 @@ TEST_CASE("Test PrintCurlCommand")
   }
 
   curl_easy_cleanup(curl_handle);
+  curl_slist_free_all(header_list);
+}
+
+TEST_CASE("Test HttpRequest input buffers")
+{
+  const std::string first{"{\"prompt\":"};
+  const std::string second{"\"Hello, world!\"}"};
+  HttpRequest request([](HttpRequest*) {});
+  request.AddInput(
+      reinterpret_cast<const uint8_t*>(first.data()), first.size());
+  request.AddInput(
+      reinterpret_cast<const uint8_t*>(second.data()), second.size());
+
+  CHECK(request.total_input_byte_size_ == first.size() + second.size());
+
+  SUBCASE("the input is read in place across the buffers")
+  {
+    std::string body(request.total_input_byte_size_, '\0');
+    size_t input_bytes{0};
+    request.GetNextInput(
+        reinterpret_cast<uint8_t*>(body.data()), body.size(), &input_bytes);
+
+    CHECK(input_bytes == body.size());
+    CHECK(body == first + second);
+    CHECK(request.GetDataBuffers().empty());
+  }
+
+  SUBCASE("the input is read in chunks smaller than a buffer")
+  {
+    std::string body{};
+    uint8_t chunk[4];
+    size_t input_bytes{0};
+    do {
+      request.GetNextInput(chunk, sizeof(chunk), &input_bytes);
+      body.append(reinterpret_cast<const char*>(chunk), input_bytes);
+    } while (input_bytes != 0);
+
+    CHECK(body == first + second);
+  }
+}
+
+TEST_CASE("Test transfer shards")
+{
+  const std::filesystem::path path{
+      std::filesystem::temp_directory_path() / "test_transfer_shards.json"};
+  std::ofstream(path) << "{}";
+  const std::string url{"file://" + path.string()};
+
+  // Sends a request for the local file that calls 'on_complete' when done
+  const auto send{[&url](
+                      TestHTTPClient& client,
+                      std::function<void()> on_complete) {
+    CURL* handle{curl_easy_init()};
+    curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(
+        handle, CURLOPT_WRITEFUNCTION,
+        +[](void*, size_t size, size_t nmemb, void*) { return size * nmemb; });
+    client.Send(
+        handle, std::make_unique<HttpRequest>(
+                    [on_complete](HttpRequest*) { on_complete(); }));
+  }};
+  // The shards count a request as outstanding until its callback returns
+  const auto wait_until_done{[](TestHTTPClient& client, size_t shard) {
+    while (client.TransferShardStats()[shard].outstanding_requests != 0) {
+      std::this_thread::yield();
+    }
+  }};
+
+  SUBCASE("requests are spread over the shards")
+  {
+    TestHTTPClient client(url, false, HttpSslOptions(), 4);
+    std::vector<std::promise<void>> completed(8);
+    for (auto& promise : completed) {
+      send(client, [&promise]() { promise.set_value(); });
+    }
+    for (auto& promise : completed) {
+      promise.get_future().wait();
+    }
+    for (size_t i = 0; i < 4; i++) {
+      wait_until_done(client, i);
+    }
+
+    const std::vector<TransferShardStat> stats{client.TransferShardStats()};
+    REQUIRE(stats.size() == 4);
+    size_t completed_request_count{0};
+    for (const auto& stat : stats) {
+      CHECK(stat.completed_request_count >= 1);
+      CHECK(stat.max_active_handles >= 1);
+      completed_request_count += stat.completed_request_count;
+    }
+    CHECK(completed_request_count == completed.size());
+  }
+
+  SUBCASE("requests go to the shard with the least outstanding requests")
+  {
+    TestHTTPClient client(url, false, HttpSslOptions(), 2);
+
+    // The first request blocks its shard until it is released
+    std::promise<void> blocked, released;
+    std::shared_future<void> release{released.get_future().share()};
+    send(client, [&blocked, release]() {
+      blocked.set_value();
+      release.wait();
+    });
+    blocked.get_future().wait();
+
+    std::vector<std::promise<void>> completed(3);
+    for (auto& promise : completed) {
+      send(client, [&promise]() { promise.set_value(); });
+      promise.get_future().wait();
+      wait_until_done(client, 1);
+    }
+
+    std::vector<TransferShardStat> stats{client.TransferShardStats()};
+    CHECK(stats[0].outstanding_requests == 1);
+    CHECK(stats[0].completed_request_count == 0);
+    CHECK(stats[1].outstanding_requests == 0);
+    CHECK(stats[1].completed_request_count == 3);
+
+    released.set_value();
+  }
+
+  SUBCASE("easy handles are reused")
+  {
+    TestHTTPClient client(url, false);
+    CURL* handle{client.AcquireEasyHandle()};
+    CHECK(client.num_setup_handles_ == 1);
+    curl_easy_setopt(
+        handle, CURLOPT_WRITEFUNCTION,
+        +[](void*, size_t size, size_t nmemb, void*) { return size * nmemb; });
+
+    std::promise<void> completed;
+    client.Send(
+        handle, std::make_unique<HttpRequest>(
+                    [&completed](HttpRequest*) { completed.set_value(); }));
+    completed.get_future().wait();
+    wait_until_done(client, 0);
+
+    // The handle is back in the pool with its options kept
+    CHECK(client.AcquireEasyHandle() == handle);
+    CHECK(client.num_setup_handles_ == 1);
+    CURL* other_handle{client.AcquireEasyHandle()};
+    CHECK(other_handle != handle);
+    CHECK(client.num_setup_handles_ == 2);
+
+    curl_easy_cleanup(handle);
+    curl_easy_cleanup(other_handle);
+  }
+
+  std::filesystem::remove(path);
 }
 
 }}}}  // namespace triton::perfanalyzer::clientbackend::openai
@@ -140,15 +140,9 @@ TEST_CASE("send_request: testing the SendRequest function")
     mock_infer_context.infer_backend_ =
         std::make_unique<cb::MockClientBackend>(mock_client_stats);
 
-    const uint64_t request_id{5};
     const bool delayed{false};
     const uint64_t sequence_id{2};
-
-    mock_infer_context.infer_data_.options_->request_id_ =
-        std::to_string(request_id);
-
-    cb::MockInferResult* mock_infer_result{
-        new cb::MockInferResult(*mock_infer_context.infer_data_.options_)};
+    const uint64_t scheduled_ns{1000};
 
     cb::OnCompleteFn& stream_callback{mock_infer_context.async_callback_func_};
 
@@ -157,22 +151,186 @@ TEST_CASE("send_request: testing the SendRequest function")
             *mock_infer_context.infer_backend_),
         AsyncStreamInfer(testing::_, testing::_, testing::_))
         .WillOnce(
-            [&mock_infer_result, &stream_callback](
+            [&stream_callback](
                 const cb::InferOptions& options,
                 const std::vector<cb::InferInput*>& inputs,
                 const std::vector<const cb::InferRequestedOutput*>& outputs)
                 -> cb::Error {
-              stream_callback(mock_infer_result);
+              stream_callback(new cb::MockInferResult(options));
               return cb::Error::Success;
             });
 
-    mock_infer_context.SendRequest(request_id, delayed, sequence_id);
+    mock_infer_context.SendRequest(delayed, sequence_id, scheduled_ns);
 
-    CHECK(mock_infer_context.thread_stat_->request_records_.size() == 1);
+    RequestRecordStore request_records{};
+    mock_infer_context.thread_stat_->request_records_.TakeAll(request_records);
+    CHECK(request_records.size() == 1);
+    CHECK(request_records.SequenceId(0) == sequence_id);
+    CHECK(request_records.ScheduledNs(0) == scheduled_ns);
+  }
+
+  SUBCASE("testing the reuse of async request slots")
+  {
+    mock_infer_context.thread_stat_ = std::make_shared<ThreadStat>();
+    mock_infer_context.thread_stat_->contexts_stat_.emplace_back();
+    mock_infer_context.async_ = true;
+    mock_infer_context.streaming_ = true;
+    mock_infer_context.infer_data_.options_ =
+        std::make_unique<cb::InferOptions>("my_model");
+    std::shared_ptr<cb::MockClientStats> mock_client_stats{
+        std::make_shared<cb::MockClientStats>()};
+    mock_infer_context.infer_backend_ =
+        std::make_unique<cb::MockClientBackend>(mock_client_stats);
+
+    // Hold on to the results so that the requests stay in flight
+    std::vector<cb::MockInferResult*> pending_results{};
+    std::vector<std::string> request_ids{};
+    EXPECT_CALL(
+        dynamic_cast<cb::MockClientBackend&>(
+            *mock_infer_context.infer_backend_),
+        AsyncStreamInfer(testing::_, testing::_, testing::_))
+        .WillRepeatedly(
+            [&pending_results, &request_ids](
+                const cb::InferOptions& options,
+                const std::vector<cb::InferInput*>& inputs,
+                const std::vector<const cb::InferRequestedOutput*>& outputs)
+                -> cb::Error {
+              pending_results.push_back(new cb::MockInferResult(options));
+              request_ids.push_back(options.request_id_);
+              return cb::Error::Success;
+            });
+
+    cb::OnCompleteFn& stream_callback{mock_infer_context.async_callback_func_};
+
+    for (uint64_t sequence_id = 1; sequence_id <= 3; sequence_id++) {
+      mock_infer_context.SendRequest(false, sequence_id, 0);
+    }
     CHECK(
-        mock_infer_context.thread_stat_->request_records_[0].sequence_id_ ==
-        sequence_id);
+        request_ids ==
+        std::vector<std::string>{"0-0-0-0", "0-0-1-1", "0-0-2-2"});
+
+    // Complete the requests out of order
+    stream_callback(pending_results[1]);
+    stream_callback(pending_results[2]);
+    stream_callback(pending_results[0]);
+
+    RequestRecordStore request_records{};
+    mock_infer_context.thread_stat_->request_records_.TakeAll(request_records);
+    REQUIRE(request_records.size() == 3);
+    CHECK(request_records.SequenceId(0) == 2);
+    CHECK(request_records.SequenceId(1) == 3);
+    CHECK(request_records.SequenceId(2) == 1);
+
+    // The freed slots are reused instead of growing the table, while the
+    // request ids stay unique
+    mock_infer_context.SendRequest(false, 4, 0);
+    CHECK(request_ids.back() == "0-0-3-0");
+    stream_callback(pending_results.back());
+  }
+}
+
+TEST_CASE("async_infer: testing the coroutine request API")
+{
+  MockInferContext mock_infer_context{};
+  mock_infer_context.thread_stat_ = std::make_shared<ThreadStat>();
+  mock_infer_context.thread_stat_->contexts_stat_.emplace_back();
+  mock_infer_context.async_ = true;
+  mock_infer_context.streaming_ = true;
+  mock_infer_context.infer_data_.options_ =
+      std::make_unique<cb::InferOptions>("my_model");
+  std::shared_ptr<cb::MockClientStats> mock_client_stats{
+      std::make_shared<cb::MockClientStats>()};
+  mock_infer_context.infer_backend_ =
+      std::make_unique<cb::MockClientBackend>(mock_client_stats);
+  auto& mock_backend{dynamic_cast<cb::MockClientBackend&>(
+      *mock_infer_context.infer_backend_)};
+  cb::OnCompleteFn& stream_callback{mock_infer_context.async_callback_func_};
+
+  const size_t num_requests{3};
+  std::atomic<size_t> num_completed{0};
+  CoroutineExecutor executor{1};
+  const auto send_requests{[&]() -> Task {
+    for (size_t i = 0; i < num_requests; i++) {
+      co_await mock_infer_context.AsyncInfer(executor);
+      // Each request has completed by the time the coroutine continues
+      CHECK(mock_infer_context.GetNumOngoingRequests() == 0);
+      num_completed++;
+    }
+  }};
+
+  SUBCASE("responses arrive after the send returns")
+  {
+    std::mutex mutex{};
+    std::vector<cb::MockInferResult*> pending_results{};
+    EXPECT_CALL(
+        mock_backend, AsyncStreamInfer(testing::_, testing::_, testing::_))
+        .WillRepeatedly(
+            [&mutex, &pending_results](
+                const cb::InferOptions& options,
+                const std::vector<cb::InferInput*>& inputs,
+                const std::vector<const cb::InferRequestedOutput*>& outputs)
+                -> cb::Error {
+              std::lock_guard<std::mutex> lock(mutex);
+              pending_results.push_back(new cb::MockInferResult(options));
+              return cb::Error::Success;
+            });
+
+    executor.Spawn(send_requests());
+
+    // Complete each request once it was sent. The coroutine only sends the
+    // next one after it was resumed
+    for (size_t i = 0; i < num_requests; i++) {
+      cb::MockInferResult* result{nullptr};
+      while (result == nullptr) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending_results.size() > i) {
+          result = pending_results[i];
+        }
+      }
+      CHECK(num_completed == i);
+      stream_callback(result);
+    }
+    executor.Wait();
   }
+
+  SUBCASE("responses arrive during the send")
+  {
+    EXPECT_CALL(
+        mock_backend, AsyncStreamInfer(testing::_, testing::_, testing::_))
+        .WillRepeatedly(
+            [&stream_callback](
+                const cb::InferOptions& options,
+                const std::vector<cb::InferInput*>& inputs,
+                const std::vector<const cb::InferRequestedOutput*>& outputs)
+                -> cb::Error {
+              stream_callback(new cb::MockInferResult(options));
+              return cb::Error::Success;
+            });
+
+    executor.Spawn(send_requests());
+    executor.Wait();
+  }
+
+  SUBCASE("the request fails to send")
+  {
+    EXPECT_CALL(
+        mock_backend, AsyncStreamInfer(testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(cb::Error("failed to send")));
+
+    // The coroutine continues right away instead of waiting for a response
+    // that never arrives, and doesn't send any more requests
+    const auto send_request{[&]() -> Task {
+      co_await mock_infer_context.AsyncInfer(executor);
+      CHECK(!mock_infer_context.thread_stat_->status_.IsOk());
+      co_await mock_infer_context.AsyncInfer(executor);
+      num_completed = num_requests;
+    }};
+    executor.Spawn(send_request());
+    executor.Wait();
+  }
+
+  CHECK(num_completed == num_requests);
 }
 
 }}  // namespace triton::perfanalyzer
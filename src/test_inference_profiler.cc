@@ -24,6 +24,8 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <chrono>
+
 #include "doctest.h"
 #include "inference_profiler.h"
 #include "mock_inference_profiler.h"
@@ -37,22 +39,75 @@ class TestInferenceProfiler : public InferenceProfiler {
   static void ValidLatencyMeasurement(
       const std::pair<uint64_t, uint64_t>& valid_range,
       size_t& valid_sequence_count, size_t& delayed_request_count,
-      std::vector<uint64_t>* latencies, size_t& response_count,
-      std::vector<RequestRecord>& valid_requests,
-      std::vector<RequestRecord>& all_request_records)
+      LatencyHistogram* latency_histogram, size_t& response_count,
+      RequestRecordStore& valid_requests,
+      const std::vector<RequestRecord>& all_request_records)
   {
     InferenceProfiler inference_profiler{};
-    inference_profiler.all_request_records_ = all_request_records;
+    inference_profiler.all_request_records_ =
+        RequestRecordStore(all_request_records);
     inference_profiler.ValidLatencyMeasurement(
-        valid_range, valid_sequence_count, delayed_request_count, latencies,
-        response_count, valid_requests);
+        valid_range, valid_sequence_count, delayed_request_count,
+        latency_histogram, response_count, valid_requests);
+  }
+
+  /// Runs ValidLatencyMeasurement over consecutive windows and returns the
+  /// number of records that were found valid in each of them.
+  /// Returns the number of valid requests of each window. The number of
+  /// records that each window classifies is returned in classified_counts.
+  static std::vector<size_t> ValidLatencyMeasurementWindows(
+      const std::vector<std::pair<uint64_t, uint64_t>>& windows,
+      RequestRecordStore&& all_request_records,
+      std::vector<size_t>& classified_counts)
+  {
+    InferenceProfiler inference_profiler{};
+    inference_profiler.all_request_records_ = std::move(all_request_records);
+    std::vector<size_t> valid_request_counts{};
+    for (const auto& window : windows) {
+      classified_counts.push_back(
+          inference_profiler.all_request_records_.size());
+      size_t valid_sequence_count{0};
+      size_t delayed_request_count{0};
+      size_t response_count{0};
+      LatencyHistogram latency_histogram{};
+      RequestRecordStore valid_requests{};
+      inference_profiler.ValidLatencyMeasurement(
+          window, valid_sequence_count, delayed_request_count,
+          &latency_histogram, response_count, valid_requests);
+      valid_request_counts.push_back(valid_requests.size());
+    }
+    return valid_request_counts;
+  }
+
+  static void CorrectedLatencyMeasurement(
+      const std::vector<RequestRecord>& requests,
+      LatencyHistogram* corrected_latency_histogram, PerfStatus& summary)
+  {
+    InferenceProfiler inference_profiler{};
+    inference_profiler.CorrectedLatencyMeasurement(
+        RequestRecordStore(requests), corrected_latency_histogram);
+    inference_profiler.SummarizeCorrectedLatency(
+        *corrected_latency_histogram, summary);
+  }
+
+  static std::vector<ProfileDataCollector::TimelineSecond> SummarizeTimeline(
+      const std::vector<RequestRecord>& requests, const LoadCurve& load_curve,
+      const uint64_t curve_start_ns)
+  {
+    InferenceProfiler inference_profiler{};
+    return inference_profiler.SummarizeTimeline(
+        RequestRecordStore(requests), load_curve, curve_start_ns);
   }
 
   static std::tuple<uint64_t, uint64_t> GetMeanAndStdDev(
       const std::vector<uint64_t>& latencies)
   {
     InferenceProfiler inference_profiler{};
-    return inference_profiler.GetMeanAndStdDev(latencies);
+    LatencyHistogram latency_histogram{};
+    for (const auto latency : latencies) {
+      latency_histogram.Record(latency);
+    }
+    return inference_profiler.GetMeanAndStdDev(latency_histogram);
   }
 
   void SummarizeSendRequestRate(
@@ -107,7 +162,7 @@ class TestInferenceProfiler : public InferenceProfiler {
     return ip.IsDoneProfiling(ls, &is_stable);
   };
 
-  std::pair<uint64_t, uint64_t> ClampWindow(std::vector<RequestRecord>& reqs)
+  std::pair<uint64_t, uint64_t> ClampWindow(const RequestRecordStore& reqs)
   {
     return InferenceProfiler::ClampWindow(reqs);
   }
@@ -179,9 +234,9 @@ TEST_CASE("testing the ValidLatencyMeasurement function")
 {
   size_t valid_sequence_count{};
   size_t delayed_request_count{};
-  std::vector<uint64_t> latencies{};
+  LatencyHistogram latency_histogram{};
   size_t response_count{};
-  std::vector<RequestRecord> valid_requests{};
+  RequestRecordStore valid_requests{};
 
   const std::pair<uint64_t, uint64_t> window{4, 17};
   using time_point = std::chrono::time_point<std::chrono::system_clock>;
@@ -220,7 +275,7 @@ TEST_CASE("testing the ValidLatencyMeasurement function")
           {}, 0, false, 0, false)};
 
   TestInferenceProfiler::ValidLatencyMeasurement(
-      window, valid_sequence_count, delayed_request_count, &latencies,
+      window, valid_sequence_count, delayed_request_count, &latency_histogram,
       response_count, valid_requests, all_request_records);
 
   const auto& convert_request_record_to_latency{[](RequestRecord t) {
@@ -228,18 +283,152 @@ TEST_CASE("testing the ValidLatencyMeasurement function")
            CHRONO_TO_NANOS(t.start_time_);
   }};
 
-  CHECK(latencies.size() == 3);
+  CHECK(latency_histogram.Count() == 3);
   CHECK(
-      latencies[0] ==
+      latency_histogram.ValueAtPercentile(0) ==
       convert_request_record_to_latency(all_request_records[1]));
   CHECK(
-      latencies[1] ==
+      latency_histogram.ValueAtPercentile(50) ==
       convert_request_record_to_latency(all_request_records[2]));
   CHECK(
-      latencies[2] ==
+      latency_histogram.ValueAtPercentile(100) ==
       convert_request_record_to_latency(all_request_records[3]));
 }
 
+TEST_CASE("testing the CorrectedLatencyMeasurement function")
+{
+  using time_point = std::chrono::time_point<std::chrono::system_clock>;
+  using ns = std::chrono::nanoseconds;
+  const auto make_record{
+      [](uint64_t start_ns, uint64_t end_ns, uint64_t scheduled_ns) {
+        return RequestRecord(
+            time_point(ns(start_ns)),
+            std::vector<time_point>{time_point(ns(end_ns))}, {}, {}, 0, false,
+            0, false, time_point(ns(scheduled_ns)));
+      }};
+
+  LatencyHistogram corrected_latency_histogram{};
+  PerfStatus summary{};
+
+  SUBCASE("unscheduled requests")
+  {
+    TestInferenceProfiler::CorrectedLatencyMeasurement(
+        {make_record(1000, 2000, 0)}, &corrected_latency_histogram, summary);
+
+    CHECK(corrected_latency_histogram.Empty());
+    CHECK(summary.client_stats.percentile_corrected_latency_ns.empty());
+    CHECK(summary.client_stats.avg_corrected_latency_ns == 0);
+  }
+
+  SUBCASE("scheduled requests")
+  {
+    TestInferenceProfiler::CorrectedLatencyMeasurement(
+        {// sent 3000 ns late, measured from its schedule
+         make_record(4000, 5000, 1000),
+         // sent on time
+         make_record(6000, 7000, 6000),
+         // sent ahead of its schedule, measured from when it was sent
+         make_record(8000, 9500, 9000)},
+        &corrected_latency_histogram, summary);
+
+    CHECK(corrected_latency_histogram.Count() == 3);
+    CHECK(corrected_latency_histogram.Min() == 1000);
+    CHECK(corrected_latency_histogram.Max() == 4000);
+    CHECK(summary.client_stats.avg_corrected_latency_ns == 2166);
+    CHECK(summary.client_stats.percentile_corrected_latency_ns.size() == 4);
+    CHECK(summary.client_stats.percentile_corrected_latency_ns[50] == 1500);
+    CHECK(summary.client_stats.percentile_corrected_latency_ns[99] == 4000);
+  }
+}
+
+TEST_CASE("testing the SummarizeTimeline function")
+{
+  using time_point = std::chrono::time_point<std::chrono::system_clock>;
+  using ns = std::chrono::nanoseconds;
+  const auto make_record{[](uint64_t start_ns, uint64_t end_ns) {
+    return RequestRecord(
+        time_point(ns(start_ns)),
+        std::vector<time_point>{time_point(ns(end_ns))}, {}, {}, 0, false, 0,
+        false);
+  }};
+
+  const uint64_t curve_start_ns{10 * NANOS_PER_SECOND};
+  const LoadCurve load_curve{LoadCurve::Parse("linear:0=10,2=30")};
+
+  const auto timeline{TestInferenceProfiler::SummarizeTimeline(
+      {// sent and completed in the first second
+       make_record(curve_start_ns + 100, curve_start_ns + 300),
+       // sent in the first second and completed in the second
+       make_record(
+           curve_start_ns + NANOS_PER_SECOND - 100,
+           curve_start_ns + NANOS_PER_SECOND + 500),
+       // sent and completed after the end of the curve
+       make_record(
+           curve_start_ns + 3 * NANOS_PER_SECOND,
+           curve_start_ns + 3 * NANOS_PER_SECOND + 1000)},
+      load_curve, curve_start_ns)};
+
+  REQUIRE(timeline.size() == 4);
+  CHECK(timeline[0].target_request_count == doctest::Approx(15));
+  CHECK(timeline[0].sent_count == 2);
+  CHECK(timeline[0].completed_count == 1);
+  CHECK(timeline[0].latency_histogram.Max() == 200);
+  CHECK(timeline[1].target_request_count == doctest::Approx(25));
+  CHECK(timeline[1].sent_count == 0);
+  CHECK(timeline[1].completed_count == 1);
+  CHECK(timeline[1].latency_histogram.Max() == 600);
+  // The curve holds its last rate after it ends
+  CHECK(timeline[2].target_request_count == doctest::Approx(30));
+  CHECK(timeline[2].completed_count == 0);
+  CHECK(timeline[3].sent_count == 1);
+  CHECK(timeline[3].completed_count == 1);
+}
+
+TEST_CASE("ValidLatencyMeasurement: one million records")
+{
+  // Guards window classification against becoming quadratic in the number of
+  // records carried over between windows. The work is counted rather than
+  // timed, as each record left in the store is classified once per window
+  const uint64_t num_records{1000000};
+  const uint64_t latency_ns{10};
+
+  // Requests are appended out of order of their end time, so that every
+  // window moves out records from all over the store and keeps the rest
+  RequestRecordBuilder builder{};
+  RequestRecordStore all_request_records{};
+  for (uint64_t i = 0; i < num_records; i++) {
+    const uint64_t start_ns{(i * 7919) % num_records};
+    builder.Reset(true, false, 0);
+    builder.SetStartNs(start_ns);
+    builder.AddResponse(start_ns + latency_ns, false);
+    all_request_records.Append(builder);
+  }
+
+  std::vector<std::pair<uint64_t, uint64_t>> windows{};
+  const uint64_t window_ns{num_records / 4};
+  for (uint64_t start_ns = 0; start_ns < num_records; start_ns += window_ns) {
+    windows.emplace_back(
+        start_ns + latency_ns, start_ns + window_ns + latency_ns - 1);
+  }
+
+  std::vector<size_t> classified_counts{};
+  const auto valid_request_counts{
+      TestInferenceProfiler::ValidLatencyMeasurementWindows(
+          windows, std::move(all_request_records), classified_counts)};
+
+  REQUIRE(valid_request_counts.size() == 4);
+  for (const auto count : valid_request_counts) {
+    CHECK(count == window_ns);
+  }
+
+  // The valid records leave the store, so every window only classifies the
+  // records that are left
+  REQUIRE(classified_counts.size() == 4);
+  for (size_t i = 0; i < classified_counts.size(); i++) {
+    CHECK(classified_counts[i] == num_records - i * window_ns);
+  }
+}
+
 TEST_CASE("test_check_window_for_stability")
 {
   LoadStatus ls;
@@ -963,20 +1152,20 @@ TEST_CASE(
       expected_response_count = 2;
     }
 
-    mock_inference_profiler.all_request_records_ = {
-        request_record1, request_record2};
+    mock_inference_profiler.all_request_records_ =
+        RequestRecordStore({request_record1, request_record2});
 
     const std::pair<uint64_t, uint64_t> valid_range{
         std::make_pair(0, UINT64_MAX)};
     size_t valid_sequence_count{0};
     size_t delayed_request_count{0};
-    std::vector<uint64_t> valid_latencies{};
+    LatencyHistogram latency_histogram{};
     size_t response_count{0};
-    std::vector<RequestRecord> valid_requests{};
+    RequestRecordStore valid_requests{};
 
     mock_inference_profiler.ValidLatencyMeasurement(
         valid_range, valid_sequence_count, delayed_request_count,
-        &valid_latencies, response_count, valid_requests);
+        &latency_histogram, response_count, valid_requests);
 
     CHECK(response_count == expected_response_count);
   }
@@ -1008,23 +1197,23 @@ TEST_CASE(
             response3_timestamp},
         {}, {}, 0, false, 0, false)};
 
-    mock_inference_profiler.all_request_records_ = {
-        request_record1, request_record2, request_record3};
+    mock_inference_profiler.all_request_records_ = RequestRecordStore(
+        {request_record1, request_record2, request_record3});
 
     const std::pair<uint64_t, uint64_t> valid_range{std::make_pair(0, 4)};
     size_t valid_sequence_count{0};
     size_t delayed_request_count{0};
-    std::vector<uint64_t> valid_latencies{};
+    LatencyHistogram latency_histogram{};
     size_t response_count{0};
-    std::vector<RequestRecord> valid_requests{};
+    RequestRecordStore valid_requests{};
 
     mock_inference_profiler.ValidLatencyMeasurement(
         valid_range, valid_sequence_count, delayed_request_count,
-        &valid_latencies, response_count, valid_requests);
+        &latency_histogram, response_count, valid_requests);
 
     CHECK(valid_requests.size() == 2);
-    CHECK(valid_requests[0].start_time_ == request1_timestamp);
-    CHECK(valid_requests[1].start_time_ == request2_timestamp);
+    CHECK(valid_requests.GetRecord(0).start_time_ == request1_timestamp);
+    CHECK(valid_requests.GetRecord(1).start_time_ == request2_timestamp);
   }
 }
 
@@ -1038,10 +1227,13 @@ TEST_CASE(
     PerfStatus perf_status1{};
     perf_status1.client_stats.response_count = 8;
     perf_status1.client_stats.duration_ns = 2000000000;
+    perf_status1.client_stats.latency_histogram.Record(100);
+    perf_status1.client_stats.latency_histogram.Record(200);
 
     PerfStatus perf_status2{};
     perf_status2.client_stats.response_count = 10;
     perf_status2.client_stats.duration_ns = 4000000000;
+    perf_status2.client_stats.latency_histogram.Record(300);
 
     std::deque<PerfStatus> perf_status{perf_status1, perf_status2};
     PerfStatus summary_status{};
@@ -1062,6 +1254,9 @@ TEST_CASE(
     CHECK(summary_status.client_stats.response_count == 18);
     CHECK(
         summary_status.client_stats.responses_per_sec == doctest::Approx(3.0));
+    CHECK(summary_status.client_stats.latency_histogram.Count() == 3);
+    CHECK(summary_status.client_stats.latency_histogram.Min() == 100);
+    CHECK(summary_status.client_stats.latency_histogram.Max() == 300);
   }
 }
 
@@ -1094,7 +1289,7 @@ TEST_CASE("clamp window")
       std::vector<std::chrono::time_point<std::chrono::system_clock>>{
           response3_timestamp});
 
-  auto window = tip.ClampWindow(reqs);
+  auto window = tip.ClampWindow(RequestRecordStore(reqs));
 
   CHECK(window.first == 3);
   CHECK(window.second == 20);
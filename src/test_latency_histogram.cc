@@ -0,0 +1,178 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "constants.h"
+#include "doctest.h"
+#include "latency_histogram.h"
+#include "perf_analyzer_exception.h"
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+uint64_t
+ExactPercentile(const std::vector<uint64_t>& sorted, const double percentile)
+{
+  const size_t index = (percentile / 100.0) * (sorted.size() - 1) + 0.5;
+  return sorted[index];
+}
+
+}  // namespace
+
+TEST_CASE("latency_histogram: empty")
+{
+  LatencyHistogram histogram{};
+  CHECK(histogram.Empty());
+  CHECK(histogram.Count() == 0);
+  CHECK(histogram.Min() == 0);
+  CHECK(histogram.Max() == 0);
+  CHECK(histogram.Mean() == 0);
+  CHECK(histogram.StdDev() == 0);
+  CHECK(histogram.ValueAtPercentile(99) == 0);
+  CHECK(histogram.Buckets().empty());
+}
+
+TEST_CASE("latency_histogram: small values are exact")
+{
+  LatencyHistogram histogram{};
+  std::vector<uint64_t> latencies{};
+  for (uint64_t i = 1000; i > 0; i--) {
+    histogram.Record(i);
+    latencies.push_back(i);
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  CHECK(histogram.Count() == 1000);
+  CHECK(histogram.Min() == 1);
+  CHECK(histogram.Max() == 1000);
+  CHECK(histogram.Mean() == 500);
+  for (const double percentile : {0.0, 1.0, 50.0, 90.0, 99.0, 99.9, 100.0}) {
+    CAPTURE(percentile);
+    CHECK(
+        histogram.ValueAtPercentile(percentile) ==
+        ExactPercentile(latencies, percentile));
+  }
+  CHECK(histogram.Buckets().size() == 1000);
+}
+
+TEST_CASE("latency_histogram: precision")
+{
+  std::vector<uint64_t> latencies{};
+  std::mt19937_64 rng{42};
+  std::lognormal_distribution<double> dist{16.0, 2.0};
+  for (size_t i = 0; i < 100000; i++) {
+    latencies.push_back(static_cast<uint64_t>(dist(rng)) + 1);
+  }
+  std::vector<uint64_t> sorted{latencies};
+  std::sort(sorted.begin(), sorted.end());
+
+  for (uint32_t significant_digits = 1;
+       significant_digits <= LatencyHistogram::MAX_SIGNIFICANT_DIGITS;
+       significant_digits++) {
+    CAPTURE(significant_digits);
+    LatencyHistogram histogram{significant_digits};
+    for (const auto latency : latencies) {
+      histogram.Record(latency);
+    }
+
+    const double max_relative_error{std::pow(10.0, -1.0 * significant_digits)};
+    for (const double percentile :
+         {0.0, 25.0, 50.0, 90.0, 99.0, 99.99, 100.0}) {
+      CAPTURE(percentile);
+      const double exact{
+          static_cast<double>(ExactPercentile(sorted, percentile))};
+      const double actual{
+          static_cast<double>(histogram.ValueAtPercentile(percentile))};
+      CHECK(std::abs(actual - exact) / exact <= max_relative_error);
+    }
+    CHECK(histogram.Min() == sorted.front());
+    CHECK(histogram.Max() == sorted.back());
+  }
+}
+
+TEST_CASE("latency_histogram: merge")
+{
+  LatencyHistogram merged{};
+  LatencyHistogram combined{};
+  LatencyHistogram part{};
+  std::mt19937_64 rng{7};
+  std::uniform_int_distribution<uint64_t> dist{1, 5000000000};
+  for (size_t i = 0; i < 30000; i++) {
+    const uint64_t latency{dist(rng)};
+    combined.Record(latency);
+    part.Record(latency);
+    if (i % 10000 == 9999) {
+      merged.Merge(part);
+      part.Clear();
+    }
+  }
+
+  CHECK(merged.Count() == combined.Count());
+  CHECK(merged.Min() == combined.Min());
+  CHECK(merged.Max() == combined.Max());
+  CHECK(merged.Mean() == combined.Mean());
+  CHECK(merged.StdDev() == doctest::Approx(combined.StdDev()));
+  for (const double percentile : {50.0, 90.0, 99.0}) {
+    CHECK(
+        merged.ValueAtPercentile(percentile) ==
+        combined.ValueAtPercentile(percentile));
+  }
+
+  const auto merged_buckets{merged.Buckets()};
+  const auto combined_buckets{combined.Buckets()};
+  REQUIRE(merged_buckets.size() == combined_buckets.size());
+  for (size_t i = 0; i < merged_buckets.size(); i++) {
+    CHECK(merged_buckets[i].lowest == combined_buckets[i].lowest);
+    CHECK(merged_buckets[i].count == combined_buckets[i].count);
+  }
+
+  SUBCASE("different precision")
+  {
+    LatencyHistogram coarse{1};
+    coarse.Merge(combined);
+    CHECK(coarse.Count() == combined.Count());
+    CHECK(coarse.Min() == combined.Min());
+    CHECK(coarse.Max() == combined.Max());
+    CHECK(coarse.Mean() == combined.Mean());
+    CHECK(coarse.Buckets().size() < combined_buckets.size());
+  }
+}
+
+TEST_CASE("latency_histogram: invalid precision")
+{
+  CHECK_THROWS_AS(LatencyHistogram{0}, PerfAnalyzerException);
+  CHECK_THROWS_AS(
+      LatencyHistogram{LatencyHistogram::MAX_SIGNIFICANT_DIGITS + 1},
+      PerfAnalyzerException);
+}
+
+}}  // namespace triton::perfanalyzer
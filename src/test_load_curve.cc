@@ -0,0 +1,172 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+
+#include "doctest.h"
+#include "load_curve.h"
+#include "perf_utils.h"
+
+namespace triton { namespace perfanalyzer {
+
+TEST_CASE("load_curve: linear")
+{
+  const LoadCurve curve{
+      LoadCurve::Parse("linear:0=10,10=30,10=100,20=100")};
+
+  CHECK(curve.GetShape() == LoadCurve::Shape::Linear);
+  CHECK(curve.Duration() == doctest::Approx(20));
+
+  CHECK(curve.RateAt(0) == doctest::Approx(10));
+  CHECK(curve.RateAt(5) == doctest::Approx(20));
+  // Two points at the same time make a step
+  CHECK(curve.RateAt(10) == doctest::Approx(100));
+  CHECK(curve.RateAt(15) == doctest::Approx(100));
+  // The curve holds its last rate after it ends
+  CHECK(curve.RateAt(30) == doctest::Approx(100));
+
+  CHECK(curve.RequestsUntil(5) == doctest::Approx(75));
+  CHECK(curve.RequestsUntil(10) == doctest::Approx(200));
+  CHECK(curve.RequestsUntil(20) == doctest::Approx(1200));
+  CHECK(curve.RequestsUntil(21) == doctest::Approx(1300));
+  CHECK(curve.MeanRate() == doctest::Approx(60));
+  CHECK(curve.ExpectedRequestCount() == 1200);
+
+  for (const double t : {0.5, 5.0, 10.0, 12.5, 20.0, 25.0}) {
+    CHECK(curve.TimeOfRequests(curve.RequestsUntil(t)) == doctest::Approx(t));
+  }
+}
+
+TEST_CASE("load_curve: sine")
+{
+  const LoadCurve curve{
+      LoadCurve::Parse("sine:base=100,amplitude=50,period=4,duration=8")};
+
+  CHECK(curve.GetShape() == LoadCurve::Shape::Sine);
+  CHECK(curve.Duration() == doctest::Approx(8));
+
+  CHECK(curve.RateAt(0) == doctest::Approx(100));
+  CHECK(curve.RateAt(1) == doctest::Approx(150));
+  CHECK(curve.RateAt(3) == doctest::Approx(50));
+
+  // Whole periods average out to the base rate
+  CHECK(curve.RequestsUntil(4) == doctest::Approx(400));
+  CHECK(curve.MeanRate() == doctest::Approx(100));
+  // Half a period adds the area of the positive half of the wave
+  CHECK(
+      curve.RequestsUntil(2) ==
+      doctest::Approx(200 + 50 * 4 / std::numbers::pi));
+
+  for (const double t : {0.25, 1.0, 3.0, 7.5}) {
+    CHECK(curve.TimeOfRequests(curve.RequestsUntil(t)) == doctest::Approx(t));
+  }
+}
+
+TEST_CASE("load_curve: schedule follows the curve")
+{
+  const LoadCurve curve{LoadCurve::Parse("linear:0=100,10=1000")};
+
+  SUBCASE("constant")
+  {
+    // Constant gaps of one request put every request exactly where the curve
+    // reaches a whole number of requests
+    auto schedule{curve.ScheduleDistribution(
+        ScheduleDistribution<Distribution::CONSTANT>(1.0))};
+    std::mt19937 rng;
+    std::chrono::nanoseconds timestamp{0};
+    for (size_t i = 1; i <= curve.ExpectedRequestCount(); i++) {
+      timestamp += schedule(rng);
+      CHECK(
+          std::chrono::duration<double>(timestamp).count() ==
+          doctest::Approx(curve.TimeOfRequests(i)));
+    }
+    CHECK(
+        std::chrono::duration<double>(timestamp).count() ==
+        doctest::Approx(curve.Duration()));
+  }
+
+  SUBCASE("poisson")
+  {
+    auto schedule{curve.ScheduleDistribution(
+        ScheduleDistribution<Distribution::POISSON>(1.0))};
+    std::mt19937 rng;
+    std::chrono::nanoseconds timestamp{0};
+    size_t first_half{0};
+    size_t second_half{0};
+    while (true) {
+      timestamp += schedule(rng);
+      const double t{std::chrono::duration<double>(timestamp).count()};
+      if (t >= curve.Duration()) {
+        break;
+      }
+      (t < curve.Duration() / 2 ? first_half : second_half)++;
+    }
+    CHECK(
+        first_half ==
+        doctest::Approx(curve.RequestsUntil(curve.Duration() / 2))
+            .epsilon(0.05));
+    CHECK(
+        first_half + second_half ==
+        doctest::Approx(curve.ExpectedRequestCount()).epsilon(0.05));
+  }
+}
+
+TEST_CASE("load_curve: invalid specifications")
+{
+  const auto check_invalid{[](const std::string& spec, const char* message) {
+    CHECK_THROWS_WITH_AS(
+        LoadCurve::Parse(spec), message, std::invalid_argument);
+  }};
+
+  check_invalid(
+      "linear", "The value does not match <linear|sine>:<key=value>,...");
+  check_invalid(
+      "square:0=1", "Unsupported curve shape provided: 'square'. Choices are "
+                    "'linear' or 'sine'.");
+  check_invalid("linear:0=10", "The linear curve requires at least 2 points.");
+  check_invalid("linear:1=10,2=10", "The first point must be at 0 seconds.");
+  check_invalid("linear:0=10,5=0", "The rates must be > 0.");
+  check_invalid(
+      "linear:0=10,5=10,4=10", "The times of the points must not decrease.");
+  check_invalid("linear:0=10,0=20", "The duration must be > 0.");
+  check_invalid("linear:0=10,5", "'5' does not match <key=value>.");
+  check_invalid("linear:0=10,5=ten", "'ten' is not a number.");
+  check_invalid(
+      "sine:base=10,amplitude=10,period=1,duration=1",
+      "The amplitude must be >= 0 and smaller than the base.");
+  check_invalid(
+      "sine:base=10,amplitude=5,duration=1",
+      "The sine curve requires 'period'.");
+  check_invalid(
+      "sine:base=10,amplitude=5,period=1,duration=1,phase=2",
+      "The sine curve only takes 'base', 'amplitude', 'period' and "
+      "'duration'.");
+}
+
+}}  // namespace triton::perfanalyzer
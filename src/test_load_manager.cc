@@ -145,7 +145,7 @@ class TestLoadManager : public TestLoadManagerBase, public LoadManager {
         time_point(ns(5)), std::vector<time_point>{time_point(ns(6))}, {}, {},
         0, false, 0, false);
 
-    std::vector<RequestRecord> source_request_records;
+    RequestRecordStore source_request_records;
 
     SUBCASE("No threads")
     {
@@ -176,9 +176,9 @@ class TestLoadManager : public TestLoadManagerBase, public LoadManager {
       CHECK(stat1->request_records_.size() == 0);
 
       REQUIRE(source_request_records.size() == 3);
-      CHECK(source_request_records[0] == request_record1);
-      CHECK(source_request_records[1] == request_record2);
-      CHECK(source_request_records[2] == request_record3);
+      CHECK(source_request_records.GetRecord(0) == request_record1);
+      CHECK(source_request_records.GetRecord(1) == request_record2);
+      CHECK(source_request_records.GetRecord(2) == request_record3);
       CHECK(ret.IsOk() == true);
     }
     SUBCASE("Multiple threads")
@@ -200,9 +200,9 @@ class TestLoadManager : public TestLoadManagerBase, public LoadManager {
       CHECK(stat2->request_records_.size() == 0);
 
       REQUIRE(source_request_records.size() == 3);
-      CHECK(source_request_records[0] == request_record2);
-      CHECK(source_request_records[1] == request_record1);
-      CHECK(source_request_records[2] == request_record3);
+      CHECK(source_request_records.GetRecord(0) == request_record2);
+      CHECK(source_request_records.GetRecord(1) == request_record1);
+      CHECK(source_request_records.GetRecord(2) == request_record3);
       CHECK(ret.IsOk() == true);
     }
   }
@@ -250,6 +250,9 @@ class TestLoadManager : public TestLoadManagerBase, public LoadManager {
       stat1->contexts_stat_[0].cumulative_total_request_time_ns = 3;
       stat1->contexts_stat_[0].cumulative_send_time_ns = 4;
       stat1->contexts_stat_[0].cumulative_receive_time_ns = 5;
+      stat1->contexts_stat_[0].new_connection_count = 1;
+      stat1->contexts_stat_[0].reused_connection_count = 1;
+      stat1->contexts_stat_[0].cumulative_connect_time_ns = 6;
       stat1->contexts_stat_[1].completed_request_count = 3;
       stat1->contexts_stat_[1].cumulative_total_request_time_ns = 4;
       stat1->contexts_stat_[1].cumulative_send_time_ns = 5;
@@ -267,6 +270,9 @@ class TestLoadManager : public TestLoadManagerBase, public LoadManager {
       stat2->contexts_stat_[1].cumulative_total_request_time_ns = 12;
       stat2->contexts_stat_[1].cumulative_send_time_ns = 13;
       stat2->contexts_stat_[1].cumulative_receive_time_ns = 14;
+      stat2->contexts_stat_[1].new_connection_count = 2;
+      stat2->contexts_stat_[1].reused_connection_count = 9;
+      stat2->contexts_stat_[1].cumulative_connect_time_ns = 15;
       threads_stat_.push_back(stat2);
 
       auto ret = GetAccumulatedClientStat(&result_stat);
@@ -282,6 +288,11 @@ class TestLoadManager : public TestLoadManagerBase, public LoadManager {
       // 5 + 6 + 10 + 14
       //
       CHECK(result_stat.cumulative_receive_time_ns == 35);
+      // 1 + 2, 1 + 9 and 6 + 15
+      //
+      CHECK(result_stat.new_connection_count == 3);
+      CHECK(result_stat.reused_connection_count == 10);
+      CHECK(result_stat.cumulative_connect_time_ns == 21);
 
       CHECK(ret.IsOk() == true);
     }
@@ -457,4 +468,49 @@ TEST_CASE(
   CHECK(tlm.threads_stat_[1]->num_sent_requests_ == 0);
 }
 
+TEST_CASE("load_manager: testing the GetNumInFlightRequests function")
+{
+  PerfAnalyzerParameters params{};
+
+  TestLoadManager tlm(params);
+
+  std::shared_ptr<ThreadStat> thread_stat_1{std::make_shared<ThreadStat>()};
+  std::shared_ptr<ThreadStat> thread_stat_2{std::make_shared<ThreadStat>()};
+
+  thread_stat_1->num_in_flight_requests_ = 3;
+  thread_stat_2->num_in_flight_requests_ = 4;
+
+  tlm.threads_stat_ = {thread_stat_1, thread_stat_2};
+
+  CHECK(tlm.GetNumInFlightRequests() == 7);
+  // Unlike the sent requests, the in-flight requests are not reset
+  CHECK(tlm.GetNumInFlightRequests() == 7);
+}
+
+TEST_CASE(
+    "send_request_rate_load_manager: testing the GetAndResetScheduleSkew "
+    "function")
+{
+  PerfAnalyzerParameters params{};
+
+  TestLoadManager tlm(params);
+
+  std::shared_ptr<ThreadStat> thread_stat_1{std::make_shared<ThreadStat>()};
+  std::shared_ptr<ThreadStat> thread_stat_2{std::make_shared<ThreadStat>()};
+
+  thread_stat_1->schedule_skew_.Record(10);
+  thread_stat_1->schedule_skew_.Record(20);
+  thread_stat_2->schedule_skew_.Record(30);
+
+  tlm.threads_stat_ = {thread_stat_1, thread_stat_2};
+
+  const LatencyHistogram result{tlm.GetAndResetScheduleSkew()};
+
+  CHECK(result.Count() == 3);
+  CHECK(result.Min() == 10);
+  CHECK(result.Max() == 30);
+  CHECK(tlm.threads_stat_[0]->schedule_skew_.Empty());
+  CHECK(tlm.threads_stat_[1]->schedule_skew_.Empty());
+}
+
 }}  // namespace triton::perfanalyzer
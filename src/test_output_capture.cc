@@ -0,0 +1,87 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdint>
+#include <vector>
+
+#include "doctest.h"
+#include "output_capture.h"
+
+namespace triton { namespace perfanalyzer {
+
+TEST_CASE("output_capture: sampler")
+{
+  SUBCASE("fixed policies")
+  {
+    OutputCaptureSampler none{{OutputCapturePolicy::None, 1}};
+    OutputCaptureSampler hash{{OutputCapturePolicy::Hash, 1}};
+    OutputCaptureSampler full{};
+    for (size_t i = 0; i < 10; i++) {
+      CHECK(none.Next() == OutputCapturePolicy::None);
+      CHECK(hash.Next() == OutputCapturePolicy::Hash);
+      CHECK(full.Next() == OutputCapturePolicy::Full);
+    }
+  }
+
+  SUBCASE("sampled")
+  {
+    const size_t num_requests{100000};
+    const uint64_t sample_rate{10};
+    OutputCaptureSampler sampler{
+        {OutputCapturePolicy::Sampled, sample_rate}, 1234};
+
+    size_t num_captured{0};
+    for (size_t i = 0; i < num_requests; i++) {
+      const auto policy{sampler.Next()};
+      REQUIRE(
+          (policy == OutputCapturePolicy::Full ||
+           policy == OutputCapturePolicy::None));
+      num_captured += (policy == OutputCapturePolicy::Full) ? 1 : 0;
+    }
+    CHECK(
+        num_captured ==
+        doctest::Approx(num_requests / sample_rate).epsilon(0.05));
+  }
+}
+
+TEST_CASE("output_capture: HashOutputData")
+{
+  const std::vector<uint8_t> data{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  const uint64_t hash{HashOutputData(data.data(), data.size())};
+
+  CHECK(hash == HashOutputData(data.data(), data.size()));
+
+  // Every prefix length hashes differently, covering the tail bytes
+  for (size_t size = 0; size < data.size(); size++) {
+    CHECK(HashOutputData(data.data(), size) != hash);
+  }
+
+  std::vector<uint8_t> changed{data};
+  changed[9] ^= 1;
+  CHECK(HashOutputData(changed.data(), changed.size()) != hash);
+}
+
+}}  // namespace triton::perfanalyzer
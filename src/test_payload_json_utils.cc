@@ -31,6 +31,7 @@
 #include <string>
 
 #include "doctest.h"
+#include "session_concurrency/chat_history.h"
 #include "session_concurrency/payload_json_utils.h"
 
 namespace triton::perfanalyzer {
@@ -50,16 +51,16 @@ TEST_CASE("PayloadJsonUtils::UpdateHistoryAndAddToPayload")
         }
         )"};
 
-    const std::string chat_history_raw{R"(
-        [
-          {
-            "role": "my_role_1",
-            "content": "my_content_1"
-          }
-        ]
+    const std::string previous_message_raw{R"(
+        {
+          "role": "my_role_1",
+          "content": "my_content_1"
+        }
         )"};
-    rapidjson::Document chat_history{};
-    chat_history.Parse(chat_history_raw.c_str());
+    rapidjson::Document previous_message{};
+    previous_message.Parse(previous_message_raw.c_str());
+    ChatHistory chat_history{};
+    chat_history.Append(previous_message);
 
     PayloadJsonUtils::UpdateHistoryAndAddToPayload(payload, chat_history);
 
@@ -100,13 +101,43 @@ TEST_CASE("PayloadJsonUtils::UpdateHistoryAndAddToPayload")
     rapidjson::Document expected_chat_history{};
     expected_chat_history.Parse(expected_chat_history_raw.c_str());
 
-    CHECK(chat_history == expected_chat_history);
+    rapidjson::Document chat_history_document{};
+    chat_history_document.Parse(
+        ("[" + chat_history.Messages() + "]").c_str());
+
+    CHECK(chat_history.Size() == 2);
+    CHECK(chat_history_document == expected_chat_history);
+  }
+
+  SUBCASE("other fields of the payload are kept around the history")
+  {
+    ChatHistory chat_history{};
+
+    std::string payload{
+        R"({"model":"m","messages":[{"role":"user","content":"a"}],)"
+        R"("max_tokens":8})"};
+    PayloadJsonUtils::UpdateHistoryAndAddToPayload(payload, chat_history);
+    CHECK(
+        payload == R"({"model":"m","messages":[{"role":"user","content":"a"}],)"
+                   R"("max_tokens":8})");
+
+    rapidjson::Document response_message{};
+    response_message.Parse(R"({"role":"assistant","content":"b"})");
+    chat_history.Append(response_message);
+
+    payload = R"({"messages":[{"role":"user","content":"c"}],"stream":true})";
+    PayloadJsonUtils::UpdateHistoryAndAddToPayload(payload, chat_history);
+    CHECK(
+        payload == R"({"messages":[{"role":"user","content":"a"},)"
+                   R"({"role":"assistant","content":"b"},)"
+                   R"({"role":"user","content":"c"}],"stream":true})");
+    CHECK(chat_history.Size() == 3);
   }
 
   SUBCASE("invalid payload - not parsable")
   {
     std::string payload{""};
-    rapidjson::Document chat_history{};
+    ChatHistory chat_history{};
 
     CHECK_THROWS_WITH_AS(
         PayloadJsonUtils::UpdateHistoryAndAddToPayload(payload, chat_history),
@@ -121,7 +152,7 @@ TEST_CASE("PayloadJsonUtils::UpdateHistoryAndAddToPayload")
           "messages": false
         }
         )"};
-    rapidjson::Document chat_history{};
+    ChatHistory chat_history{};
 
     CHECK_THROWS_WITH_AS(
         PayloadJsonUtils::UpdateHistoryAndAddToPayload(payload, chat_history),
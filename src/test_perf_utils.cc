@@ -26,6 +26,7 @@
 
 #include <unistd.h>
 
+#include <cmath>
 #include <cstdio>
 #include <fstream>
 
@@ -109,6 +110,71 @@ TEST_CASE("perf_utils: TestDistribution")
   }
 }
 
+/// Test the empirical moments of the distributions that take shape parameters
+///
+TEST_CASE("perf_utils: TestShapedDistribution")
+{
+  const double request_rate{1000};
+  const double expected_avg{NANOS_PER_SECOND / request_rate};
+  DistributionParams params{};
+
+  // Returns the average and the coefficient of variation of a million gaps
+  const auto moments{
+      [](std::function<std::chrono::nanoseconds(std::mt19937&)> dist_func) {
+        std::mt19937 schedule_rng;
+        std::vector<int64_t> delays;
+        for (int i = 0; i < 1000000; i++) {
+          delays.push_back(dist_func(schedule_rng).count());
+        }
+        const double avg{CalculateAverage(delays)};
+        // CalculateVariance returns the standard deviation
+        return std::make_pair(avg, CalculateVariance(delays, avg) / avg);
+      }};
+
+  SUBCASE("gamma")
+  {
+    for (const double cv : {0.5, 2.0}) {
+      params.cv = cv;
+      const auto [avg, actual_cv] =
+          moments(ScheduleDistribution<GAMMA>(request_rate, params));
+      CHECK(avg == doctest::Approx(expected_avg).epsilon(0.01));
+      CHECK(actual_cv == doctest::Approx(cv).epsilon(0.02));
+    }
+  }
+
+  SUBCASE("lognormal")
+  {
+    params.cv = 1.0;
+    const auto [avg, cv] =
+        moments(ScheduleDistribution<LOGNORMAL>(request_rate, params));
+    CHECK(avg == doctest::Approx(expected_avg).epsilon(0.01));
+    CHECK(cv == doctest::Approx(1.0).epsilon(0.02));
+  }
+
+  SUBCASE("pareto")
+  {
+    // The variance is only finite with a tail index greater than 2, and is
+    // only estimated reliably well above it
+    params.pareto_alpha = 5.0;
+    const auto [avg, cv] =
+        moments(ScheduleDistribution<PARETO>(request_rate, params));
+    CHECK(avg == doctest::Approx(expected_avg).epsilon(0.01));
+    CHECK(cv == doctest::Approx(std::sqrt(1.0 / (5.0 * 3.0))).epsilon(0.03));
+  }
+
+  SUBCASE("mmpp")
+  {
+    params.burst_ratio = 10.0;
+    params.burst_fraction = 0.1;
+    params.burst_ms = 5.0;
+    const auto [avg, cv] =
+        moments(ScheduleDistribution<MMPP>(request_rate, params));
+    CHECK(avg == doctest::Approx(expected_avg).epsilon(0.02));
+    // Bursts make the gaps overdispersed compared to a Poisson process
+    CHECK(cv > 1.3);
+  }
+}
+
 TEST_CASE("perf_utils: ParseTensorFormat")
 {
   CHECK(ParseTensorFormat("binary") == cb::TensorFormat::BINARY);
@@ -119,6 +185,39 @@ TEST_CASE("perf_utils: ParseTensorFormat")
   CHECK(ParseTensorFormat("") == cb::TensorFormat::UNKNOWN);
 }
 
+TEST_CASE("perf_utils: SplitString")
+{
+  CHECK(SplitString("1:2:3") == std::vector<std::string>{"1", "2", "3"});
+  CHECK(SplitString("a=1,b=2", ",") == std::vector<std::string>{"a=1", "b=2"});
+  CHECK(SplitString("") == std::vector<std::string>{""});
+  CHECK(SplitString("a,", ",") == std::vector<std::string>{"a", ""});
+}
+
+TEST_CASE("perf_utils: SplitKeyValue")
+{
+  CHECK(SplitKeyValue("a=1") == std::pair<std::string, std::string>{"a", "1"});
+  CHECK(SplitKeyValue("a=") == std::pair<std::string, std::string>{"a", ""});
+  CHECK(
+      SplitKeyValue("a=b=c") ==
+      std::pair<std::string, std::string>{"a", "b=c"});
+  CHECK_THROWS_WITH_AS(
+      SplitKeyValue("a"), "'a' does not match <key=value>.",
+      std::invalid_argument);
+}
+
+TEST_CASE("perf_utils: ParseNumber")
+{
+  CHECK(ParseNumber("10") == 10);
+  CHECK(ParseNumber("0.5") == 0.5);
+  CHECK(ParseNumber("-2e3") == -2000);
+  CHECK_THROWS_WITH_AS(
+      ParseNumber("10x"), "'10x' is not a number.", std::invalid_argument);
+  CHECK_THROWS_WITH_AS(
+      ParseNumber("abc"), "'abc' is not a number.", std::invalid_argument);
+  CHECK_THROWS_WITH_AS(
+      ParseNumber(""), "'' is not a number.", std::invalid_argument);
+}
+
 TEST_CASE("perf_utils: ParseProtocol")
 {
   CHECK(ParseProtocol("HTTP") == cb::ProtocolType::HTTP);
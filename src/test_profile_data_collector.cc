@@ -39,7 +39,7 @@ TEST_CASE("profile_data_collector: FindExperiment")
   it = collector.FindExperiment(infer_mode1);
   CHECK(it == collector.experiments_.end());
 
-  std::vector<RequestRecord> request_records{RequestRecord{}};
+  RequestRecordStore request_records{{RequestRecord{}}};
   collector.AddData(infer_mode1, std::move(request_records));
 
   it = collector.FindExperiment(infer_mode1);
@@ -155,12 +155,13 @@ TEST_CASE("profile_data_collector: AddData")
       sequence_id2,
       false};
 
-  std::vector<RequestRecord> request_records{request_record1, request_record2};
+  RequestRecordStore request_records{{request_record1, request_record2}};
   collector.AddData(infer_mode, std::move(request_records));
 
   CHECK(!collector.experiments_.empty());
 
-  std::vector<RequestRecord> rr{collector.experiments_[0].requests};
+  std::vector<RequestRecord> rr{
+      collector.experiments_[0].requests.GetRecords()};
   CHECK(rr[0].sequence_id_ == sequence_id1);
   CHECK(rr[0].start_time_ == request1_timestamp);
   CHECK(rr[0].request_inputs_[0] == request1_request_input);
@@ -198,4 +199,80 @@ TEST_CASE("profile_data_collector: AddWindow")
   CHECK(collector.experiments_[0].window_boundaries[3] == window_end2);
 }
 
+TEST_CASE("profile_data_collector: AddLatencyHistogram")
+{
+  MockProfileDataCollector collector{};
+  ProfileDataCollector::InferenceLoadMode infer_mode{10, 20.0};
+
+  LatencyHistogram window1{2};
+  window1.Record(100);
+  window1.Record(200);
+  collector.AddLatencyHistogram(infer_mode, window1);
+
+  REQUIRE(!collector.experiments_.empty());
+  const auto& histogram{collector.experiments_[0].latency_histogram};
+  CHECK(histogram.SignificantDigits() == 2);
+  CHECK(histogram.Count() == 2);
+
+  LatencyHistogram window2{2};
+  window2.Record(300);
+  collector.AddLatencyHistogram(infer_mode, window2);
+
+  CHECK(histogram.Count() == 3);
+  CHECK(histogram.Min() == 100);
+  CHECK(histogram.Max() == 300);
+  CHECK(collector.experiments_[0].corrected_latency_histogram.Empty());
+
+  LatencyHistogram window3{2};
+  window3.Record(400);
+  LatencyHistogram corrected3{2};
+  corrected3.Record(900);
+  collector.AddLatencyHistogram(infer_mode, window3, corrected3);
+
+  const auto& corrected{
+      collector.experiments_[0].corrected_latency_histogram};
+  CHECK(histogram.Count() == 4);
+  CHECK(corrected.SignificantDigits() == 2);
+  CHECK(corrected.Count() == 1);
+  CHECK(corrected.Max() == 900);
+}
+
+TEST_CASE("profile_data_collector: AddTimeline")
+{
+  MockProfileDataCollector collector{};
+  ProfileDataCollector::InferenceLoadMode infer_mode{0, 20.0};
+
+  std::vector<ProfileDataCollector::TimelineSecond> window1(1);
+  window1[0].target_request_count = 20;
+  window1[0].sent_count = 18;
+  window1[0].completed_count = 17;
+  window1[0].latency_histogram.Record(100);
+  collector.AddTimeline(infer_mode, std::move(window1));
+
+  REQUIRE(!collector.experiments_.empty());
+  const auto& timeline{collector.experiments_[0].timeline};
+  REQUIRE(timeline.size() == 1);
+  CHECK(timeline[0].sent_count == 18);
+
+  // A later window that runs past the first one extends the timeline
+  std::vector<ProfileDataCollector::TimelineSecond> window2(2);
+  window2[0].target_request_count = 20;
+  window2[0].sent_count = 2;
+  window2[0].completed_count = 3;
+  window2[0].latency_histogram.Record(300);
+  window2[1].target_request_count = 40;
+  window2[1].sent_count = 39;
+  collector.AddTimeline(infer_mode, std::move(window2));
+
+  REQUIRE(timeline.size() == 2);
+  CHECK(timeline[0].target_request_count == doctest::Approx(20));
+  CHECK(timeline[0].sent_count == 20);
+  CHECK(timeline[0].completed_count == 20);
+  CHECK(timeline[0].latency_histogram.Count() == 2);
+  CHECK(timeline[0].latency_histogram.Max() == 300);
+  CHECK(timeline[1].target_request_count == doctest::Approx(40));
+  CHECK(timeline[1].sent_count == 39);
+  CHECK(timeline[1].latency_histogram.Empty());
+}
+
 }}  // namespace triton::perfanalyzer
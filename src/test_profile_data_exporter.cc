@@ -115,7 +115,7 @@ TEST_CASE("profile_data_exporter: ConvertToJson")
       false,
       sequence_id,
       false};
-  std::vector<RequestRecord> requests{request_record};
+  RequestRecordStore requests{{request_record}};
   std::vector<uint64_t> window_boundaries{1, 5, 6};
 
   ProfileDataCollector::Experiment experiment;
@@ -183,6 +183,8 @@ TEST_CASE("profile_data_exporter: ConvertToJson")
 
   CHECK(actual_request["timestamp"] == expected_request["timestamp"]);
   CHECK(actual_request["sequence_id"] == expected_request["sequence_id"]);
+  // The request was not sent on a schedule
+  CHECK(!actual_request.HasMember("scheduled_timestamp"));
 
 
   CHECK(
@@ -406,6 +408,45 @@ TEST_CASE("profile_data_exporter: AddExperiment")
   }
 }
 
+TEST_CASE("profile_data_exporter: AddTimeline")
+{
+  MockProfileDataExporter exporter{};
+  rapidjson::Value entry(rapidjson::kObjectType);
+
+  SUBCASE("No load curve")
+  {
+    exporter.AddTimeline(
+        entry, std::vector<ProfileDataCollector::TimelineSecond>{});
+    CHECK(!entry.HasMember("timeline"));
+  }
+
+  SUBCASE("Load curve")
+  {
+    std::vector<ProfileDataCollector::TimelineSecond> timeline(2);
+    timeline[0].target_request_count = 10.5;
+    timeline[0].sent_count = 10;
+    timeline[0].completed_count = 9;
+    timeline[0].latency_histogram.Record(1000);
+    timeline[0].latency_histogram.Record(3000);
+    timeline[1].target_request_count = 20;
+    timeline[1].sent_count = 19;
+
+    exporter.AddTimeline(entry, timeline);
+    REQUIRE(entry.HasMember("timeline"));
+    const auto& seconds{entry["timeline"]};
+    REQUIRE(seconds.Size() == 2);
+    CHECK(seconds[0]["target_request_rate"].GetDouble() == 10.5);
+    CHECK(seconds[0]["send_request_rate"].GetUint64() == 10);
+    CHECK(seconds[0]["throughput"].GetUint64() == 9);
+    CHECK(seconds[0]["avg_latency_ns"].GetUint64() == 2000);
+    CHECK(seconds[0].HasMember("p99_latency_ns"));
+    CHECK(seconds[1]["send_request_rate"].GetUint64() == 19);
+    CHECK(seconds[1]["throughput"].GetUint64() == 0);
+    // No requests completed to measure the latency of
+    CHECK(!seconds[1].HasMember("avg_latency_ns"));
+  }
+}
+
 TEST_CASE("profile_data_exporter: OutputToFile")
 {
   MockProfileDataExporter exporter{};
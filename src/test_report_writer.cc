@@ -37,6 +37,11 @@ class TestReportWriter : ReportWriter {
   {
     ReportWriter::WriteGpuMetrics(ofs, metrics);
   }
+
+  void WriteLatencyHistogram(std::ostream& ofs, const PerfStatus& status)
+  {
+    ReportWriter::WriteLatencyHistogram(ofs, status);
+  }
 };
 
 TEST_CASE("testing WriteGpuMetrics")
@@ -90,4 +95,20 @@ TEST_CASE("testing WriteGpuMetrics")
   }
 }
 
+TEST_CASE("testing WriteLatencyHistogram")
+{
+  TestReportWriter trw{};
+  PerfStatus status{};
+  status.concurrency = 4;
+  status.client_stats.latency_histogram.Record(5);
+  status.client_stats.latency_histogram.Record(5);
+  status.client_stats.latency_histogram.Record(3000);
+  std::ostringstream actual_output{};
+
+  trw.WriteLatencyHistogram(actual_output, status);
+
+  const std::string expected_output{"4,5,5,2\n4,3000,3001,1\n"};
+  CHECK(actual_output.str() == expected_output);
+}
+
 }}  // namespace triton::perfanalyzer
@@ -0,0 +1,228 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "request_dispatcher.h"
+#include "timing_wheel.h"
+#include "work_stealing_queue.h"
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+}  // namespace
+
+TEST_CASE("timing_wheel: releases items at their deadline")
+{
+  const auto origin{steady_clock::now()};
+  TimingWheel<int> wheel{microseconds(10), 8, origin};
+  std::vector<TimingWheel<int>::Entry> expired;
+
+  REQUIRE(wheel.Insert(origin + microseconds(35), 2));
+  REQUIRE(wheel.Insert(origin + microseconds(12), 1));
+  REQUIRE(wheel.Insert(origin + microseconds(38), 3));
+  CHECK(wheel.Size() == 3);
+  CHECK(*wheel.NextExpiry() == origin + microseconds(12));
+
+  SUBCASE("nothing is due yet")
+  {
+    CHECK(wheel.Advance(origin + microseconds(11), expired) == 0);
+    CHECK(expired.empty());
+  }
+  SUBCASE("only the due items of a tick are released")
+  {
+    CHECK(wheel.Advance(origin + microseconds(36), expired) == 2);
+    REQUIRE(expired.size() == 2);
+    CHECK(expired[0].item == 1);
+    CHECK(expired[1].item == 2);
+    CHECK(wheel.Size() == 1);
+    CHECK(*wheel.NextExpiry() == origin + microseconds(38));
+
+    CHECK(wheel.Advance(origin + microseconds(38), expired) == 1);
+    REQUIRE(expired.size() == 3);
+    CHECK(expired[2].item == 3);
+    CHECK(!wheel.NextExpiry());
+  }
+  SUBCASE("advancing past a whole turn releases everything in order")
+  {
+    CHECK(wheel.Advance(origin + milliseconds(1), expired) == 3);
+    REQUIRE(expired.size() == 3);
+    CHECK(expired[0].item == 1);
+    CHECK(expired[1].item == 2);
+    CHECK(expired[2].item == 3);
+    CHECK(wheel.Size() == 0);
+  }
+}
+
+TEST_CASE("timing_wheel: holds up to one turn ahead")
+{
+  const auto origin{steady_clock::now()};
+  TimingWheel<int> wheel{microseconds(10), 8, origin};
+  std::vector<TimingWheel<int>::Entry> expired;
+
+  CHECK(wheel.Span() == microseconds(80));
+  CHECK(wheel.Insert(origin + microseconds(79), 1));
+  CHECK_FALSE(wheel.Insert(origin + microseconds(80), 2));
+
+  // Once the wheel has turned, the slot of the first tick is reused
+  wheel.Advance(origin + microseconds(20), expired);
+  CHECK(wheel.Insert(origin + microseconds(80), 2));
+  CHECK(wheel.Insert(origin + microseconds(99), 3));
+  CHECK_FALSE(wheel.Insert(origin + microseconds(100), 4));
+
+  // Items that are already late are released by the next advance
+  CHECK(wheel.Insert(origin, 5));
+  CHECK(wheel.Advance(origin + microseconds(21), expired) == 1);
+  CHECK(expired.back().item == 5);
+}
+
+TEST_CASE("work_stealing_queue: owners take their own items first")
+{
+  WorkStealingQueue<int> queue{3};
+  int item{0};
+
+  queue.Push(0, 1);
+  queue.Push(1, 2);
+  queue.Push(0, 3);
+  CHECK(queue.Size() == 3);
+
+  REQUIRE(queue.TryPop(1, item));
+  CHECK(item == 2);
+
+  // Owner 2 has nothing of its own, so it steals the oldest item of the next
+  // lane that has one
+  REQUIRE(queue.TryPop(2, item));
+  CHECK(item == 1);
+  REQUIRE(queue.TryPop(1, item));
+  CHECK(item == 3);
+
+  CHECK_FALSE(queue.TryPop(0, item));
+  CHECK(queue.Size() == 0);
+
+  queue.Push(2, 4);
+  queue.Clear();
+  CHECK(queue.Size() == 0);
+  CHECK_FALSE(queue.TryPop(2, item));
+}
+
+TEST_CASE("work_stealing_queue: waiting consumers are woken up")
+{
+  WorkStealingQueue<int> queue{2};
+  int item{0};
+
+  CHECK_FALSE(queue.WaitPop(0, item, milliseconds(1)));
+
+  std::thread producer([&queue]() {
+    std::this_thread::sleep_for(milliseconds(10));
+    queue.Push(1, 7);
+  });
+  CHECK(queue.WaitPop(0, item, std::chrono::seconds(10)));
+  CHECK(item == 7);
+  producer.join();
+}
+
+class TestRequestDispatcher {
+ public:
+  static std::chrono::nanoseconds Tick(const RequestDispatcher& dispatcher)
+  {
+    return dispatcher.tick_;
+  }
+};
+
+TEST_CASE("request_dispatcher: releases every schedule on time")
+{
+  const size_t num_workers{3};
+  const milliseconds interval{3};
+  const size_t num_requests{10};
+
+  // Worker i sends every interval, offset by i milliseconds
+  std::vector<RateSchedulePtr_t> schedules;
+  for (size_t i = 0; i < num_workers; i++) {
+    auto schedule{std::make_shared<RateSchedule>()};
+    schedule->intervals = {milliseconds(i + 1)};
+    schedule->duration = interval;
+    schedules.push_back(schedule);
+  }
+
+  auto queue{std::make_shared<DispatchQueue>(num_workers)};
+  RequestPacing pacing{};
+  pacing.strategy = PacingStrategy::Deadline;
+  RequestDispatcher dispatcher{queue, pacing};
+  CHECK(TestRequestDispatcher::Tick(dispatcher) == microseconds(50));
+  dispatcher.SetSchedules(schedules);
+
+  const auto start{steady_clock::now()};
+  dispatcher.Start(start);
+
+  // One consumer takes every request, stealing those of the other workers
+  std::vector<steady_clock::time_point> deadlines;
+  steady_clock::time_point deadline;
+  while (deadlines.size() < num_requests &&
+         queue->WaitPop(0, deadline, std::chrono::seconds(10))) {
+    CHECK(steady_clock::now() >= deadline);
+    deadlines.push_back(deadline);
+  }
+  dispatcher.Stop();
+
+  REQUIRE(deadlines.size() == num_requests);
+  for (size_t i = 0; i < num_requests; i++) {
+    const auto expected{
+        start + milliseconds(i % num_workers + 1) +
+        interval * (i / num_workers)};
+    CHECK(deadlines[i] == expected);
+  }
+
+  // Nothing more is released once stopped
+  const size_t remaining{queue->Size()};
+  std::this_thread::sleep_for(2 * interval);
+  CHECK(queue->Size() == remaining);
+}
+
+TEST_CASE("request_dispatcher: skips empty schedules")
+{
+  auto queue{std::make_shared<DispatchQueue>(2)};
+  RequestDispatcher dispatcher{queue, RequestPacing{}};
+
+  auto schedule{std::make_shared<RateSchedule>()};
+  schedule->intervals = {milliseconds(1)};
+  schedule->duration = milliseconds(1);
+  dispatcher.SetSchedules({std::make_shared<RateSchedule>(), schedule});
+
+  dispatcher.Start(steady_clock::now());
+  steady_clock::time_point deadline;
+  CHECK(queue->WaitPop(0, deadline, std::chrono::seconds(10)));
+  dispatcher.Stop();
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,98 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+
+#include "doctest.h"
+#include "request_pacer.h"
+
+namespace triton { namespace perfanalyzer {
+
+TEST_CASE("request_pacer: waits until the deadline")
+{
+  using std::chrono::steady_clock;
+  const std::chrono::milliseconds interval{2};
+  const size_t num_requests{20};
+
+  RequestPacing pacing{};
+  SUBCASE("sleep")
+  {
+    pacing.strategy = PacingStrategy::Sleep;
+  }
+  SUBCASE("hybrid")
+  {
+    pacing.strategy = PacingStrategy::Hybrid;
+  }
+  SUBCASE("deadline")
+  {
+    pacing.strategy = PacingStrategy::Deadline;
+  }
+
+  RequestPacer pacer{pacing};
+  const auto start{steady_clock::now()};
+  for (size_t i = 1; i <= num_requests; i++) {
+    const auto deadline{start + i * interval};
+    pacer.WaitUntil(deadline);
+    CHECK(steady_clock::now() >= deadline);
+  }
+}
+
+TEST_CASE("request_pacer: past deadlines do not block")
+{
+  using std::chrono::steady_clock;
+  for (const auto strategy :
+       {PacingStrategy::Sleep, PacingStrategy::Hybrid,
+        PacingStrategy::Deadline, PacingStrategy::Batched}) {
+    RequestPacer pacer{{strategy, std::chrono::microseconds(100)}};
+    const auto start{steady_clock::now()};
+    pacer.WaitUntil(start - std::chrono::seconds(1));
+    CHECK(steady_clock::now() - start < std::chrono::milliseconds(100));
+  }
+}
+
+TEST_CASE("request_pacer: batched releases within the slack")
+{
+  using std::chrono::steady_clock;
+  const std::chrono::milliseconds slack{50};
+  RequestPacer pacer{{PacingStrategy::Batched, slack}};
+
+  const auto start{steady_clock::now()};
+  const auto first{start + std::chrono::milliseconds(5)};
+  pacer.WaitUntil(first);
+  const auto woke_up{steady_clock::now()};
+  CHECK(woke_up >= first);
+
+  // Due within the slack of the first wake-up, so released immediately
+  pacer.WaitUntil(first + std::chrono::milliseconds(40));
+  CHECK(steady_clock::now() - woke_up < std::chrono::milliseconds(40));
+
+  // Due after the release window, so waited for
+  const auto later{first + std::chrono::milliseconds(60)};
+  pacer.WaitUntil(later);
+  CHECK(steady_clock::now() >= later);
+}
+
+}}  // namespace triton::perfanalyzer
@@ -58,11 +58,10 @@ class TestRequestRateManager : public TestLoadManagerBase,
         TestLoadManagerBase(params, is_sequence_model, is_decoupled_model),
         RequestRateManager(
             params.async, params.streaming, params.request_distribution,
-            params.batch_size, params.measurement_window_ms, params.max_trials,
-            params.max_threads, params.num_of_sequences,
+            params.batch_size, params.max_threads, params.num_of_sequences,
             params.shared_memory_type, params.output_shm_size,
             params.serial_sequences, GetParser(), GetFactory(),
-            params.request_parameters)
+            params.request_parameters, params.request_distribution_params)
   {
   }
 
@@ -160,24 +159,185 @@ class TestRequestRateManager : public TestLoadManagerBase,
     ConfigureThreads();
     GenerateSchedule(rate);
 
-    std::vector<uint32_t> worker_schedule_sizes;
+    std::vector<double> worker_schedule_rates;
     uint32_t total_num_seqs{0};
 
     for (auto worker : workers_) {
       auto w = std::dynamic_pointer_cast<RequestRateWorker>(worker);
       total_num_seqs += w->thread_config_->num_sequences_;
-      worker_schedule_sizes.push_back(w->schedule_->intervals.size());
+      worker_schedule_rates.push_back(GetScheduleRate(*w->schedule_));
     }
     early_exit = true;
 
     CHECK(num_of_sequences_ == total_num_seqs);
-    for (int i = 0; i < worker_schedule_sizes.size() - 1; i++) {
+    for (int i = 0; i < worker_schedule_rates.size() - 1; i++) {
       CHECK(
-          worker_schedule_sizes[i] / expected_worker_ratio[i] ==
-          worker_schedule_sizes[i + 1] / expected_worker_ratio[i + 1]);
+          worker_schedule_rates[i] / expected_worker_ratio[i] ==
+          doctest::Approx(
+              worker_schedule_rates[i + 1] / expected_worker_ratio[i + 1])
+              .epsilon(0.05));
     }
   }
 
+  /// Test that the schedules of all the workers together form a Poisson
+  /// process of the given rate, and that they are the same every time they
+  /// are generated
+  void TestPoissonSchedule(double rate)
+  {
+    PauseWorkers();
+    ConfigureThreads();
+
+    const nanoseconds schedule_duration{10 * NANOS_PER_SECOND};
+    std::vector<nanoseconds> first_timestamps{};
+    std::vector<int64_t> timestamps{};
+    GenerateSchedule(rate);
+    for (auto worker : workers_) {
+      auto w = std::dynamic_pointer_cast<RequestRateWorker>(worker);
+      REQUIRE(w->schedule_->IsGenerated());
+      CHECK(w->schedule_->intervals.empty());
+      nanoseconds timestamp{w->GetNextTimestamp()};
+      first_timestamps.push_back(timestamp);
+      while (timestamp < schedule_duration) {
+        timestamps.push_back(timestamp.count());
+        timestamp = w->GetNextTimestamp();
+      }
+    }
+
+    GenerateSchedule(rate);
+    for (size_t i = 0; i < workers_.size(); i++) {
+      auto w = std::dynamic_pointer_cast<RequestRateWorker>(workers_[i]);
+      CHECK(w->GetNextTimestamp() == first_timestamps[i]);
+    }
+    early_exit = true;
+
+    std::sort(timestamps.begin(), timestamps.end());
+    std::vector<int64_t> gaps{};
+    for (size_t i = 1; i < timestamps.size(); i++) {
+      gaps.push_back(timestamps[i] - timestamps[i - 1]);
+    }
+    const double gap_average{CalculateAverage(gaps)};
+    // CalculateVariance returns the standard deviation, which is equal to the
+    // mean for exponentially distributed gaps
+    const double gap_std_dev{CalculateVariance(gaps, gap_average)};
+
+    CHECK(
+        gap_average ==
+        doctest::Approx(NANOS_PER_SECOND / rate).epsilon(0.03));
+    CHECK(gap_std_dev == doctest::Approx(gap_average).epsilon(0.03));
+  }
+
+  /// Test that the schedules of all the workers share one stream with the
+  /// given rate and coefficient of variation, dealt out in thread id order
+  void TestSharedSchedule(double rate, double expected_cv)
+  {
+    PauseWorkers();
+    ConfigureThreads();
+
+    const nanoseconds schedule_duration{20 * NANOS_PER_SECOND};
+    const std::vector<size_t> thread_ids{CalculateThreadIds()};
+    std::vector<int64_t> timestamps{};
+    std::vector<size_t> worker_counts(workers_.size(), 0);
+    std::vector<nanoseconds> next_timestamps{};
+    GenerateSchedule(rate);
+    for (auto worker : workers_) {
+      auto w = std::dynamic_pointer_cast<RequestRateWorker>(worker);
+      REQUIRE(w->schedule_->IsGenerated());
+      next_timestamps.push_back(w->GetNextTimestamp());
+    }
+    // Drain the workers in turns of a second each, so that the stream has to
+    // hold the timestamps of the other workers until they ask for them
+    const nanoseconds turn{NANOS_PER_SECOND};
+    for (nanoseconds turn_end{turn}; turn_end <= schedule_duration;
+         turn_end += turn) {
+      for (size_t i = 0; i < workers_.size(); i++) {
+        auto w = std::dynamic_pointer_cast<RequestRateWorker>(workers_[i]);
+        while (next_timestamps[i] < turn_end) {
+          timestamps.push_back(next_timestamps[i].count());
+          worker_counts[i]++;
+          next_timestamps[i] = w->GetNextTimestamp();
+        }
+      }
+    }
+    early_exit = true;
+
+    for (size_t i = 0; i < workers_.size(); i++) {
+      const double expected_share{
+          static_cast<double>(
+              std::count(thread_ids.begin(), thread_ids.end(), i)) /
+          thread_ids.size()};
+      CHECK(
+          worker_counts[i] ==
+          doctest::Approx(expected_share * timestamps.size()).epsilon(0.01));
+    }
+
+    std::sort(timestamps.begin(), timestamps.end());
+    std::vector<int64_t> gaps{};
+    for (size_t i = 1; i < timestamps.size(); i++) {
+      gaps.push_back(timestamps[i] - timestamps[i - 1]);
+    }
+    const double gap_average{CalculateAverage(gaps)};
+    // CalculateVariance returns the standard deviation
+    const double gap_std_dev{CalculateVariance(gaps, gap_average)};
+
+    CHECK(
+        gap_average ==
+        doctest::Approx(NANOS_PER_SECOND / rate).epsilon(0.03));
+    CHECK(
+        gap_std_dev / gap_average ==
+        doctest::Approx(expected_cv).epsilon(0.05));
+  }
+
+  /// Test that the schedules of all the workers together follow the load
+  /// curve, putting a request wherever the curve reaches a whole number of
+  /// requests with the constant distribution
+  void TestLoadCurveSchedule(const LoadCurve& load_curve)
+  {
+    PauseWorkers();
+    ConfigureThreads();
+    SetLoadCurve(std::make_shared<const LoadCurve>(load_curve));
+
+    const nanoseconds curve_duration{std::chrono::duration_cast<nanoseconds>(
+        std::chrono::duration<double>(load_curve.Duration()))};
+    std::vector<int64_t> timestamps{};
+    // The rate the schedule is generated with is ignored
+    GenerateSchedule(1);
+    for (auto worker : workers_) {
+      auto w = std::dynamic_pointer_cast<RequestRateWorker>(worker);
+      REQUIRE(w->schedule_->IsGenerated());
+      nanoseconds timestamp{w->GetNextTimestamp()};
+      // Allow for the last request to be rounded past the end of the curve
+      while (timestamp <= curve_duration + milliseconds(1)) {
+        timestamps.push_back(timestamp.count());
+        timestamp = w->GetNextTimestamp();
+      }
+    }
+    early_exit = true;
+
+    std::sort(timestamps.begin(), timestamps.end());
+    REQUIRE(timestamps.size() == load_curve.ExpectedRequestCount());
+    for (size_t i = 0; i < timestamps.size(); i++) {
+      CHECK(
+          timestamps[i] / static_cast<double>(NANOS_PER_SECOND) ==
+          doctest::Approx(load_curve.TimeOfRequests(i + 1)));
+    }
+  }
+
+  /// Returns the number of timestamps per second of the given schedule
+  static double GetScheduleRate(RateSchedule& schedule)
+  {
+    if (!schedule.IsGenerated()) {
+      return schedule.intervals.size() /
+             std::chrono::duration<double>(schedule.duration).count();
+    }
+    const size_t num_timestamps{20000};
+    nanoseconds last_timestamp{0};
+    for (size_t i = 0; i < num_timestamps; i++) {
+      last_timestamp = schedule.Next();
+    }
+    return num_timestamps /
+           std::chrono::duration<double>(last_timestamp).count();
+  }
+
   /// Test that the correct Infer function is called in the backend
   ///
   void TestInferType()
@@ -687,6 +847,149 @@ TEST_CASE("request_rate_schedule")
   trrm.TestSchedule(rate, params);
 }
 
+TEST_CASE("request_rate_poisson_schedule")
+{
+  PerfAnalyzerParameters params;
+  params.request_distribution = POISSON;
+  bool is_sequence = false;
+  bool is_decoupled = false;
+  bool use_mock_infer = true;
+
+  SUBCASE("one thread")
+  {
+    params.max_threads = 1;
+  }
+  SUBCASE("four threads")
+  {
+    params.max_threads = 4;
+  }
+  SUBCASE("uneven sequences")
+  {
+    is_sequence = true;
+    params.max_threads = 4;
+    params.num_of_sequences = 7;
+  }
+
+  TestRequestRateManager trrm(
+      params, is_sequence, is_decoupled, use_mock_infer);
+
+  trrm.InitManager(
+      params.string_length, params.string_data, params.zero_input,
+      params.user_data, params.start_sequence_id, params.sequence_id_range,
+      params.sequence_length, params.sequence_length_specified,
+      params.sequence_length_variation);
+  trrm.TestPoissonSchedule(1000);
+}
+
+/// Check that the request rate follows the load curve over the schedule of all
+/// the workers
+///
+TEST_CASE("request_rate_load_curve_schedule")
+{
+  PerfAnalyzerParameters params;
+  params.request_distribution = CONSTANT;
+  bool is_sequence = false;
+  bool is_decoupled = false;
+  bool use_mock_infer = true;
+
+  SUBCASE("one thread")
+  {
+    params.max_threads = 1;
+  }
+  SUBCASE("four threads")
+  {
+    params.max_threads = 4;
+  }
+
+  TestRequestRateManager trrm(
+      params, is_sequence, is_decoupled, use_mock_infer);
+
+  trrm.InitManager(
+      params.string_length, params.string_data, params.zero_input,
+      params.user_data, params.start_sequence_id, params.sequence_id_range,
+      params.sequence_length, params.sequence_length_specified,
+      params.sequence_length_variation);
+  trrm.TestLoadCurveSchedule(LoadCurve::Parse("linear:0=10,5=100,5=50,8=50"));
+}
+
+/// Check that the bursty and heavy-tailed distributions are drawn as one stream
+/// shared by all the workers, which keeps its shape once the workers are
+/// combined
+///
+TEST_CASE("request_rate_shared_schedule")
+{
+  PerfAnalyzerParameters params;
+  params.request_distribution = GAMMA;
+  params.request_distribution_params.cv = 2.0;
+  bool is_sequence = false;
+  bool is_decoupled = false;
+  bool use_mock_infer = true;
+
+  SUBCASE("one thread")
+  {
+    params.max_threads = 1;
+  }
+  SUBCASE("four threads")
+  {
+    params.max_threads = 4;
+  }
+  SUBCASE("uneven sequences")
+  {
+    is_sequence = true;
+    params.max_threads = 4;
+    params.num_of_sequences = 7;
+  }
+
+  TestRequestRateManager trrm(
+      params, is_sequence, is_decoupled, use_mock_infer);
+
+  trrm.InitManager(
+      params.string_length, params.string_data, params.zero_input,
+      params.user_data, params.start_sequence_id, params.sequence_id_range,
+      params.sequence_length, params.sequence_length_specified,
+      params.sequence_length_variation);
+  trrm.TestSharedSchedule(1000, 2.0);
+}
+
+/// Check that a consumer that stops asking for timestamps holds at most
+/// MAX_LAG of them, with the ones dealt to it past that going to the
+/// consumer asking, so that none of the stream is lost
+///
+TEST_CASE("request_rate_shared_stream: slow consumer")
+{
+  int64_t count{0};
+  auto stream{std::make_shared<SharedRateStream>(
+      [&count]() { return nanoseconds(++count); }, std::vector<size_t>{0, 1},
+      2)};
+  RateSchedule fast_schedule(stream, 0);
+  RateSchedule slow_schedule(stream, 1);
+  const int64_t max_lag{SharedRateStream::MAX_LAG};
+
+  std::vector<int64_t> fast_timestamps{};
+  for (int64_t i = 0; i < 4 * max_lag; i++) {
+    fast_timestamps.push_back(fast_schedule.Next().count());
+  }
+  REQUIRE(std::is_sorted(fast_timestamps.begin(), fast_timestamps.end()));
+  CHECK(count < 5 * max_lag + SharedRateStream::BLOCK_SIZE);
+
+  // The slow consumer gets the share it was dealt up to the limit, and then
+  // carries on after the timestamps the fast consumer took in its place
+  std::vector<int64_t> slow_timestamps{};
+  for (int64_t i = 0; i < max_lag; i++) {
+    slow_timestamps.push_back(slow_schedule.Next().count());
+    CHECK(slow_timestamps.back() == 2 * (i + 1));
+  }
+  CHECK(slow_schedule.Next().count() > fast_timestamps.back());
+
+  std::vector<int64_t> all_timestamps{fast_timestamps};
+  all_timestamps.insert(
+      all_timestamps.end(), slow_timestamps.begin(), slow_timestamps.end());
+  std::sort(all_timestamps.begin(), all_timestamps.end());
+  for (size_t i = 0; i < all_timestamps.size(); i++) {
+    REQUIRE(all_timestamps[i] == static_cast<int64_t>(i + 1));
+  }
+}
+
 /// Check that the correct inference function calls
 /// are used given different param values for async and stream
 ///
@@ -747,8 +1050,19 @@ TEST_CASE("request_rate_distribution")
   {
     params.request_distribution = POISSON;
   }
+  SUBCASE("constant dispatched from a timing wheel")
+  {
+    params.request_distribution = CONSTANT;
+    params.request_pacing.dispatch = RequestDispatch::TimingWheel;
+  }
+  SUBCASE("poisson dispatched from a timing wheel")
+  {
+    params.request_distribution = POISSON;
+    params.request_pacing.dispatch = RequestDispatch::TimingWheel;
+  }
 
   TestRequestRateManager trrm(params);
+  trrm.SetRequestPacing(params.request_pacing);
 
   trrm.InitManager(
       params.string_length, params.string_data, params.zero_input,
@@ -0,0 +1,316 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "request_record.h"
+#include "request_record_handoff.h"
+#include "request_record_store.h"
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+using time_point = std::chrono::time_point<std::chrono::system_clock>;
+using ns = std::chrono::nanoseconds;
+
+RequestRecord
+MakeRequestRecord(
+    uint64_t start_ns, std::vector<uint64_t> response_ns,
+    bool has_null_last_response = false, uint64_t sequence_id = 0)
+{
+  std::vector<time_point> response_timestamps{};
+  for (const auto timestamp : response_ns) {
+    response_timestamps.emplace_back(ns(timestamp));
+  }
+
+  RequestRecord::RequestInput request_input{};
+  request_input.emplace(
+      "INPUT0", RecordData(std::vector<uint8_t>{1, 2, 3, 4}, "UINT8"));
+
+  std::vector<RequestRecord::ResponseOutput> response_outputs{};
+  for (size_t i = 0; i < response_ns.size(); i++) {
+    RequestRecord::ResponseOutput response_output{};
+    response_output.emplace(
+        "OUTPUT0",
+        RecordData(std::vector<uint8_t>{static_cast<uint8_t>(i)}, "UINT8"));
+    response_outputs.push_back(std::move(response_output));
+  }
+
+  return RequestRecord(
+      time_point(ns(start_ns)), std::move(response_timestamps),
+      {request_input}, std::move(response_outputs), true, false, sequence_id,
+      has_null_last_response);
+}
+
+}  // namespace
+
+TEST_CASE("request_record_store: push_back and GetRecord round trip")
+{
+  const auto record{MakeRequestRecord(1, {2, 3}, false, 7)};
+
+  RequestRecordStore store{};
+  store.push_back(record);
+
+  REQUIRE(store.size() == 1);
+  CHECK(store.StartNs(0) == 1);
+  CHECK(store.EndNs(0) == 3);
+  CHECK(store.SequenceId(0) == 7);
+  CHECK(store.ScheduledNs(0) == 0);
+  CHECK(store.SequenceEnd(0));
+  CHECK_FALSE(store.Delayed(0));
+  CHECK(store.OutputGroupCount(0) == 2);
+  REQUIRE(store.Inputs(0).size() == 1);
+  CHECK(store.Inputs(0)[0].Name() == "INPUT0");
+  CHECK(store.Inputs(0)[0].DataType() == "UINT8");
+  CHECK(store.Inputs(0)[0].size == 4);
+
+  const auto copy{store.GetRecord(0)};
+  CHECK(copy.start_time_ == record.start_time_);
+  CHECK(copy.response_timestamps_ == record.response_timestamps_);
+  CHECK(copy.sequence_id_ == record.sequence_id_);
+  REQUIRE(copy.request_inputs_.size() == 1);
+  CHECK(
+      copy.request_inputs_[0].at("INPUT0").data_ ==
+      record.request_inputs_[0].at("INPUT0").data_);
+  REQUIRE(copy.response_outputs_.size() == 2);
+  CHECK(copy.response_outputs_[1].at("OUTPUT0").data_[0] == 1);
+}
+
+TEST_CASE("request_record_store: end timestamp with null last response")
+{
+  RequestRecordStore store{};
+  store.push_back(MakeRequestRecord(1, {2, 3}, true));
+  store.push_back(MakeRequestRecord(1, {2}, true));
+
+  CHECK(store.EndNs(0) == 2);
+  CHECK(store.EndNs(1) == 0);
+  CHECK(store.HasNullLastResponse(0));
+}
+
+TEST_CASE("request_record_store: Append from builder")
+{
+  const uint32_t name_id{RecordStringTable::Intern("INPUT0")};
+  const uint32_t data_type_id{RecordStringTable::Intern("BYTES")};
+  const std::vector<uint8_t> data{'a', 'b', 'c'};
+
+  RequestRecordBuilder builder{};
+  RequestRecordStore store{};
+  for (uint64_t i = 0; i < 3; i++) {
+    builder.Reset(true, i == 1, i);
+    builder.SetStartNs(10 * i);
+    builder.SetScheduledNs(10 * i + 5);
+    builder.AddInput(name_id, data_type_id, data.data(), data.size());
+    builder.AddResponse(10 * i + 1, false);
+    builder.AddOutput(name_id, data_type_id, data.data(), i);
+    builder.AddResponse(10 * i + 2, true);
+    store.Append(builder);
+  }
+
+  REQUIRE(store.size() == 3);
+  for (size_t i = 0; i < 3; i++) {
+    CHECK(store.StartNs(i) == 10 * i);
+    CHECK(store.ScheduledNs(i) == 10 * i + 5);
+    CHECK(store.EndNs(i) == 10 * i + 1);
+    CHECK(store.Delayed(i) == (i == 1));
+    CHECK(store.ResponseNs(i).size() == 2);
+    CHECK(store.OutputGroupCount(i) == 2);
+    REQUIRE(store.Outputs(i, 0).size() == 1);
+    CHECK(store.Outputs(i, 0)[0].size == i);
+    CHECK(store.Outputs(i, 1).empty());
+    REQUIRE(store.Inputs(i).size() == 1);
+    CHECK(store.Inputs(i)[0].data[2] == 'c');
+  }
+}
+
+TEST_CASE("request_record_store: Merge and MoveIf")
+{
+  RequestRecordStore first{};
+  first.push_back(MakeRequestRecord(1, {2}));
+  first.push_back(MakeRequestRecord(3, {4}));
+
+  RequestRecordStore second{};
+  second.push_back(MakeRequestRecord(5, {6}));
+
+  first.Merge(std::move(second));
+  CHECK(second.empty());
+  REQUIRE(first.size() == 3);
+  CHECK(first.StartNs(2) == 5);
+  CHECK(first.Inputs(2)[0].data[3] == 4);
+
+  RequestRecordStore selected{};
+  size_t classified_count{0};
+  first.MoveIf(
+      [&first, &classified_count](size_t i) {
+        classified_count++;
+        return first.EndNs(i) != 4;
+      },
+      selected);
+
+  // Each record is classified once
+  CHECK(classified_count == 3);
+  REQUIRE(selected.size() == 2);
+  CHECK(selected.StartNs(0) == 1);
+  CHECK(selected.StartNs(1) == 5);
+  CHECK(selected.Inputs(1)[0].data[0] == 1);
+  REQUIRE(first.size() == 1);
+  CHECK(first.StartNs(0) == 3);
+  CHECK(first.Outputs(0, 0)[0].data[0] == 0);
+
+  SUBCASE("none selected")
+  {
+    size_t calls{0};
+    first.MoveIf(
+        [&calls](size_t) {
+          calls++;
+          return false;
+        },
+        selected);
+    CHECK(calls == 1);
+    CHECK(first.size() == 1);
+    CHECK(selected.size() == 2);
+  }
+
+  SUBCASE("all selected")
+  {
+    first.MoveIf([](size_t) { return true; }, selected);
+    CHECK(first.empty());
+    REQUIRE(selected.size() == 3);
+    CHECK(selected.StartNs(2) == 3);
+    CHECK(selected.Inputs(2)[0].data[3] == 4);
+    CHECK(selected.Outputs(2, 0)[0].data[0] == 0);
+  }
+}
+
+TEST_CASE("request_record_store: input references")
+{
+  RequestRecordBuilder builder{};
+  builder.Reset(true, false, 0);
+  builder.SetInputRef(2, 7);
+  builder.AddResponse(1, false);
+
+  RequestRecordStore store{};
+  store.push_back(MakeRequestRecord(1, {2}));
+  store.Append(builder);
+  builder.Reset(true, false, 0);
+  store.Append(builder);
+
+  REQUIRE(store.size() == 3);
+  CHECK_FALSE(store.InputRef(0).IsValid());
+  REQUIRE(store.InputRef(1).IsValid());
+  CHECK(store.InputRef(1).stream_id == 2);
+  CHECK(store.InputRef(1).step_id == 7);
+  CHECK(store.Inputs(1).empty());
+  CHECK_FALSE(store.InputRef(2).IsValid());
+
+  RequestRecordStore merged{};
+  merged.push_back(MakeRequestRecord(5, {6}));
+  merged.Merge(std::move(store));
+  RequestRecordStore selected{};
+  merged.MoveIf([&merged](size_t i) { return i == 2; }, selected);
+
+  REQUIRE(selected.size() == 1);
+  CHECK(selected.InputRef(0).stream_id == 2);
+  CHECK(selected.InputRef(0).step_id == 7);
+  REQUIRE(merged.size() == 3);
+  CHECK_FALSE(merged.InputRef(1).IsValid());
+}
+
+TEST_CASE("request_record_store: hashed outputs")
+{
+  const uint32_t name_id{RecordStringTable::Intern("OUTPUT0")};
+  const uint32_t data_type_id{RecordStringTable::Intern("BYTES")};
+  const std::vector<uint8_t> data{'a', 'b', 'c'};
+
+  RequestRecordBuilder builder{};
+  builder.Reset(true, false, 0);
+  CHECK(builder.GetOutputCapture() == OutputCapturePolicy::Full);
+  builder.SetOutputCapture(OutputCapturePolicy::Hash);
+  builder.AddResponse(1, false);
+  builder.AddOutputHash(name_id, data_type_id, 42, 1000);
+  builder.AddOutput(name_id, data_type_id, data.data(), data.size());
+
+  RequestRecordStore store{};
+  store.Append(builder);
+  REQUIRE(store.Outputs(0, 0).size() == 2);
+  CHECK(store.Outputs(0, 0)[0].is_hash);
+  CHECK(store.Outputs(0, 0)[0].hash == 42);
+  CHECK(store.Outputs(0, 0)[0].size == 1000);
+  CHECK(store.Outputs(0, 0)[0].data == nullptr);
+  CHECK_FALSE(store.Outputs(0, 0)[1].is_hash);
+  CHECK(store.Outputs(0, 0)[1].data[1] == 'b');
+
+  RequestRecord record{};
+  record.response_timestamps_.emplace_back(std::chrono::nanoseconds(1));
+  record.response_outputs_.push_back(
+      {{"OUTPUT0", RecordData(uint64_t{7}, size_t{64}, "FP32")}});
+  store.push_back(record);
+
+  RequestRecordStore compacted{};
+  store.MoveIf([](size_t i) { return i == 0; }, compacted);
+  REQUIRE(store.size() == 1);
+  const auto copy{store.GetRecord(0)};
+  const auto& output{copy.response_outputs_[0].at("OUTPUT0")};
+  CHECK(output.is_hash_);
+  CHECK(output.hash_ == 7);
+  CHECK(output.size_ == 64);
+  CHECK(output == record.response_outputs_[0].at("OUTPUT0"));
+}
+
+TEST_CASE("request_record_handoff: TakeAll while appending")
+{
+  const size_t num_records{100000};
+  RequestRecordHandoff handoff{};
+
+  std::thread producer([&handoff, num_records]() {
+    RequestRecordBuilder builder{};
+    for (size_t i = 0; i < num_records; i++) {
+      builder.Reset(true, false, i);
+      builder.SetStartNs(i);
+      builder.AddResponse(i + 1, false);
+      handoff.Append(builder);
+    }
+  });
+
+  RequestRecordStore taken{};
+  while (taken.size() < num_records) {
+    handoff.TakeAll(taken);
+  }
+  producer.join();
+  handoff.TakeAll(taken);
+
+  REQUIRE(taken.size() == num_records);
+  CHECK(handoff.size() == 0);
+  for (size_t i = 0; i < num_records; i++) {
+    CHECK(taken.SequenceId(i) == i);
+  }
+}
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,126 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "client_backend/openai/sse_framer.h"
+#include "doctest.h"
+
+namespace triton { namespace perfanalyzer { namespace clientbackend {
+namespace openai {
+
+namespace {
+
+struct Event {
+  std::string text;
+  bool is_done;
+};
+
+// Feeds the chunks to the framer and returns the events it emitted
+std::vector<Event>
+Frame(SseFramer& framer, const std::vector<std::string>& chunks)
+{
+  std::vector<Event> events;
+  for (const auto& chunk : chunks) {
+    framer.Append(chunk, [&events](std::string&& event, bool is_done) {
+      events.push_back({std::move(event), is_done});
+    });
+  }
+  return events;
+}
+
+}  // namespace
+
+TEST_CASE("SseFramer")
+{
+  SseFramer framer;
+
+  SUBCASE("one event per chunk")
+  {
+    const auto events{
+        Frame(framer, {"data: {\"a\":1}\n\n", "data: [DONE]\n\n"})};
+    REQUIRE(events.size() == 2);
+    CHECK(events[0].text == "data: {\"a\":1}\n\n");
+    CHECK_FALSE(events[0].is_done);
+    CHECK(events[1].text == "data: [DONE]\n\n");
+    CHECK(events[1].is_done);
+    CHECK(framer.TakeRemainder().empty());
+  }
+
+  SUBCASE("several events in one chunk")
+  {
+    const auto events{
+        Frame(framer, {"data: 1\n\ndata: 2\n\ndata: [DONE]\n\n"})};
+    REQUIRE(events.size() == 3);
+    CHECK(events[0].text == "data: 1\n\n");
+    CHECK(events[1].text == "data: 2\n\n");
+    CHECK_FALSE(events[1].is_done);
+    CHECK(events[2].is_done);
+  }
+
+  SUBCASE("event split across chunks")
+  {
+    const auto events{
+        Frame(framer, {"da", "ta: {\"a\"", ":1}\n", "\ndata: 2"})};
+    REQUIRE(events.size() == 1);
+    CHECK(events[0].text == "data: {\"a\":1}\n\n");
+    CHECK(framer.TakeRemainder() == "data: 2");
+  }
+
+  SUBCASE("CRLF line endings split across chunks")
+  {
+    const auto events{Frame(
+        framer,
+        {"data: 1\r\n\r", "\ndata: 2\r", "\n\r\n", "data:[DONE]\r\r"})};
+    REQUIRE(events.size() == 3);
+    // The event is sent as soon as its blank line is, so the line feed of the
+    // last CRLF arrives after it
+    CHECK(events[0].text == "data: 1\r\n\r");
+    CHECK(events[1].text == "data: 2\r\n\r\n");
+    CHECK(events[2].text == "data:[DONE]\r\r");
+    CHECK(events[2].is_done);
+    CHECK(framer.TakeRemainder().empty());
+  }
+
+  SUBCASE("events without data are dropped")
+  {
+    const auto events{
+        Frame(framer, {"\n: keep-alive\n\nevent: ping\n\ndata: 1\n\n"})};
+    REQUIRE(events.size() == 1);
+    CHECK(events[0].text == "data: 1\n\n");
+  }
+
+  SUBCASE("[DONE] only as the whole data")
+  {
+    const auto events{Frame(framer, {"data: [DONE] soon\n\n"})};
+    REQUIRE(events.size() == 1);
+    CHECK_FALSE(events[0].is_done);
+  }
+}
+
+}}}}  // namespace triton::perfanalyzer::clientbackend::openai
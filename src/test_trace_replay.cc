@@ -0,0 +1,196 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "trace_replay.h"
+
+namespace triton { namespace perfanalyzer {
+
+using namespace std::chrono_literals;
+
+TEST_CASE("trace_replay: send times")
+{
+  TraceReplay replay{};
+
+  SUBCASE("millisecond timestamps are replayed as recorded")
+  {
+    CHECK(replay.SendTime(0) == 0ns);
+    CHECK(replay.SendTime(1500) == 1500ms);
+  }
+
+  SUBCASE("microsecond timestamps")
+  {
+    replay.time_unit = 1us;
+    CHECK(replay.SendTime(1500) == 1500us);
+  }
+
+  SUBCASE("speedup compresses the trace")
+  {
+    replay.speedup = 4;
+    CHECK(replay.SendTime(1000) == 250ms);
+    replay.speedup = 0.5;
+    CHECK(replay.SendTime(1000) == 2s);
+  }
+
+  SUBCASE("timestamps are sent relative to the start of the window")
+  {
+    replay.window_start = 10s;
+    replay.window_end = 20s;
+    replay.speedup = 2;
+    CHECK(replay.SendTime(9999) == std::nullopt);
+    CHECK(replay.SendTime(10000) == 0ns);
+    CHECK(replay.SendTime(14000) == 2s);
+    CHECK(replay.SendTime(20000) == std::nullopt);
+  }
+
+  SUBCASE("timestamps beyond the range of the clock are outside the window")
+  {
+    CHECK(replay.SendTime(UINT64_MAX) == std::nullopt);
+  }
+}
+
+TEST_CASE("trace_replay: parse window")
+{
+  using Window = std::pair<std::chrono::nanoseconds, std::chrono::nanoseconds>;
+
+  CHECK(TraceReplay::ParseWindow("10:20") == Window{10s, 20s});
+  CHECK(TraceReplay::ParseWindow("0.5:1.25") == Window{500ms, 1250ms});
+  CHECK(
+      TraceReplay::ParseWindow("3600:") ==
+      Window{1h, std::chrono::nanoseconds::max()});
+
+  for (const std::string spec : {"10", ":10", "-1:10", "1s:10s"}) {
+    const std::string expected{
+        "Invalid window '" + spec +
+        "'. The window must be <start>:<end> or <start>: in seconds."};
+    CHECK_THROWS_WITH_AS(
+        TraceReplay::ParseWindow(spec), expected.c_str(),
+        std::invalid_argument);
+  }
+  CHECK_THROWS_WITH_AS(
+      TraceReplay::ParseWindow("10:10"),
+      "Invalid window '10:10'. The end must be after the start.",
+      std::invalid_argument);
+}
+
+namespace {
+
+std::vector<std::chrono::nanoseconds>
+ReadAll(const TraceReplay& replay, const std::filesystem::path& path)
+{
+  TraceReader reader{replay, path.string()};
+  std::vector<std::chrono::nanoseconds> send_times{};
+  while (const auto send_time{reader.Next()}) {
+    send_times.push_back(*send_time);
+  }
+  return send_times;
+}
+
+}  // namespace
+
+TEST_CASE("trace_replay: read trace")
+{
+  const std::filesystem::path path{
+      std::filesystem::temp_directory_path() / "pa_test_trace_replay.csv"};
+  TraceReplay replay{};
+  replay.time_unit = 1us;
+
+  SUBCASE("comments and extra fields")
+  {
+    std::ofstream(path) << "# timestamp,session\n"
+                        << "1000,b\n"
+                        << "\n"
+                        << "2000\r\n"
+                        << "3000,a,x\n";
+
+    CHECK(
+        ReadAll(replay, path) ==
+        std::vector<std::chrono::nanoseconds>{1ms, 2ms, 3ms});
+
+    replay.window_start = 1500us;
+    replay.window_end = 2500us;
+    CHECK(
+        ReadAll(replay, path) == std::vector<std::chrono::nanoseconds>{500us});
+  }
+
+  SUBCASE("reading stops past the window")
+  {
+    std::ofstream(path) << "1000\n"
+                        << "2000\n"
+                        << "3000\n"
+                        << "not a timestamp\n";
+
+    replay.window_end = 2500us;
+    CHECK(
+        ReadAll(replay, path) ==
+        std::vector<std::chrono::nanoseconds>{1ms, 2ms});
+  }
+
+  SUBCASE("out of order timestamp")
+  {
+    std::ofstream(path) << "2000\n"
+                        << "1000\n";
+
+    const std::string expected{
+        "Out of order timestamp on line 2 of trace file '" + path.string() +
+        "': '1000'."};
+    CHECK_THROWS_WITH_AS(
+        ReadAll(replay, path), expected.c_str(), std::runtime_error);
+  }
+
+  SUBCASE("invalid timestamp")
+  {
+    std::ofstream(path) << "1000\n"
+                        << "-5\n";
+
+    const std::string expected{
+        "Invalid timestamp on line 2 of trace file '" + path.string() +
+        "': '-5'."};
+    CHECK_THROWS_WITH_AS(
+        ReadAll(replay, path), expected.c_str(), std::runtime_error);
+  }
+
+  SUBCASE("missing file")
+  {
+    std::filesystem::remove(path);
+
+    const std::string expected{
+        "Failed to open trace file '" + path.string() + "'."};
+    CHECK_THROWS_WITH_AS(
+        ReadAll(replay, path), expected.c_str(), std::runtime_error);
+  }
+
+  std::filesystem::remove(path);
+}
+
+}}  // namespace triton::perfanalyzer
@@ -25,6 +25,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include "output_capture.h"
+#include "perf_utils.h"
+#include "request_dispatcher.h"
+#include "request_pacer.h"
+
 namespace triton { namespace perfanalyzer {
 
 // Holds the configuration for a worker thread
@@ -52,6 +57,25 @@ struct ThreadConfig {
 
   // Whether or not the thread is issuing new inference requests
   bool is_paused_{false};
+
+  // How the response outputs of the requests are recorded
+  OutputCapture output_capture_{};
+
+  // How the worker keeps its concurrency of requests in flight
+  // TPA-69: This is only used in concurrency mode and shouldn't be visible in
+  // other modes
+  ConcurrencyEngine concurrency_engine_{ConcurrencyEngine::Threaded};
+
+  // How the worker waits for the scheduled time of each request
+  // TPA-69: This is only used in request-rate mode and shouldn't be visible in
+  // other modes
+  RequestPacing request_pacing_{};
+
+  // The queue the worker takes its requests from when they are released by a
+  // RequestDispatcher instead of its own schedule
+  // TPA-69: This is only used in request-rate mode and shouldn't be visible in
+  // other modes
+  std::shared_ptr<DispatchQueue> dispatch_queue_{};
 };
 
 
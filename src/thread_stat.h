@@ -33,7 +33,8 @@
 
 #include "client_backend/client_backend.h"
 #include "idle_timer.h"
-#include "request_record.h"
+#include "latency_histogram.h"
+#include "request_record_handoff.h"
 
 namespace triton::perfanalyzer {
 
@@ -52,12 +53,18 @@ struct ThreadStat {
   // Tracks the amount of time this thread spent sleeping or waiting
   IdleTimer idle_timer;
 
-  // A vector of request records
-  std::vector<RequestRecord> request_records_;
+  // The completed request records of this thread. Appends are serialized by
+  // mu_, but the profiler takes them without locking.
+  RequestRecordHandoff request_records_;
   // A lock to protect thread data
   std::mutex mu_;
   // The number of sent requests by this thread.
   std::atomic<size_t> num_sent_requests_{0};
+  // The number of requests of this thread that are sent and not completed.
+  std::atomic<size_t> num_in_flight_requests_{0};
+  // How late each request was sent relative to its schedule, in nanoseconds.
+  // Protected by mu_.
+  LatencyHistogram schedule_skew_{};
 };
 
 }  // namespace triton::perfanalyzer
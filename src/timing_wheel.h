@@ -0,0 +1,163 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace triton { namespace perfanalyzer {
+
+/// A hashed timing wheel that holds items until their deadline. Time is cut
+/// into ticks of a fixed resolution and every tick maps onto one of a ring of
+/// slots, so inserting an item and releasing the items of a tick cost the same
+/// no matter how many items are held. An item can only be inserted up to one
+/// turn of the wheel ahead of the current tick. Not thread-safe.
+///
+template <typename T>
+class TimingWheel {
+ public:
+  using TimePoint = std::chrono::steady_clock::time_point;
+
+  struct Entry {
+    TimePoint deadline;
+    T item;
+  };
+
+  /// \param tick The length of time covered by each slot.
+  /// \param num_slots The number of slots in the wheel.
+  /// \param origin The time the first tick of the wheel starts at.
+  TimingWheel(
+      const std::chrono::nanoseconds tick, const size_t num_slots,
+      const TimePoint origin)
+      : tick_(tick), slots_(num_slots), origin_(origin)
+  {
+  }
+
+  /// \return The length of time one turn of the wheel covers
+  std::chrono::nanoseconds Span() const { return tick_ * slots_.size(); }
+
+  /// \return The number of items held by the wheel
+  size_t Size() const { return size_; }
+
+  /// Adds an item to the wheel. Items due before the current tick are placed
+  /// in the current tick so that the next Advance releases them.
+  /// \param deadline The time the item is due.
+  /// \param item The item.
+  /// \return False, without adding the item, if the deadline is more than one
+  /// turn of the wheel ahead of the current tick
+  bool Insert(const TimePoint deadline, const T& item)
+  {
+    const int64_t tick{std::max(TickOf(deadline), current_tick_)};
+    if (tick - current_tick_ >= static_cast<int64_t>(slots_.size())) {
+      return false;
+    }
+    slots_[SlotOf(tick)].push_back(Entry{deadline, item});
+    size_++;
+    return true;
+  }
+
+  /// Moves the current tick up to the given time and releases every item due
+  /// by then.
+  /// \param now The current time.
+  /// \param expired Returns the released items appended in deadline order.
+  /// \return The number of items released
+  size_t Advance(const TimePoint now, std::vector<Entry>& expired)
+  {
+    const int64_t now_tick{TickOf(now)};
+    if (now_tick < current_tick_) {
+      return 0;
+    }
+
+    const size_t first{expired.size()};
+    const int64_t end_tick{
+        current_tick_ + static_cast<int64_t>(slots_.size())};
+    for (int64_t tick = current_tick_; tick <= now_tick && tick < end_tick;
+         tick++) {
+      auto& slot{slots_[SlotOf(tick)]};
+      if (tick < now_tick) {
+        // The whole tick has passed
+        expired.insert(expired.end(), slot.begin(), slot.end());
+        slot.clear();
+      } else {
+        const auto due{std::stable_partition(
+            slot.begin(), slot.end(),
+            [now](const Entry& entry) { return entry.deadline <= now; })};
+        expired.insert(expired.end(), slot.begin(), due);
+        slot.erase(slot.begin(), due);
+      }
+    }
+    current_tick_ = now_tick;
+
+    std::stable_sort(
+        expired.begin() + first, expired.end(),
+        [](const Entry& a, const Entry& b) { return a.deadline < b.deadline; });
+    const size_t num_expired{expired.size() - first};
+    size_ -= num_expired;
+    return num_expired;
+  }
+
+  /// \return The earliest deadline of the items held by the wheel, if any
+  std::optional<TimePoint> NextExpiry() const
+  {
+    if (size_ == 0) {
+      return std::nullopt;
+    }
+    for (size_t i = 0; i < slots_.size(); i++) {
+      const auto& slot{slots_[SlotOf(current_tick_ + i)]};
+      if (!slot.empty()) {
+        return std::min_element(
+                   slot.begin(), slot.end(),
+                   [](const Entry& a, const Entry& b) {
+                     return a.deadline < b.deadline;
+                   })
+            ->deadline;
+      }
+    }
+    return std::nullopt;
+  }
+
+ private:
+  int64_t TickOf(const TimePoint time) const
+  {
+    if (time <= origin_) {
+      return 0;
+    }
+    return (time - origin_) / tick_;
+  }
+
+  size_t SlotOf(const int64_t tick) const { return tick % slots_.size(); }
+
+  const std::chrono::nanoseconds tick_;
+  std::vector<std::vector<Entry>> slots_;
+  const TimePoint origin_;
+  int64_t current_tick_{0};
+  size_t size_{0};
+};
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,160 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "trace_replay.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace triton { namespace perfanalyzer {
+
+namespace {
+
+std::chrono::nanoseconds
+ParseSeconds(const std::string& value, const std::string& spec)
+{
+  size_t end{0};
+  double seconds{0};
+  try {
+    seconds = std::stod(value, &end);
+  }
+  catch (const std::exception&) {
+    end = 0;
+  }
+  if (value.empty() || end != value.size() || !(seconds >= 0) ||
+      seconds > std::numeric_limits<int64_t>::max() / 1e9) {
+    throw std::invalid_argument(
+        "Invalid window '" + spec +
+        "'. The window must be <start>:<end> or <start>: in seconds.");
+  }
+  return std::chrono::nanoseconds(static_cast<int64_t>(seconds * 1e9));
+}
+
+}  // namespace
+
+std::pair<std::chrono::nanoseconds, std::chrono::nanoseconds>
+TraceReplay::ParseWindow(const std::string& spec)
+{
+  const size_t colon{spec.find(':')};
+  if (colon == std::string::npos) {
+    throw std::invalid_argument(
+        "Invalid window '" + spec +
+        "'. The window must be <start>:<end> or <start>: in seconds.");
+  }
+  const std::chrono::nanoseconds start{
+      ParseSeconds(spec.substr(0, colon), spec)};
+  const std::string end_value{spec.substr(colon + 1)};
+  const std::chrono::nanoseconds end{
+      end_value.empty() ? std::chrono::nanoseconds::max()
+                        : ParseSeconds(end_value, spec)};
+  if (end <= start) {
+    throw std::invalid_argument(
+        "Invalid window '" + spec + "'. The end must be after the start.");
+  }
+  return {start, end};
+}
+
+std::optional<std::chrono::nanoseconds>
+TraceReplay::SendTime(const uint64_t timestamp) const
+{
+  // Timestamps beyond the range of the clock cannot be in the window
+  if (timestamp > static_cast<uint64_t>(
+                      std::chrono::nanoseconds::max().count() /
+                      time_unit.count())) {
+    return std::nullopt;
+  }
+  const std::chrono::nanoseconds trace_time{
+      static_cast<int64_t>(timestamp) * time_unit.count()};
+  if (trace_time < window_start || trace_time >= window_end) {
+    return std::nullopt;
+  }
+  return std::chrono::nanoseconds(static_cast<int64_t>(
+      static_cast<double>((trace_time - window_start).count()) / speedup));
+}
+
+TraceReader::TraceReader(const TraceReplay& replay, const std::string& path)
+    : replay_(replay), path_(path), buffer_(1 << 20)
+{
+  // The file is read in chunks of the size of the buffer
+  file_.rdbuf()->pubsetbuf(buffer_.data(), buffer_.size());
+  file_.open(path);
+  if (!file_) {
+    throw std::runtime_error("Failed to open trace file '" + path + "'.");
+  }
+}
+
+std::optional<std::chrono::nanoseconds>
+TraceReader::Next()
+{
+  while (!done_ && std::getline(file_, line_)) {
+    ++line_number_;
+    if (!line_.empty() && line_.back() == '\r') {
+      line_.pop_back();
+    }
+    if (line_.empty() || line_.front() == '#') {
+      continue;
+    }
+
+    const std::string value{line_.substr(0, line_.find(','))};
+    if (value.empty() || value.size() > 20 ||
+        value.find_first_not_of("0123456789") != std::string::npos) {
+      ThrowInvalidLine("Invalid timestamp");
+    }
+    uint64_t timestamp{0};
+    try {
+      timestamp = std::stoull(value);
+    }
+    catch (const std::out_of_range&) {
+      ThrowInvalidLine("Invalid timestamp");
+    }
+    if (timestamp < last_timestamp_) {
+      ThrowInvalidLine("Out of order timestamp");
+    }
+    last_timestamp_ = timestamp;
+
+    if (const auto send_time{replay_.SendTime(timestamp)}) {
+      in_window_ = true;
+      return send_time;
+    }
+    // The timestamps only go forward, so none of the rest is in the window
+    done_ = in_window_;
+  }
+  if (file_.bad()) {
+    throw std::runtime_error("Failed to read trace file '" + path_ + "'.");
+  }
+  done_ = true;
+  return std::nullopt;
+}
+
+void
+TraceReader::ThrowInvalidLine(const std::string& reason) const
+{
+  throw std::runtime_error(
+      reason + " on line " + std::to_string(line_number_) + " of trace file '" +
+      path_ + "': '" + line_ + "'.");
+}
+
+}}  // namespace triton::perfanalyzer
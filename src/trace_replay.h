@@ -0,0 +1,107 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace triton { namespace perfanalyzer {
+
+/// How the timestamps of a fixed-schedule trace are turned into the times
+/// the requests are sent at, relative to the start of the run.
+///
+/// Only the timestamps inside the window are replayed. They are sent
+/// relative to the start of the window, compressed by the speedup.
+///
+struct TraceReplay {
+  /// The duration of one unit of the trace timestamps
+  std::chrono::nanoseconds time_unit{std::chrono::milliseconds(1)};
+  /// How many times faster than recorded the trace is replayed
+  double speedup{1.0};
+  /// The replayed part of the trace, in trace time
+  std::chrono::nanoseconds window_start{0};
+  std::chrono::nanoseconds window_end{std::chrono::nanoseconds::max()};
+
+  /// Parses a window of the trace in seconds, given as <start>:<end> or as
+  /// <start>: to replay the trace from <start> until its end.
+  /// \param spec The window specification.
+  /// \return The start and end of the window.
+  /// \throws std::invalid_argument If the specification is not valid.
+  static std::pair<std::chrono::nanoseconds, std::chrono::nanoseconds>
+  ParseWindow(const std::string& spec);
+
+  /// Returns when the request with the given trace timestamp is sent, or
+  /// nothing if the timestamp is outside the window.
+  std::optional<std::chrono::nanoseconds> SendTime(
+      const uint64_t timestamp) const;
+
+  bool operator==(const TraceReplay& other) const = default;
+};
+
+/// Reads the send times of a trace file one after another, in chunks of
+/// bounded size, so that a trace of any length is replayed without being
+/// loaded into memory. The file has one timestamp per line, optionally
+/// followed by a comma and fields that are ignored. Empty lines and lines
+/// starting with '#' are skipped. The timestamps must be in increasing order,
+/// so the reading stops at the first one past the window.
+///
+class TraceReader {
+ public:
+  /// \param replay How the timestamps are turned into send times.
+  /// \param path The path of the trace file.
+  /// \throws std::runtime_error If the file cannot be opened.
+  TraceReader(const TraceReplay& replay, const std::string& path);
+
+  TraceReader(const TraceReader&) = delete;
+  TraceReader& operator=(const TraceReader&) = delete;
+
+  /// Returns the next send time inside the window, or nothing once there are
+  /// no more.
+  /// \throws std::runtime_error If the file cannot be read, or has a line
+  /// that does not start with a timestamp or goes back in time.
+  std::optional<std::chrono::nanoseconds> Next();
+
+ private:
+  [[noreturn]] void ThrowInvalidLine(const std::string& reason) const;
+
+  const TraceReplay replay_;
+  const std::string path_;
+  std::vector<char> buffer_;
+  std::ifstream file_{};
+  std::string line_{};
+  size_t line_number_{0};
+  uint64_t last_timestamp_{0};
+  // Whether a send time inside the window has been read
+  bool in_window_{false};
+  bool done_{false};
+};
+
+}}  // namespace triton::perfanalyzer
@@ -0,0 +1,140 @@
+// Copyright 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace triton { namespace perfanalyzer {
+
+/// A queue shared by a pool of consumers where every item is pushed to the
+/// lane of one of them. A consumer takes from its own lane first and steals
+/// from the lanes of the others when its own is empty, so that an item never
+/// waits for a busy consumer while another one is free. Items are always
+/// taken oldest first, from whichever lane they are taken from.
+///
+template <typename T>
+class WorkStealingQueue {
+ public:
+  /// \param num_owners The number of consumers, each of which owns a lane.
+  explicit WorkStealingQueue(const size_t num_owners)
+  {
+    for (size_t i = 0; i < num_owners; i++) {
+      lanes_.push_back(std::make_unique<Lane>());
+    }
+  }
+
+  /// \return The number of lanes of the queue
+  size_t NumOwners() const { return lanes_.size(); }
+
+  /// \return The number of items in all the lanes
+  size_t Size() const { return size_; }
+
+  /// Adds an item to the end of the lane of the given consumer and wakes up
+  /// a consumer waiting for one
+  void Push(const size_t owner, T item)
+  {
+    {
+      // Taking the wait lock keeps the notification from falling between the
+      // check and the wait of a consumer
+      std::lock_guard<std::mutex> wait_lock(wait_mutex_);
+      std::lock_guard<std::mutex> lock(lanes_[owner]->mutex);
+      lanes_[owner]->items.push_back(std::move(item));
+      size_++;
+    }
+    wait_cv_.notify_one();
+  }
+
+  /// Takes the oldest item of the lane of the given consumer, or else the
+  /// oldest item of the first other lane that has one
+  /// \return False if every lane is empty
+  bool TryPop(const size_t owner, T& item)
+  {
+    for (size_t i = 0; i < lanes_.size(); i++) {
+      if (PopFront(*lanes_[(owner + i) % lanes_.size()], item)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Like TryPop, but waits up to the given time for an item to be pushed if
+  /// every lane is empty
+  /// \return False if no item could be taken in time
+  bool WaitPop(
+      const size_t owner, T& item, const std::chrono::nanoseconds timeout)
+  {
+    const auto deadline{std::chrono::steady_clock::now() + timeout};
+    while (!TryPop(owner, item)) {
+      std::unique_lock<std::mutex> lock(wait_mutex_);
+      if (!wait_cv_.wait_until(
+              lock, deadline, [this]() { return size_ > 0; })) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Removes every item from the queue
+  void Clear()
+  {
+    for (auto& lane : lanes_) {
+      std::lock_guard<std::mutex> lock(lane->mutex);
+      size_ -= lane->items.size();
+      lane->items.clear();
+    }
+  }
+
+ private:
+  struct Lane {
+    std::mutex mutex;
+    std::deque<T> items;
+  };
+
+  bool PopFront(Lane& lane, T& item)
+  {
+    std::lock_guard<std::mutex> lock(lane.mutex);
+    if (lane.items.empty()) {
+      return false;
+    }
+    item = std::move(lane.items.front());
+    lane.items.pop_front();
+    size_--;
+    return true;
+  }
+
+  std::vector<std::unique_ptr<Lane>> lanes_;
+  std::atomic<size_t> size_{0};
+  std::mutex wait_mutex_;
+  std::condition_variable wait_cv_;
+};
+
+}}  // namespace triton::perfanalyzer